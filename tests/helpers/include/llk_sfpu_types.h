@@ -120,5 +120,14 @@ enum class SfpuType
     unary_min_int32,
     unary_max_uint32,
     unary_min_uint32,
+    softmax,
+    rope,
+    piecewise_poly,
+    gated_activation,
+    argmax,
+    fp8_quant,
+    cumulative,
+    reduce_scalar_stream,
+    stochastic_round,
 };
 #endif // ARCH_QUASAR
@@ -30,6 +30,15 @@ enum class PerfRunType
     L1_CONGESTION
 };
 
+// Reinit issued before every block, to measure the cost of reinitializing an op between other ops
+enum class PerfReinitType
+{
+    NONE,
+    MINIMAL,
+    SHORT,
+    FULL
+};
+
 inline void _perf_unpack_set_valid(std::uint32_t source)
 {
     std::uint32_t set_a = source == ckernel::SrcA ? 1 : 0;
@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "ckernel_sfpu.h"
+
+namespace test_utils
+{
+using namespace ckernel::sfpu;
+
+// Example activations for bfloat16 results, fitted at compile time. Each one meets its target with 4 intervals
+struct SigmoidSpec
+{
+    static constexpr double lower                = -8.0;
+    static constexpr double upper                = 8.0;
+    static constexpr std::uint32_t degree        = 6;
+    static constexpr double target_ulp           = 1.0;
+    static constexpr std::uint32_t mantissa_bits = 7;
+    static constexpr double ulp_floor            = 1.0 / 64;
+    static constexpr double lower_tail_slope = 0.0, lower_tail_intercept = 0.0;
+    static constexpr double upper_tail_slope = 0.0, upper_tail_intercept = 1.0;
+
+    static constexpr double eval(const double x)
+    {
+        return 1.0 / (1.0 + cmath::exp(-x));
+    }
+};
+
+struct GeluSpec
+{
+    static constexpr double lower                = -4.0;
+    static constexpr double upper                = 4.0;
+    static constexpr std::uint32_t degree        = 5;
+    static constexpr double target_ulp           = 1.0;
+    static constexpr std::uint32_t mantissa_bits = 7;
+    static constexpr double ulp_floor            = 1.0 / 64;
+    static constexpr double lower_tail_slope = 0.0, lower_tail_intercept = 0.0;
+    static constexpr double upper_tail_slope = 1.0, upper_tail_intercept = 0.0;
+
+    static constexpr double eval(const double x)
+    {
+        return 0.5 * x * (1.0 + cmath::erf(x * 0.70710678118654752440));
+    }
+};
+
+struct SoftplusSpec
+{
+    static constexpr double lower                = -8.0;
+    static constexpr double upper                = 8.0;
+    static constexpr std::uint32_t degree        = 6;
+    static constexpr double target_ulp           = 1.0;
+    static constexpr std::uint32_t mantissa_bits = 7;
+    static constexpr double ulp_floor            = 1.0 / 64;
+    static constexpr double lower_tail_slope = 0.0, lower_tail_intercept = 0.0;
+    static constexpr double upper_tail_slope = 1.0, upper_tail_intercept = 0.0;
+
+    static constexpr double eval(const double x)
+    {
+        return x > 0.0 ? x + cmath::log1p(cmath::exp(-x)) : cmath::log1p(cmath::exp(x));
+    }
+};
+
+// Spec selected by the PIECEWISE_FUNCTION test parameter
+template <std::uint32_t FUNCTION>
+using PiecewiseActivationSpec = std::conditional_t<FUNCTION == 0, SigmoidSpec, std::conditional_t<FUNCTION == 1, GeluSpec, SoftplusSpec>>;
+
+} // namespace test_utils
@@ -136,6 +136,8 @@ def infer_unpack_out(
         The inferred output data format for unpacking to registers
     """
     # MX formats can only exist in L1, not in registers. Hardware unpacks MX to bfloat16 for math.
+    # Quasar matmul may keep MxFp4 2x-packed instead, _llk_unpack_matmul_src_reg_format_<EN_X2>
+    # picks that source register format on the LLK side.
     if input_format.is_mx_format():
         return DataFormat.Float16_b
 
@@ -484,6 +486,8 @@ def data_formats(
     ):  # TODO: What happens here when we have two different input formats?
         # Return a single FormatConfig where all formats are the same if format inference is disabled or not supported for the architecture
         # MX formats can only exist in L1, not in registers. Hardware unpacks MX to bfloat16 for math.
+    # Quasar matmul may keep MxFp4 2x-packed instead, _llk_unpack_matmul_src_reg_format_<EN_X2>
+    # picks that source register format on the LLK side.
         if input_format.is_mx_format():
             unpack_dst = DataFormat.Float16_b
             math_format = DataFormat.Float16_b
@@ -22,6 +22,9 @@ MXFP8_E5M2_MAX_NORMAL = float(
 MXFP8_E4M3_MAX_NORMAL = float(
     ml_dtypes.finfo(ml_dtypes.float8_e4m3fn).max
 )  # 448.0 from dtype
+MXFP4_E2M1_MAX_NORMAL = float(
+    ml_dtypes.finfo(ml_dtypes.float4_e2m1fn).max
+)  # 6.0 from dtype
 
 # ============================================================================
 # MX SrcS Slice L1 Layout
@@ -105,6 +108,7 @@ class DataFormat(Enum):
     UInt8 = DataFormatInfo("UInt8", 1)
     MxFp8R = DataFormatInfo("MxFp8R", 1)  # QSR specific
     MxFp8P = DataFormatInfo("MxFp8P", 1)  # QSR specific
+    MxFp4 = DataFormatInfo("MxFp4", 1)  # QSR specific, two elements per byte in L1
     Fp8_e4m3 = DataFormatInfo("Fp8_e4m3", 1)
 
     @property
@@ -160,6 +164,8 @@ class DataFormat(Enum):
         elif self.is_mx_format():
             # MX formats: 1 scale (E8M0, 8 bits) per 32 elements
             num_scales = num_datums // MXFP8_BLOCK_SIZE
+            if self == DataFormat.MxFp4:
+                return l1_align(num_scales) + l1_align(num_datums // 2)
             return l1_align(num_scales) + l1_align(self.size * num_datums)
         return (self.size * num_datums) + num_exponents
 
@@ -172,6 +178,7 @@ class DataFormat(Enum):
         return self in {
             DataFormat.MxFp8R,
             DataFormat.MxFp8P,
+            DataFormat.MxFp4,
         }
 
 
@@ -440,6 +447,7 @@ QUASAR_DATA_FORMAT_ENUM_VALUES = {
     DataFormat.Float16_b: 5,
     DataFormat.MxFp8R: 18,
     DataFormat.MxFp8P: 20,
+    DataFormat.MxFp4: 22,
     DataFormat.Int32: 8,
     DataFormat.Int8: 14,
     DataFormat.UInt8: 17,
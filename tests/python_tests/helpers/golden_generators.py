@@ -23,9 +23,9 @@ from helpers.llk_params import (
     format_dict,
     pack_relu_config,
 )
-from helpers.pack import pack_mxfp8p, pack_mxfp8r
+from helpers.pack import pack_mxfp4, pack_mxfp8p, pack_mxfp8r
 from helpers.tilize_untilize import tilize_block, untilize_block
-from helpers.unpack import unpack_mxfp8p, unpack_mxfp8r
+from helpers.unpack import unpack_mxfp4, unpack_mxfp8p, unpack_mxfp8r
 
 from .bfp_format_utils import bfp4b_to_float16b as _bfp4b_to_float16b
 from .bfp_format_utils import bfp8b_to_float16b as _bfp8b_to_float16b
@@ -290,7 +290,7 @@ def quantize_mx_stimuli(
 
     Args:
         tensor: Input tensor (bfloat16 values)
-        data_format: MX format (MxFp8R or MxFp8P)
+        data_format: MX format (MxFp8R, MxFp8P or MxFp4)
         num_faces: Number of faces (1, 2, or 4)
 
     Returns:
@@ -327,6 +327,9 @@ def quantize_mx_stimuli(
     elif data_format == DataFormat.MxFp8P:
         packed = pack_mxfp8p(tensor, num_faces=num_faces)
         return unpack_mxfp8p(packed, num_faces=num_faces)
+    elif data_format == DataFormat.MxFp4:
+        packed = pack_mxfp4(tensor, num_faces=num_faces)
+        return unpack_mxfp4(packed, num_faces=num_faces)
     else:
         # This should never happen due to validation above, but kept for safety
         raise ValueError(f"Unsupported MX format: {data_format}")
@@ -340,7 +343,7 @@ def quantize_mx_tensor_chunked(
 
     Args:
         tensor: Input tensor (bfloat16 values)
-        data_format: MX format (MxFp8R or MxFp8P)
+        data_format: MX format (MxFp8R, MxFp8P or MxFp4)
 
     Returns:
         Quantized tensor (bfloat16 values)
@@ -389,6 +392,36 @@ def quantize_mx_tensor_chunked(
     return quantized
 
 
+def quantize_mx_row_major(
+    tensor: torch.Tensor, data_format: DataFormat, dimensions
+) -> torch.Tensor:
+    """
+    Quantize a row-major tensor to an MX format.
+
+    MX blocks are 32 consecutive datums of the tilized L1 layout (two face rows),
+    so the tensor is tilized, quantized and untilized back to keep the block
+    boundaries identical to what the hardware sees.
+
+    Args:
+        tensor: Row-major input tensor
+        data_format: MX format (MxFp8R, MxFp8P or MxFp4)
+        dimensions: [rows, cols] of the tensor
+
+    Returns:
+        Quantized row-major tensor (bfloat16 values)
+    """
+    # Tilize as Float32 so reordering the datums does not round them before quantization
+    tilized = tilize_block(
+        tensor.to(torch.float32),
+        dimensions=dimensions,
+        stimuli_format=DataFormat.Float32,
+    ).flatten()
+    quantized = quantize_mx_tensor_chunked(tilized, data_format)
+    return untilize_block(
+        quantized, stimuli_format=data_format, dimensions=dimensions
+    ).flatten()
+
+
 class SrcFormatModel:
     """
     Source register holds data in TF32 format.
@@ -407,6 +440,7 @@ class SrcFormatModel:
             DataFormat.Float32: SrcFormatModel._fp32_to_tf32,
             DataFormat.MxFp8R: SrcFormatModel._mxfp8r_to_tf32,
             DataFormat.MxFp8P: SrcFormatModel._mxfp8p_to_tf32,
+            DataFormat.MxFp4: SrcFormatModel._mxfp8p_to_tf32,
             DataFormat.Fp8_e4m3: SrcFormatModel._fp8_e4m3_to_tf32,
         }
 
@@ -1048,6 +1082,63 @@ class MatmulGolden(FidelityMasking):
         return res
 
 
+@register_golden
+class MxMatmulGolden:
+    """
+    Golden for matmul with MX (microscaling) operands.
+
+    The unpacker applies the block exponent and expands MX elements to Float16_b
+    exactly (MxFp4 may stay 2x-packed, which holds the same values). MX elements
+    carry at most 3 mantissa bits, so every fidelity phase sees the full operands
+    and every partial product is exact in the fp32 dest.
+
+    The sum is modelled as one fp32 matmul, so the golden is bit exact only when
+    the fp32 accumulation is exact in any order, e.g. elements on a small dyadic
+    grid with a short K. The result is rounded once, when packed to the output
+    format.
+    """
+
+    def __call__(
+        self,
+        operand1,
+        operand2,
+        data_format,
+        input_A_dimensions,
+        input_B_dimensions,
+        input_A_format: DataFormat,
+        input_B_format: DataFormat,
+        tilize: bool = False,
+    ):
+        if not (input_A_format.is_mx_format() and input_B_format.is_mx_format()):
+            raise ValueError(
+                f"MxMatmulGolden needs MX operands, got {input_A_format} and {input_B_format}"
+            )
+
+        M, K1 = input_A_dimensions
+        K2, N = input_B_dimensions
+        if K1 != K2:
+            raise AssertionError(
+                f"Matrix dimensions incompatible: A[{M},{K1}] × B[{K2},{N}]"
+            )
+
+        t1 = quantize_mx_row_major(operand1, input_A_format, input_A_dimensions)
+        t2 = quantize_mx_row_major(operand2, input_B_format, input_B_dimensions)
+
+        res = torch.matmul(
+            t1.to(torch.float32).view(M, K1), t2.to(torch.float32).view(K2, N)
+        ).flatten()
+
+        if data_format.is_mx_format():
+            res = quantize_mx_row_major(res, data_format, [M, N])
+        res = res.to(format_dict[data_format])
+
+        if tilize:
+            res = tilize_block(
+                res, dimensions=(M, N), stimuli_format=data_format
+            ).flatten()
+        return res
+
+
 @register_golden
 class BroadcastGolden:
     """
@@ -2213,7 +2304,7 @@ class BinarySFPUGolden(EltwiseBinaryGolden):
 
 @register_golden
 class ReduceGolden:
-    """Golden for reduce operations (Max/Average/Sum pooling).
+    """Golden for reduce operations (Max/Min/Average/Sum pooling).
 
     Reduce dimensions:
         Column: f0+f2 (left), f1+f3 (right) → row 0
@@ -2286,6 +2377,8 @@ class ReduceGolden:
                 tile_result_f32 = tile_result.to(torch.float32)
                 if pool_type == ReducePool.Max:
                     accumulated = torch.maximum(accumulated, tile_result_f32)
+                elif pool_type == ReducePool.Min:
+                    accumulated = torch.minimum(accumulated, tile_result_f32)
                 elif pool_type == ReducePool.Sum:
                     accumulated = torch.add(accumulated, tile_result_f32)
                 elif pool_type == ReducePool.Average:
@@ -2381,6 +2474,8 @@ class ReduceGolden:
     def _apply_pooling(self, tensor, pool_type, dim):
         if pool_type == ReducePool.Max:
             return torch.max(tensor, dim=dim).values
+        elif pool_type == ReducePool.Min:
+            return torch.min(tensor, dim=dim).values
         elif pool_type == ReducePool.Average:
             return torch.mean(tensor, dim=dim)
         elif pool_type == ReducePool.Sum:
@@ -22,6 +22,7 @@ format_dict = {
     DataFormat.UInt8: torch.uint8,
     DataFormat.MxFp8R: torch.bfloat16,
     DataFormat.MxFp8P: torch.bfloat16,
+    DataFormat.MxFp4: torch.bfloat16,
     DataFormat.Fp8_e4m3: torch.bfloat16,
 }
 
@@ -190,6 +191,33 @@ class ReducePool(Enum):
         return f"PoolType::{self.value}"
 
 
+class NormType(Enum):
+    LayerNorm = "LayerNorm"
+    RMSNorm = "RMSNorm"
+
+
+class GatedActivation(Enum):
+    SwiGLU = "SwiGLU"
+    GeGLU = "GeGLU"
+
+
+class Fp8Format(Enum):
+    E4M3 = "E4M3"
+    E5M2 = "E5M2"
+
+
+class CumulativeOp(Enum):
+    Sum = "Sum"
+    Prod = "Prod"
+    Max = "Max"
+
+
+class PiecewiseFunction(Enum):
+    Sigmoid = 0
+    Gelu = 1
+    Softplus = 2
+
+
 class DestAccumulation(Enum):
     Yes = True
     No = False
@@ -407,6 +435,8 @@ format_tile_sizes = {
     # 1024 elements = 32 blocks × (1 scale + 32 elements) = 1056 bytes
     DataFormat.MxFp8R: 1056,
     DataFormat.MxFp8P: 1056,
+    # MxFp4: 32 scales + 1024 elements at 4 bits each = 544 bytes
+    DataFormat.MxFp4: 544,
     DataFormat.Fp8_e4m3: 1024,  # 1 byte per element, no exponent section
 }
 
@@ -467,6 +497,13 @@ class PerfRunType(Enum):
     L1_CONGESTION = 5
 
 
+class PerfReinitType(Enum):
+    NONE = 1
+    MINIMAL = 2
+    SHORT = 3
+    FULL = 4
+
+
 # ******** QUASAR specific ********
 class ImpliedMathFormat(Enum):
     No = "false"
@@ -8,6 +8,7 @@ import numpy as np
 import torch
 
 from .format_config import (
+    MXFP4_E2M1_MAX_NORMAL,
     MXFP8_BLOCK_SIZE,
     MXFP8_E4M3_MAX_NORMAL,
     MXFP8_E5M2_MAX_NORMAL,
@@ -452,3 +453,47 @@ def pack_mxfp8p(
     return _pack_mxfp8(
         tensor, ml_dtypes.float8_e4m3fn, MXFP8_E4M3_MAX_NORMAL, num_faces, face_r_dim
     )
+
+
+def pack_mxfp4(
+    tensor, num_faces=4, face_r_dim=16, use_srcs: bool = False, dest_acc: bool = False
+):
+    """
+    Pack tensor into MXFP4 format (E2M1 elements).
+
+    Same blocks and scales as MXFP8, but every element is 4 bits and two
+    consecutive elements share one byte, the first one in the low nibble.
+    - Full tile: 32 scales (32 B, aligned) + 512 B of elements → 544 B.
+
+    Element format E2M1:
+    - 1 sign bit, 2 exponent bits (bias=1), 1 mantissa bit
+    - Max normal: ±6
+    - No Inf or NaN
+
+    Args:
+        tensor: Input tensor (at most one tile worth of elements).
+        num_faces: Number of faces to pack (1, 2, or 4). Defaults to 4.
+        face_r_dim: Number of rows per face (1, 2, 4, 8, or 16). Defaults to 16.
+        use_srcs: SrcS slices are not supported for MXFP4, must be False.
+        dest_acc: Unused, kept for a packer signature shared with MXFP8.
+
+    Returns:
+        List of packed bytes in FULLY SEPARATED layout: [all_scales][all_elements]
+    """
+    assert tensor.numel() <= MAX_TILE_ELEMENTS, (
+        f"pack_mxfp4 handles at most one tile ({MAX_TILE_ELEMENTS} elements), "
+        f"got {tensor.numel()}"
+    )
+    assert not use_srcs, "SrcS slices are not supported for MXFP4"
+
+    # One byte per element first, then fold the element section into nibbles
+    packed = _pack_mxfp8(
+        tensor, ml_dtypes.float4_e2m1fn, MXFP4_E2M1_MAX_NORMAL, num_faces, face_r_dim
+    )
+    num_elements = face_r_dim * FACE_C_DIM * num_faces
+    scale_section_len = l1_align(num_elements // MXFP8_BLOCK_SIZE)
+    elements = np.array(
+        packed[scale_section_len : scale_section_len + num_elements], dtype=np.uint8
+    )
+    nibbles = (elements[0::2] & 0xF) | ((elements[1::2] & 0xF) << 4)
+    return packed[:scale_section_len] + _pad_to_l1_alignment(nibbles.tolist())
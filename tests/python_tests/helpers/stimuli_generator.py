@@ -7,6 +7,7 @@ import torch
 
 from .bfp_format_utils import bfp4b_to_float16b
 from .format_config import (
+    MXFP4_E2M1_MAX_NORMAL,
     MXFP8_E4M3_MAX_NORMAL,
     MXFP8_E5M2_MAX_NORMAL,
     DataFormat,
@@ -64,8 +65,8 @@ def generate_random_face(
 ):
     size = face_r_dim * FACE_C_DIM  # face_r_dim rows × FACE_C_DIM columns
 
-    if stimuli_format in [DataFormat.MxFp8R, DataFormat.MxFp8P]:
-        # MXFP8 optimized stimuli generation
+    if stimuli_format.is_mx_format():
+        # MX optimized stimuli generation
         return _generate_mxfp8_face(stimuli_format, size, const_face, const_value, sfpu)
     elif stimuli_format not in (DataFormat.Bfp8_b, DataFormat.Bfp4_b):
         if stimuli_format.is_integer():
@@ -128,10 +129,11 @@ def generate_random_face(
 
 def _generate_mxfp8_face(stimuli_format, size, const_face, const_value, sfpu):
     """
-    Generate test data for MXFP8 formats using normal distribution scaled to format range.
+    Generate test data for MX formats using normal distribution scaled to format range.
 
-    Uses conservative scaling (5% of max normal) to avoid saturation while creating
-    diverse test data with realistic dynamic range. Max values from format_config.py.
+    Uses conservative scaling (5% of max normal, 50% for the narrow E2M1) to avoid
+    saturation while creating diverse test data with realistic dynamic range.
+    Max values from format_config.py.
     """
     if const_face:
         return torch.ones(size, dtype=torch.bfloat16) * const_value
@@ -140,6 +142,9 @@ def _generate_mxfp8_face(stimuli_format, size, const_face, const_value, sfpu):
     # This ensures values are well within representable range while maintaining diversity
     if stimuli_format == DataFormat.MxFp8R:
         scale = 0.05 * MXFP8_E5M2_MAX_NORMAL
+    elif stimuli_format == DataFormat.MxFp4:
+        # E2M1 has a single mantissa bit, a wider spread still exercises every code
+        scale = 0.5 * MXFP4_E2M1_MAX_NORMAL
     else:  # MxFp8P
         scale = 0.05 * MXFP8_E4M3_MAX_NORMAL
 
@@ -416,15 +421,16 @@ def _clamp_mx_tensors(
     Returns:
         tuple: (clamped_srcA_tensor, clamped_srcB_tensor)
     """
-    # Clamp inputs if both are different MX formats (use more restrictive MxFp8P)
+    # Clamp inputs if both are different MX formats (use the more restrictive format)
     if stimuli_format_A.is_mx_format() and stimuli_format_B.is_mx_format():
         if stimuli_format_A != stimuli_format_B:
-            srcA_tensor = torch.clamp(
-                srcA_tensor, -MXFP8_E4M3_MAX_NORMAL, MXFP8_E4M3_MAX_NORMAL
-            )
-            srcB_tensor = torch.clamp(
-                srcB_tensor, -MXFP8_E4M3_MAX_NORMAL, MXFP8_E4M3_MAX_NORMAL
+            max_normal = (
+                MXFP4_E2M1_MAX_NORMAL
+                if DataFormat.MxFp4 in (stimuli_format_A, stimuli_format_B)
+                else MXFP8_E4M3_MAX_NORMAL
             )
+            srcA_tensor = torch.clamp(srcA_tensor, -max_normal, max_normal)
+            srcB_tensor = torch.clamp(srcB_tensor, -max_normal, max_normal)
 
     # Clamp inputs based on output format to prevent excessive rounding errors
     if output_format == DataFormat.MxFp8P:
@@ -441,6 +447,13 @@ def _clamp_mx_tensors(
         srcB_tensor = torch.clamp(
             srcB_tensor, -MXFP8_E5M2_MAX_NORMAL, MXFP8_E5M2_MAX_NORMAL
         )
+    elif output_format == DataFormat.MxFp4:
+        srcA_tensor = torch.clamp(
+            srcA_tensor, -MXFP4_E2M1_MAX_NORMAL, MXFP4_E2M1_MAX_NORMAL
+        )
+        srcB_tensor = torch.clamp(
+            srcB_tensor, -MXFP4_E2M1_MAX_NORMAL, MXFP4_E2M1_MAX_NORMAL
+        )
 
     return srcA_tensor, srcB_tensor
 
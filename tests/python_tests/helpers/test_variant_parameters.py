@@ -3,10 +3,12 @@
 # SPDX-License-Identifier: Apache-2.0
 
 import math
+import struct
 from abc import ABC, abstractmethod
 from ctypes import c_uint32
 from dataclasses import dataclass
 
+from .format_config import DataFormat
 from .golden_generators import TILE_DIMENSIONS
 from .llk_params import (
     FPU_BINARY_OPERATIONS,
@@ -15,16 +17,22 @@ from .llk_params import (
     SFPU_UNARY_OPERATIONS,
     ApproximationMode,
     BroadcastType,
+    CumulativeOp,
     DataCopyType,
     DestSync,
     EltwiseBinaryReuseDestType,
     FastMode,
+    Fp8Format,
+    GatedActivation,
     ImpliedMathFormat,
     L1Accumulation,
     MathFidelity,
     MathOperation,
     NarrowTile,
+    NormType,
+    PerfReinitType,
     PerfRunType,
+    PiecewiseFunction,
     ReducePool,
     StableSort,
     StochasticRounding,
@@ -122,6 +130,12 @@ class EN_DEST_REUSE(TemplateParameter):
         return "#define EN_DEST_REUSE"
 
 
+@dataclass
+class EN_DEST_REUSE_BLOCK(TemplateParameter):
+    def convert_to_cpp(self) -> str:
+        return "#define EN_DEST_REUSE_BLOCK"
+
+
 def _generate_operation_constants(mathop: MathOperation) -> list[str]:
     """Generate the appropriate operation constants based on the math operation type."""
     constants = []
@@ -271,6 +285,16 @@ class UNPACKER_ENGINE_SEL(TemplateParameter):
         return f"constexpr std::uint32_t UNPACKER_ENGINE_SEL = p_unpacr::{self.unpacker_engine_sel.value};"
 
 
+@dataclass
+class PERF_REINIT_TYPE(TemplateParameter):
+    perf_reinit_type: PerfReinitType
+
+    def convert_to_cpp(self) -> str:
+        return (
+            f"constexpr auto PERF_REINIT_TYPE = PerfReinitType::{self.perf_reinit_type.name};"
+        )
+
+
 @dataclass
 class PERF_RUN_TYPE(TemplateParameter):
     perf_run_type: PerfRunType
@@ -289,6 +313,132 @@ class REDUCE_POOL_TYPE(TemplateParameter):
         return f"constexpr auto POOL_TYPE = ckernel::PoolType::{self.reduce_pool_type.value};"
 
 
+@dataclass
+class DROPOUT(TemplateParameter):
+    probability: float = 0.0
+    scale: float = 1.0
+    seed: int = 0
+
+    def convert_to_cpp(self) -> str:
+        # Drop probability scaled to 0 - INT_MAX, scale as float32 bits
+        probability = min(int(self.probability * 2**31), 2**31 - 1)
+        scale_bits = struct.unpack("<I", struct.pack("<f", self.scale))[0]
+        lines: list[str] = [
+            f"constexpr std::uint32_t DROPOUT_PROBABILITY = {probability};",
+            f"constexpr std::uint32_t DROPOUT_SCALE = {scale_bits:#x};",
+            f"constexpr std::uint32_t DROPOUT_SEED = {self.seed:#x};",
+        ]
+        return "\n".join(lines)
+
+
+@dataclass
+class STOCHASTIC_ROUND(TemplateParameter):
+    seed: int = 0
+    per_face: bool = False
+
+    def convert_to_cpp(self) -> str:
+        lines: list[str] = [
+            f"constexpr std::uint32_t STOCHASTIC_ROUND_SEED = {self.seed:#x};",
+            f"constexpr bool STOCHASTIC_ROUND_PER_FACE = {str(self.per_face).lower()};",
+        ]
+        return "\n".join(lines)
+
+
+@dataclass
+class GATED_ACTIVATION(TemplateParameter):
+    activation: GatedActivation = GatedActivation.SwiGLU
+
+    def convert_to_cpp(self) -> str:
+        return f"constexpr auto GATED_ACTIVATION = ckernel::GatedActivation::{self.activation.value};"
+
+
+@dataclass
+class FP8_QUANT(TemplateParameter):
+    fp8_format: Fp8Format = Fp8Format.E4M3
+    dequantize: bool = False
+
+    def convert_to_cpp(self) -> str:
+        lines: list[str] = [
+            f"constexpr auto FP8_FORMAT = ckernel::Fp8Format::{self.fp8_format.value};",
+            f"constexpr bool FP8_DEQUANTIZE = {str(self.dequantize).lower()};",
+        ]
+        return "\n".join(lines)
+
+
+@dataclass
+class CUMULATIVE_OP(TemplateParameter):
+    op: CumulativeOp = CumulativeOp.Sum
+
+    def convert_to_cpp(self) -> str:
+        return f"constexpr auto CUMULATIVE_OP = ckernel::CumulativeOp::{self.op.value};"
+
+
+@dataclass
+class REDUCE_PER_TILE(TemplateParameter):
+    per_tile: bool = False
+
+    def convert_to_cpp(self) -> str:
+        return f"constexpr bool REDUCE_PER_TILE = {str(self.per_tile).lower()};"
+
+
+@dataclass
+class INT_FPU(TemplateParameter):
+    is_int_fpu: bool = False
+
+    def convert_to_cpp(self) -> str:
+        return f"constexpr bool IS_INT_FPU = {str(self.is_int_fpu).lower()};"
+
+
+@dataclass
+class REDUCE_COMPENSATED(TemplateParameter):
+    compensated: bool = False
+
+    def convert_to_cpp(self) -> str:
+        return (
+            f"constexpr bool REDUCE_COMPENSATED = {str(self.compensated).lower()};"
+        )
+
+
+@dataclass
+class NORM(TemplateParameter):
+    norm_type: NormType = NormType.LayerNorm
+    affine: bool = False
+
+    def convert_to_cpp(self) -> str:
+        lines: list[str] = [
+            f"constexpr auto NORM_TYPE = ckernel::NormType::{self.norm_type.value};",
+            f"constexpr bool NORM_AFFINE = {str(self.affine).lower()};",
+        ]
+        return "\n".join(lines)
+
+
+@dataclass
+class PIECEWISE_POLY(TemplateParameter):
+    function: PiecewiseFunction = PiecewiseFunction.Sigmoid
+    # Run the hand-written kernel of the same activation instead of the polynomial
+    reference: bool = False
+
+    def convert_to_cpp(self) -> str:
+        lines: list[str] = [
+            f"constexpr std::uint32_t PIECEWISE_FUNCTION = {self.function.value};",
+            f"constexpr bool PIECEWISE_REFERENCE = {str(self.reference).lower()};",
+        ]
+        return "\n".join(lines)
+
+
+@dataclass
+class ROPE(TemplateParameter):
+    position_offset: int = 0
+    freq_base: float = 10000.0
+
+    def convert_to_cpp(self) -> str:
+        lines: list[str] = [
+            f"constexpr std::uint32_t ROPE_POSITION_OFFSET = {self.position_offset};",
+            f"constexpr float ROPE_FREQ_BASE = {float(self.freq_base)}f;",
+        ]
+        return "\n".join(lines)
+
+
 @dataclass
 class TOPK(TemplateParameter):
     topk_k: int = 0
@@ -333,6 +483,46 @@ class TO_FROM_INT8(TemplateParameter):
         return f"constexpr bool TO_FROM_INT8 = {str(self.to_from_int8).lower()};"
 
 
+@dataclass
+class SFPU_QUASAR_OP(TemplateParameter):
+    """
+    Quasar SFPU op, the BinaryOp only selects the op for SfpuType::add and the
+    typecast formats only select the conversion for SfpuType::typecast.
+    """
+
+    sfpu_type: str
+    binary_op: str = "ADD"
+    typecast_src: DataFormat = DataFormat.Float32
+    typecast_dst: DataFormat = DataFormat.Float16_b
+
+    def convert_to_cpp(self) -> str:
+        return (
+            f"constexpr auto SFPU_UNARY_OPERATION = SfpuType::{self.sfpu_type};\n"
+            "constexpr auto SFPU_BINARY_OPERATION = "
+            f"ckernel::BinaryOp::{self.binary_op};\n"
+            "constexpr auto TYPECAST_SRC_FORMAT = "
+            f"DataFormat::{self.typecast_src.name};\n"
+            "constexpr auto TYPECAST_DST_FORMAT = "
+            f"DataFormat::{self.typecast_dst.name};"
+        )
+
+
+@dataclass
+class UNPACK_GATHER(TemplateParameter):
+    unpack_gather: bool
+
+    def convert_to_cpp(self) -> str:
+        return f"constexpr bool UNPACK_GATHER = {str(self.unpack_gather).lower()};"
+
+
+@dataclass
+class MATMUL_MXFP_2X(TemplateParameter):
+    mxfp_2x: bool = False
+
+    def convert_to_cpp(self) -> str:
+        return f"constexpr bool MATMUL_EN_X2 = {str(self.mxfp_2x).lower()};"
+
+
 # === RUNTIME PARAMETER IMPLEMENTATIONS ===
 
 
@@ -355,6 +355,49 @@ def unpack_mxfp8p(
     return _unpack_mxfp8(packed_bytes, ml_dtypes.float8_e4m3fn, num_faces, face_r_dim)
 
 
+def unpack_mxfp4(
+    packed_bytes,
+    num_faces=4,
+    face_r_dim=MAX_FACE_R_DIM,
+    use_srcs: bool = False,
+    dest_acc: bool = False,
+):
+    """
+    Unpack MXFP4 format (E2M1 elements, two per byte) to bfloat16 tensor.
+
+    Args:
+        packed_bytes: Packed MX data in FULLY SEPARATED layout [all_scales][all_elements]
+        num_faces: Number of faces to unpack (1, 2, or 4). Defaults to 4.
+        face_r_dim: Rows per face (1, 2, 4, 8, or 16). Defaults to 16.
+        use_srcs: SrcS slices are not supported for MXFP4, must be False.
+        dest_acc: Unused, kept for an unpacker signature shared with MXFP8.
+
+    Returns:
+        torch.Tensor of bfloat16 values
+    """
+    assert not use_srcs, "SrcS slices are not supported for MXFP4"
+
+    num_elements = face_r_dim * FACE_C_DIM * num_faces
+    scale_section_len = _align16(num_elements // MXFP8_BLOCK_SIZE)
+    nibbles = np.frombuffer(
+        bytes(
+            packed_bytes[scale_section_len : scale_section_len + num_elements // 2]
+        ),
+        dtype=np.uint8,
+    )
+
+    # Spread the nibbles back to one element per byte, the first one is the low nibble
+    elements = np.empty(num_elements, dtype=np.uint8)
+    elements[0::2] = nibbles & 0xF
+    elements[1::2] = nibbles >> 4
+    return _unpack_mxfp8(
+        list(packed_bytes[:scale_section_len]) + elements.tolist(),
+        ml_dtypes.float4_e2m1fn,
+        num_faces,
+        face_r_dim,
+    )
+
+
 _UNPACKERS = {
     DataFormat.Float16: unpack_fp16,
     DataFormat.Float16_b: unpack_bfp16,
@@ -410,6 +453,8 @@ def unpack_res_tiles(
         unpack_func = unpack_mxfp8r
     elif output_format == DataFormat.MxFp8P:
         unpack_func = unpack_mxfp8p
+    elif output_format == DataFormat.MxFp4:
+        unpack_func = unpack_mxfp4
     else:
         unpack_func = _UNPACKERS[output_format]
 
@@ -425,7 +470,7 @@ def unpack_res_tiles(
             unpacked_tile = unpack_func(
                 tile_data, sfpu=sfpu, num_faces=num_faces, face_r_dim=face_r_dim
             )
-        elif unpack_func in [unpack_mxfp8r, unpack_mxfp8p]:
+        elif unpack_func in [unpack_mxfp8r, unpack_mxfp8p, unpack_mxfp4]:
             unpacked_tile = unpack_func(
                 tile_data,
                 num_faces=num_faces,
@@ -2,7 +2,6 @@
 # SPDX-License-Identifier: Apache-2.0
 
 import pytest
-from conftest import skip_for_blackhole
 from helpers.format_config import DataFormat, InputOutputFormat
 from helpers.llk_params import DestAccumulation, PerfRunType
 from helpers.param_config import parametrize
@@ -49,11 +48,15 @@ def generate_input_dimensions(max_size: int) -> list[tuple[int, int]]:
     return dimensions
 
 
-@skip_for_blackhole
 @pytest.mark.perf
 @parametrize(
     input_format=[DataFormat.Float32, DataFormat.Float16_b],
-    output_format=[DataFormat.Float32, DataFormat.Float16_b, DataFormat.Bfp8_b],
+    output_format=[
+        DataFormat.Float32,
+        DataFormat.Float16_b,
+        DataFormat.Bfp8_b,
+        DataFormat.Bfp4_b,
+    ],
     dest_acc=[DestAccumulation.Yes, DestAccumulation.No],
     input_dimensions=generate_input_dimensions(16),
 )
@@ -95,3 +98,56 @@ def test_fast_tilize_perf(
     )
 
     configuration.run(perf_report, run_count=2)
+
+
+@pytest.mark.perf
+@parametrize(
+    input_format=[DataFormat.Float32, DataFormat.Float16_b],
+    output_format=[DataFormat.Float32, DataFormat.Float16_b],
+    dest_acc=[DestAccumulation.Yes, DestAccumulation.No],
+    input_dimensions=generate_input_dimensions(16),
+)
+def test_tilize_perf(
+    perf_report,
+    input_format,
+    output_format,
+    dest_acc,
+    input_dimensions,
+):
+    """
+    The standard unpack tilize path on the same tensors as test_fast_tilize_perf,
+    so the report shows what fast tilize gains for every shape.
+    Block float outputs are left out since the standard path packs floats only.
+    """
+    if input_format == DataFormat.Float32 and dest_acc == DestAccumulation.No:
+        pytest.skip("Float32 requires DestAccumulation.Yes")
+
+    tile_count = input_dimensions[0] * input_dimensions[1]
+    input_dimensions = (input_dimensions[0] * 32, input_dimensions[1] * 32)
+
+    formats = InputOutputFormat(input_format, output_format)
+
+    configuration = PerfConfig(
+        "sources/unpack_tilize_perf.cpp",
+        formats,
+        run_types=[PerfRunType.L1_TO_L1],
+        templates=[],
+        runtimes=[
+            generate_input_dim(input_dimensions, input_dimensions),
+            TILE_COUNT(tile_count),
+            LOOP_FACTOR(1024),
+        ],
+        variant_stimuli=StimuliConfig(
+            None,
+            formats.input_format,
+            None,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_count,
+            tile_count_B=tile_count,
+            tile_count_res=tile_count,
+        ),
+        dest_acc=dest_acc,
+    )
+
+    configuration.run(perf_report, run_count=2)
@@ -2,7 +2,7 @@
 # SPDX-License-Identifier: Apache-2.0
 
 import pytest
-from helpers.format_config import DataFormat
+from helpers.format_config import DataFormat, InputOutputFormat
 from helpers.llk_params import (
     DestAccumulation,
     MathOperation,
@@ -17,6 +17,7 @@ from helpers.param_config import (
 from helpers.perf import PerfConfig
 from helpers.stimuli_config import StimuliConfig
 from helpers.test_variant_parameters import (
+    INT_FPU,
     MATH_OP,
     REDUCE_POOL_TYPE,
     TILE_COUNT,
@@ -65,6 +66,59 @@ def test_perf_reduce(
         templates=[
             MATH_OP(mathop=REDUCE_MATHOP[reduce_dim]),
             REDUCE_POOL_TYPE(pool_type),
+            INT_FPU(False),
+        ],
+        runtimes=[TILE_COUNT(tile_count)],
+        variant_stimuli=StimuliConfig(
+            None,
+            formats.input_format,
+            None,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_count,
+            tile_count_B=tile_count,
+            tile_count_res=tile_count,
+        ),
+        unpack_to_dest=False,
+        dest_acc=dest_acc,
+    )
+
+    configuration.run(perf_report)
+
+
+@pytest.mark.perf
+@parametrize(
+    formats=[
+        InputOutputFormat(DataFormat.Int8, DataFormat.Int8),
+        InputOutputFormat(DataFormat.Int8, DataFormat.Int32),
+    ],
+    dest_acc=[DestAccumulation.Yes],  # Int8 inputs are accumulated in int32 dest
+    reduce_dim=[ReduceDimension.Row, ReduceDimension.Column, ReduceDimension.Scalar],
+    pool_type=[ReducePool.Max, ReducePool.Min, ReducePool.Sum],
+)
+def test_perf_reduce_int(
+    perf_report,
+    formats,
+    dest_acc,
+    reduce_dim,
+    pool_type,
+):
+
+    tile_count = 16
+    configuration = PerfConfig(
+        "sources/reduce_perf.cpp",
+        formats,
+        run_types=[
+            PerfRunType.L1_TO_L1,
+            PerfRunType.UNPACK_ISOLATE,
+            PerfRunType.MATH_ISOLATE,
+            PerfRunType.PACK_ISOLATE,
+            PerfRunType.L1_CONGESTION,
+        ],
+        templates=[
+            MATH_OP(mathop=REDUCE_MATHOP[reduce_dim]),
+            REDUCE_POOL_TYPE(pool_type),
+            INT_FPU(True),
         ],
         runtimes=[TILE_COUNT(tile_count)],
         variant_stimuli=StimuliConfig(
@@ -0,0 +1,94 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+from helpers.format_config import DataFormat
+from helpers.llk_params import (
+    DestAccumulation,
+    PerfReinitType,
+    PerfRunType,
+    ReducePool,
+)
+from helpers.param_config import (
+    input_output_formats,
+    parametrize,
+)
+from helpers.perf import PerfConfig
+from helpers.stimuli_config import StimuliConfig
+from helpers.test_variant_parameters import (
+    LOOP_FACTOR,
+    PERF_REINIT_TYPE,
+    REDUCE_POOL_TYPE,
+    generate_input_dim,
+)
+
+
+@pytest.mark.perf
+@parametrize(
+    formats=input_output_formats(
+        [DataFormat.Float16_b],  # Only Float16_b is supported for the block reduce
+        same=True,
+    ),
+    dest_acc=[DestAccumulation.No, DestAccumulation.Yes],
+    reduce_pool=[ReducePool.Max, ReducePool.Sum, ReducePool.Average],
+    reinit_type=[
+        PerfReinitType.NONE,
+        PerfReinitType.MINIMAL,
+        PerfReinitType.SHORT,
+        PerfReinitType.FULL,
+    ],
+    block_ct_dim=[2, 4, 8],
+    loop_factor=[16],
+)
+def test_perf_reduce_block_max_row_runtime(
+    perf_report,
+    formats,
+    dest_acc,
+    reduce_pool,
+    reinit_type,
+    block_ct_dim,
+    loop_factor,
+):
+    """
+    Performance test for the runtime block max row reduce used in SDPA.
+
+    Every row band of block_ct_dim tiles is reduced into one tile with a single MOP run,
+    and reinit_type selects the math reinit issued between blocks, to compare the cost
+    of the minimal, short and full reinit against none.
+    """
+
+    input_dimensions = [128, 32 * block_ct_dim]
+    tile_count = input_dimensions[0] // 32 * block_ct_dim
+
+    configuration = PerfConfig(
+        "sources/reduce_block_max_row_runtime_perf.cpp",
+        formats,
+        run_types=[
+            PerfRunType.L1_TO_L1,
+            PerfRunType.UNPACK_ISOLATE,
+            PerfRunType.MATH_ISOLATE,
+            PerfRunType.PACK_ISOLATE,
+        ],
+        templates=[
+            REDUCE_POOL_TYPE(reduce_pool),
+            PERF_REINIT_TYPE(reinit_type),
+        ],
+        runtimes=[
+            generate_input_dim(input_dimensions, input_dimensions),
+            LOOP_FACTOR(loop_factor),  # Used to minimize profiler overhead
+        ],
+        variant_stimuli=StimuliConfig(
+            None,
+            formats.input_format,
+            None,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_count,
+            tile_count_B=1,
+            tile_count_res=input_dimensions[0] // 32,
+        ),
+        unpack_to_dest=False,
+        dest_acc=dest_acc,
+    )
+
+    configuration.run(perf_report)
@@ -0,0 +1,71 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+from helpers.format_config import DataFormat
+from helpers.llk_params import DestAccumulation, PerfRunType, PiecewiseFunction
+from helpers.param_config import input_output_formats, parametrize
+from helpers.perf import PerfConfig
+from helpers.stimuli_config import StimuliConfig
+from helpers.test_variant_parameters import LOOP_FACTOR, PIECEWISE_POLY, TILE_COUNT
+
+
+@pytest.mark.perf
+@parametrize(
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32],
+        same=True,
+    ),
+    dest_acc=[DestAccumulation.No, DestAccumulation.Yes],
+    function=[
+        PiecewiseFunction.Sigmoid,
+        PiecewiseFunction.Gelu,
+        PiecewiseFunction.Softplus,
+    ],
+    reference=[False, True],
+    tile_count=8,
+    loop_factor=16,  # Used to minimize profiler overhead
+)
+def test_perf_sfpu_piecewise_poly(
+    perf_report, formats, dest_acc, function, reference, tile_count, loop_factor
+):
+    """
+    Performance test for the compile-time piecewise polynomial activations.
+
+    Every activation is fitted with 4 intervals. With reference the hand-written
+    sigmoid and gelu kernels run instead, and softplus as log(1 + exp(x)) from the
+    exp and log kernels, so the report puts both implementations side by side.
+    """
+
+    if formats.input_format == DataFormat.Float32 and dest_acc == DestAccumulation.No:
+        pytest.skip("Float32 requires DestAccumulation.Yes")
+
+    configuration = PerfConfig(
+        "sources/sfpu_piecewise_poly_perf.cpp",
+        formats,
+        run_types=[
+            PerfRunType.L1_TO_L1,
+            PerfRunType.UNPACK_ISOLATE,
+            PerfRunType.MATH_ISOLATE,
+            PerfRunType.PACK_ISOLATE,
+        ],
+        templates=[PIECEWISE_POLY(function, reference)],
+        runtimes=[
+            TILE_COUNT(tile_count),
+            LOOP_FACTOR(loop_factor),
+        ],
+        variant_stimuli=StimuliConfig(
+            None,
+            formats.input_format,
+            None,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_count,
+            tile_count_B=tile_count,
+            tile_count_res=tile_count,
+        ),
+        unpack_to_dest=False,
+        dest_acc=dest_acc,
+    )
+
+    configuration.run(perf_report)
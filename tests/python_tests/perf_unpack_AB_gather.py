@@ -0,0 +1,59 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+from helpers.constraints import get_valid_dest_accumulation_modes
+from helpers.format_config import DataFormat
+from helpers.llk_params import MathFidelity, MathOperation, PerfRunType
+from helpers.param_config import input_output_formats, parametrize
+from helpers.perf import PerfConfig
+from helpers.stimuli_config import StimuliConfig
+from helpers.test_variant_parameters import (
+    MATH_FIDELITY,
+    MATH_OP,
+    TILE_COUNT,
+    UNPACK_GATHER,
+)
+
+
+@pytest.mark.perf
+@parametrize(
+    formats=input_output_formats(
+        [DataFormat.Bfp8_b, DataFormat.Float16, DataFormat.Float16_b]
+    ),
+    unpack_gather=[False, True],
+    tile_count=16,
+    dest_acc=lambda formats: get_valid_dest_accumulation_modes(formats),
+)
+def test_perf_unpack_AB_gather(
+    perf_report,
+    formats,
+    unpack_gather,
+    tile_count,
+    dest_acc,
+):
+    # Same out of order tile list with and without the gather API, to compare the two
+    configuration = PerfConfig(
+        "sources/unpack_AB_gather_perf.cpp",
+        formats,
+        run_types=[PerfRunType.L1_TO_L1, PerfRunType.UNPACK_ISOLATE],
+        templates=[
+            MATH_FIDELITY(MathFidelity.LoFi),
+            MATH_OP(mathop=MathOperation.Elwadd),
+            UNPACK_GATHER(unpack_gather),
+        ],
+        runtimes=[TILE_COUNT(tile_count)],
+        variant_stimuli=StimuliConfig(
+            None,
+            formats.input_format,
+            None,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_count,
+            tile_count_B=tile_count,
+            tile_count_res=tile_count,
+        ),
+        dest_acc=dest_acc,
+    )
+
+    configuration.run(perf_report)
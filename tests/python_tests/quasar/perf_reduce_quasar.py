@@ -0,0 +1,99 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+# Math isolated throughput of the Quasar reduce, the float path next to the integer
+# path that pools Int8 into Int32 dest.
+
+import pytest
+from helpers.format_config import DataFormat, InputOutputFormat
+from helpers.llk_params import (
+    DestAccumulation,
+    ImpliedMathFormat,
+    MathFidelity,
+    MathOperation,
+    PerfRunType,
+    ReduceDimension,
+    ReducePool,
+)
+from helpers.param_config import parametrize
+from helpers.perf import PerfConfig
+from helpers.stimuli_config import StimuliConfig
+from helpers.test_variant_parameters import (
+    IMPLIED_MATH_FORMAT,
+    INT_FPU,
+    LOOP_FACTOR,
+    MATH_FIDELITY,
+    MATH_OP,
+    TILE_COUNT,
+)
+
+REDUCE_MATHOP = {
+    ReduceDimension.Row: MathOperation.ReduceRow,
+    ReduceDimension.Column: MathOperation.ReduceColumn,
+    ReduceDimension.Scalar: MathOperation.ReduceScalar,
+}
+
+# (input/output formats, dest accumulation, integer FPU), Int8 inputs are
+# accumulated in int32 dest
+REDUCE_PERF_FORMATS = [
+    (
+        InputOutputFormat(DataFormat.Float16_b, DataFormat.Float16_b),
+        DestAccumulation.No,
+        False,
+    ),
+    (InputOutputFormat(DataFormat.Int8, DataFormat.Int32), DestAccumulation.Yes, True),
+]
+
+
+@pytest.mark.perf
+@pytest.mark.quasar
+@parametrize(
+    formats_dest_acc_int_fpu=REDUCE_PERF_FORMATS,
+    reduce_dim=[ReduceDimension.Row, ReduceDimension.Column, ReduceDimension.Scalar],
+    pool_type=[ReducePool.Max, ReducePool.Sum],
+    loop_factor=[16],
+    tile_count=[8],
+)
+def test_perf_reduce_quasar(
+    perf_report,
+    formats_dest_acc_int_fpu,
+    reduce_dim,
+    pool_type,
+    loop_factor,
+    tile_count,
+):
+    formats, dest_acc, int_fpu = formats_dest_acc_int_fpu
+
+    # Max pool only supports LoFi, integer sum needs HiFi2 to multiply all srcA bits
+    math_fidelity = (
+        MathFidelity.LoFi if pool_type == ReducePool.Max else MathFidelity.HiFi2
+    )
+
+    configuration = PerfConfig(
+        "sources/quasar/reduce_perf_quasar.cpp",
+        formats,
+        run_types=[PerfRunType.MATH_ISOLATE],
+        templates=[
+            MATH_FIDELITY(math_fidelity),
+            MATH_OP(mathop=REDUCE_MATHOP[reduce_dim], pool_type=pool_type),
+            IMPLIED_MATH_FORMAT(ImpliedMathFormat.No),
+            INT_FPU(int_fpu),
+        ],
+        runtimes=[
+            TILE_COUNT(tile_count),
+            LOOP_FACTOR(loop_factor),
+        ],
+        variant_stimuli=StimuliConfig(
+            None,
+            formats.input_format,
+            None,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_count,
+            tile_count_B=tile_count,
+            tile_count_res=tile_count,
+        ),
+        dest_acc=dest_acc,
+    )
+
+    configuration.run(perf_report)
@@ -0,0 +1,75 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+# L1 to L1 datacopy + SFPU square on Quasar, with the SFPU inline on the math TRISC
+# versus overlapped on TRISC3, one tile per dest section.
+
+from dataclasses import dataclass
+
+import pytest
+from helpers.format_config import DataFormat
+from helpers.llk_params import (
+    DestAccumulation,
+    DestSync,
+    ImpliedMathFormat,
+    PerfRunType,
+)
+from helpers.param_config import input_output_formats, parametrize
+from helpers.perf import PerfConfig
+from helpers.stimuli_config import StimuliConfig
+from helpers.test_variant_parameters import (
+    DEST_SYNC,
+    IMPLIED_MATH_FORMAT,
+    LOOP_FACTOR,
+    TILE_COUNT,
+    TemplateParameter,
+)
+
+
+@dataclass
+class SFPU_OVERLAP(TemplateParameter):
+    overlap: bool
+
+    def convert_to_cpp(self) -> str:
+        return f"constexpr bool SFPU_OVERLAP = {str(self.overlap).lower()};"
+
+
+@pytest.mark.perf
+@pytest.mark.quasar
+@parametrize(
+    formats=input_output_formats([DataFormat.Float16_b], same=True),
+    overlap=[False, True],
+    loop_factor=[16],
+    tile_count=[8],
+)
+def test_perf_sfpu_overlap_quasar(
+    perf_report, formats, overlap, loop_factor, tile_count
+):
+    configuration = PerfConfig(
+        "sources/quasar/sfpu_overlap_perf_quasar.cpp",
+        formats,
+        run_types=[PerfRunType.L1_TO_L1],
+        templates=[
+            SFPU_OVERLAP(overlap),
+            IMPLIED_MATH_FORMAT(ImpliedMathFormat.No),
+            # Overlap needs two dest sections
+            DEST_SYNC(DestSync.Half),
+        ],
+        runtimes=[
+            TILE_COUNT(tile_count),
+            LOOP_FACTOR(loop_factor),
+        ],
+        variant_stimuli=StimuliConfig(
+            None,
+            formats.input_format,
+            None,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_count,
+            tile_count_B=tile_count,
+            tile_count_res=tile_count,
+        ),
+        dest_acc=DestAccumulation.No,
+    )
+
+    configuration.run(perf_report)
@@ -0,0 +1,80 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+# Math isolated throughput of the Quasar SFPU kernels, the op runs on whatever is
+# already in dest so only the SFPU instruction stream is measured.
+
+import pytest
+from helpers.format_config import DataFormat
+from helpers.llk_params import DestAccumulation, ImpliedMathFormat, PerfRunType
+from helpers.param_config import input_output_formats, parametrize
+from helpers.perf import PerfConfig
+from helpers.stimuli_config import StimuliConfig
+from helpers.test_variant_parameters import (
+    IMPLIED_MATH_FORMAT,
+    LOOP_FACTOR,
+    SFPU_QUASAR_OP,
+    TILE_COUNT,
+)
+
+
+# (SfpuType, BinaryOp), the binary op only matters for SfpuType::add
+SFPU_PERF_OPS = [
+    ("exponential", "ADD"),
+    ("log", "ADD"),
+    ("abs", "ADD"),
+    ("neg", "ADD"),
+    ("fill", "ADD"),
+    ("equal_zero", "ADD"),
+    ("greater_than_zero", "ADD"),
+    ("typecast", "ADD"),
+    ("dropout", "ADD"),
+    ("quant_int32", "ADD"),
+    ("requant_int32", "ADD"),
+    ("dequant_int32", "ADD"),
+    ("where", "ADD"),
+    ("bitwise_and", "ADD"),
+    ("add", "ADD"),
+    ("add", "MUL"),
+    ("add", "DIV"),
+    ("add", "RSHFT"),
+]
+
+
+@pytest.mark.perf
+@pytest.mark.quasar
+@parametrize(
+    formats=input_output_formats([DataFormat.Float32], same=True),
+    sfpu_op=SFPU_PERF_OPS,
+    loop_factor=[16],
+    tile_count=[8],
+)
+def test_perf_sfpu_quasar(perf_report, formats, sfpu_op, loop_factor, tile_count):
+    sfpu_type, binary_op = sfpu_op
+
+    configuration = PerfConfig(
+        "sources/quasar/sfpu_perf_quasar.cpp",
+        formats,
+        run_types=[PerfRunType.MATH_ISOLATE],
+        templates=[
+            SFPU_QUASAR_OP(sfpu_type, binary_op),
+            IMPLIED_MATH_FORMAT(ImpliedMathFormat.No),
+        ],
+        runtimes=[
+            TILE_COUNT(tile_count),
+            LOOP_FACTOR(loop_factor),
+        ],
+        variant_stimuli=StimuliConfig(
+            None,
+            formats.input_format,
+            None,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_count,
+            tile_count_B=tile_count,
+            tile_count_res=tile_count,
+        ),
+        dest_acc=DestAccumulation.Yes,
+    )
+
+    configuration.run(perf_report)
@@ -0,0 +1,158 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+
+import pytest
+import torch
+from helpers.format_config import DataFormat
+from helpers.golden_generators import TILE_DIM, MxMatmulGolden, get_golden_generator
+from helpers.llk_params import (
+    DestAccumulation,
+    DestSync,
+    ImpliedMathFormat,
+    MathFidelity,
+    Transpose,
+    format_dict,
+)
+from helpers.matmul_sweep import generate_tile_dims
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import (
+    CRK_TILE_DIMM,
+    DEST_SYNC,
+    IMPLIED_MATH_FORMAT,
+    MATH_FIDELITY,
+    MATMUL_MXFP_2X,
+    NUM_FACES,
+    TILE_COUNT,
+    UNPACK_TRANS_FACES,
+)
+from helpers.tilize_untilize import tilize_block
+from helpers.utils import passed_test
+
+# MX operands are unpacked to Float16_b (or kept 2x-packed for MxFp4 with
+# MATMUL_MXFP_2X) and accumulated in the fp32 dest, outputs are packed either
+# back to MX or to a plain float format
+MX_MATMUL_FORMATS = [
+    fmt
+    for fmt in input_output_formats(
+        [
+            DataFormat.MxFp8R,
+            DataFormat.MxFp8P,
+            DataFormat.MxFp4,
+            DataFormat.Float16_b,
+            DataFormat.Float32,
+        ]
+    )
+    if fmt.input_format.is_mx_format()
+]
+
+# Every E2M1 magnitude, these are also exact in E4M3 and E5M2
+E2M1_GRID = torch.tensor([0.0, 0.5, 1.0, 1.5, 2.0, 3.0, 4.0, 6.0])
+
+
+def generate_mx_grid_stimuli(dimensions):
+    """
+    Operand with every element on the E2M1 grid, so MX quantization is lossless.
+
+    The block scales are powers of two and keep the elements on the grid, products
+    are multiples of 0.25 up to 36 and sums over K <= 128 stay far below 2^24 ulps,
+    so fp32 accumulation is exact in any order.
+    """
+    numel = dimensions[0] * dimensions[1]
+    magnitudes = E2M1_GRID[torch.randint(0, len(E2M1_GRID), (numel,))]
+    signs = torch.where(torch.rand(numel) < 0.5, -1.0, 1.0)
+    return (magnitudes * signs).to(torch.bfloat16), numel // (TILE_DIM * TILE_DIM)
+
+
+@pytest.mark.quasar
+@parametrize(
+    formats=MX_MATMUL_FORMATS,
+    # MX elements carry at most 3 mantissa bits, LoFi already consumes them fully
+    math_fidelity=[MathFidelity.LoFi, MathFidelity.HiFi4],
+    # The 2x-packed source registers only exist for MxFp4 operands
+    mxfp_2x=lambda formats: (
+        [False, True] if formats.input_format == DataFormat.MxFp4 else [False]
+    ),
+    dest_acc=[DestAccumulation.Yes],
+    mt_dim=[1, 2],
+    nt_dim=[1, 2],
+    kt_dim=[1, 2, 4],
+)
+def test_matmul_mx(formats, math_fidelity, mxfp_2x, dest_acc, mt_dim, nt_dim, kt_dim):
+    input_A_dimensions = [mt_dim * TILE_DIM, kt_dim * TILE_DIM]
+    input_B_dimensions = [kt_dim * TILE_DIM, nt_dim * TILE_DIM]
+
+    src_A, tile_cnt_A = generate_mx_grid_stimuli(input_A_dimensions)
+    src_B, tile_cnt_B = generate_mx_grid_stimuli(input_B_dimensions)
+
+    matmul_dims = generate_tile_dims((input_A_dimensions, input_B_dimensions))
+
+    generate_golden = get_golden_generator(MxMatmulGolden)
+    golden_tensor = generate_golden(
+        src_A,
+        src_B,
+        formats.output_format,
+        input_A_dimensions=input_A_dimensions,
+        input_B_dimensions=input_B_dimensions,
+        input_A_format=formats.input_format,
+        input_B_format=formats.input_format,
+        tilize=True,
+    )
+
+    tilized_A = tilize_block(
+        src_A, dimensions=input_A_dimensions, stimuli_format=formats.input_format
+    )
+    tilized_B = tilize_block(
+        src_B, dimensions=input_B_dimensions, stimuli_format=formats.input_format
+    )
+
+    num_faces = 4
+
+    configuration = TestConfig(
+        "sources/quasar/matmul_quasar_test.cpp",
+        formats,
+        templates=[
+            MATH_FIDELITY(math_fidelity),
+            # MX formats require implied math format on Quasar
+            IMPLIED_MATH_FORMAT(ImpliedMathFormat.Yes),
+            DEST_SYNC(DestSync.Half),
+            UNPACK_TRANS_FACES(Transpose.No),
+            MATMUL_MXFP_2X(mxfp_2x),
+            CRK_TILE_DIMM(matmul_dims.ct_dim, matmul_dims.rt_dim, matmul_dims.kt_dim),
+            TILE_COUNT(matmul_dims.output_tile_cnt),
+            NUM_FACES(num_faces, num_faces, num_faces),
+        ],
+        runtimes=[],
+        variant_stimuli=StimuliConfig(
+            tilized_A.flatten(),
+            formats.input_format,
+            tilized_B.flatten(),
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=matmul_dims.output_tile_cnt,
+            num_faces=num_faces,
+        ),
+        unpack_to_dest=False,
+        dest_acc=dest_acc,
+    )
+
+    res_from_L1 = configuration.run().result
+
+    assert len(res_from_L1) == len(
+        golden_tensor
+    ), "Result tensor and golden tensor are not of the same length"
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    # The fp32 dest sum is exact, only the final rounding of the narrower outputs
+    # is left to the tolerance
+    if formats.output_format == DataFormat.Float32:
+        assert torch.equal(golden_tensor, res_tensor), "Assert against golden failed"
+    else:
+        assert passed_test(
+            golden_tensor, res_tensor, formats.output_format
+        ), "Assert against golden failed"
@@ -33,6 +33,7 @@ from helpers.test_variant_parameters import (
     DEST_SYNC,
     IMPLIED_MATH_FORMAT,
     MATH_FIDELITY,
+    MATMUL_MXFP_2X,
     NUM_FACES,
     TILE_COUNT,
     UNPACK_TRANS_FACES,
@@ -155,6 +156,7 @@ def test_matmul(
             IMPLIED_MATH_FORMAT(implied_math_format),
             DEST_SYNC(dest_sync_mode),
             UNPACK_TRANS_FACES(transpose),
+            MATMUL_MXFP_2X(False),
             CRK_TILE_DIMM(matmul_dims.ct_dim, matmul_dims.rt_dim, matmul_dims.kt_dim),
             TILE_COUNT(matmul_dims.output_tile_cnt),
             NUM_FACES(num_faces, num_faces, num_faces),
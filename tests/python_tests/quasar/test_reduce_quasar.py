@@ -5,7 +5,7 @@ from itertools import product
 
 import pytest
 import torch
-from helpers.format_config import DataFormat
+from helpers.format_config import DataFormat, InputOutputFormat
 from helpers.golden_generators import (
     ReduceGapoolGolden,
     ReduceGolden,
@@ -28,6 +28,7 @@ from helpers.test_config import TestConfig
 from helpers.test_variant_parameters import (
     DEST_SYNC,
     IMPLIED_MATH_FORMAT,
+    INT_FPU,
     MATH_FIDELITY,
     MATH_OP,
     NUM_FACES,
@@ -134,6 +135,7 @@ def test_reduce_quasar(
             UNPACKER_ENGINE_SEL(),
             IMPLIED_MATH_FORMAT(implied_math_format),
             DEST_SYNC(dest_sync_mode),
+            INT_FPU(False),
         ],
         runtimes=[
             TILE_COUNT(tile_cnt),
@@ -167,3 +169,83 @@ def test_reduce_quasar(
     assert passed_test(
         golden_tensor, res_tensor, formats.output_format
     ), "Assert against golden failed"
+
+
+@pytest.mark.quasar
+@parametrize(
+    formats=[InputOutputFormat(DataFormat.Int8, DataFormat.Int32)],
+    reduce_dim=[ReduceDimension.Row, ReduceDimension.Column, ReduceDimension.Scalar],
+    pool_type_and_math_fidelity=[
+        (ReducePool.Max, MathFidelity.LoFi),
+        # Integer sum needs HiFi2 or higher to multiply all srcA bits
+        (ReducePool.Sum, MathFidelity.HiFi2),
+        (ReducePool.Sum, MathFidelity.HiFi4),
+    ],
+    dest_sync_mode=[DestSync.Half, DestSync.Full],
+)
+def test_reduce_int_quasar(
+    formats,
+    reduce_dim,
+    pool_type_and_math_fidelity,
+    dest_sync_mode,
+):
+
+    pool_type, math_fidelity = pool_type_and_math_fidelity
+
+    input_dimensions = [64, 64]
+
+    src_A, tile_cnt, _, _ = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=input_dimensions,
+    )
+
+    # Use the full sign-magnitude int8 range so row and scalar sums overflow int8,
+    # the pooled int32 datums have to be moved through srcB exactly
+    src_A = torch.randint(-127, 128, src_A.shape, dtype=src_A.dtype)
+    src_B = torch.full((1024,), 1)
+
+    generate_golden = get_golden_generator(ReduceGolden)
+    golden_tensor = generate_golden(
+        src_A, reduce_dim, pool_type, formats.output_format, tile_cnt
+    )
+
+    configuration = TestConfig(
+        "sources/quasar/reduce_quasar_test.cpp",
+        formats,
+        templates=[
+            MATH_FIDELITY(math_fidelity),
+            MATH_OP(mathop=mathop_mapping[reduce_dim], pool_type=pool_type),
+            UNPACKER_ENGINE_SEL(),
+            IMPLIED_MATH_FORMAT(ImpliedMathFormat.No),
+            DEST_SYNC(dest_sync_mode),
+            INT_FPU(True),
+        ],
+        runtimes=[
+            TILE_COUNT(tile_cnt),
+            TEST_FACE_DIMS(),
+            NUM_FACES(),
+        ],
+        variant_stimuli=StimuliConfig(
+            src_A,
+            formats.input_format,
+            src_B,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt,
+            tile_count_B=1,
+            tile_count_res=tile_cnt,
+        ),
+        dest_acc=DestAccumulation.Yes,  # Int8 inputs are accumulated in int32 dest
+    )
+
+    res_from_L1 = configuration.run().result
+
+    assert len(res_from_L1) == len(
+        golden_tensor
+    ), "Result tensor and golden tensor are not of the same length"
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    assert torch.equal(golden_tensor, res_tensor), "Assert against golden failed"
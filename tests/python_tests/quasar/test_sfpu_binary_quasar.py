@@ -0,0 +1,299 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import torch
+from helpers.format_config import DataFormat
+from helpers.llk_params import (
+    DataCopyType,
+    DestAccumulation,
+    DestSync,
+    ImpliedMathFormat,
+    MathOperation,
+    UnpackerEngine,
+    format_dict,
+)
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import (
+    DATA_COPY_TYPE,
+    DEST_INDEX,
+    DEST_SYNC,
+    IMPLIED_MATH_FORMAT,
+    NUM_FACES,
+    SFPU_QUASAR_OP,
+    TEST_FACE_DIMS,
+    TILE_COUNT,
+    UNPACKER_ENGINE_SEL,
+)
+from helpers.utils import passed_test
+from test_sfpu_unary_quasar import (
+    float32_from_sign_magnitude,
+    sign_magnitude_from_float32,
+)
+
+TILE_ELEMENTS = 32 * 32
+
+# Must match QUANT_ZERO_POINT in sfpu_binary_quasar_test.cpp
+QUANT_ZERO_POINT = 3.0
+
+
+def run_sfpu_binary_quasar(formats, sfpu_op, src_A, tile_cnt, dest_sync):
+    """
+    Run one SFPU op on operand tiles stacked in src_A and return the result tile.
+
+    The operands are consecutive tiles in dest, the result overwrites the first.
+    """
+    dest_acc = (
+        DestAccumulation.Yes
+        if formats.input_format.is_32_bit()
+        else DestAccumulation.No
+    )
+
+    num_faces = 4
+    unpack_to_dest = formats.input_format.is_32_bit()
+    configuration = TestConfig(
+        "sources/quasar/sfpu_binary_quasar_test.cpp",
+        formats,
+        templates=[
+            SFPU_QUASAR_OP(*sfpu_op),
+            IMPLIED_MATH_FORMAT(ImpliedMathFormat.No),
+            DATA_COPY_TYPE(DataCopyType.A2D),
+            UNPACKER_ENGINE_SEL(
+                UnpackerEngine.UnpDest if unpack_to_dest else UnpackerEngine.UnpA
+            ),
+            DEST_SYNC(dest_sync),
+        ],
+        runtimes=[
+            TILE_COUNT(tile_cnt),
+            NUM_FACES(num_faces),
+            TEST_FACE_DIMS(),
+            DEST_INDEX(0),
+        ],
+        variant_stimuli=StimuliConfig(
+            src_A,
+            formats.input_format,
+            src_A,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt,
+            tile_count_B=tile_cnt,
+            tile_count_res=1,
+            num_faces=num_faces,
+        ),
+        unpack_to_dest=unpack_to_dest,
+        dest_acc=dest_acc,
+    )
+
+    res_from_L1 = configuration.run().result
+
+    assert (
+        len(res_from_L1) == TILE_ELEMENTS
+    ), "Result tensor and golden tensor are not of the same length"
+
+    return torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+
+@pytest.mark.quasar
+@parametrize(
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32],
+        same=True,
+    ),
+    mathop=[
+        MathOperation.SfpuElwadd,
+        MathOperation.SfpuElwsub,
+        MathOperation.SfpuElwrsub,
+        MathOperation.SfpuElwmul,
+        MathOperation.SfpuElwdiv,
+    ],
+    dest_sync=[DestSync.Half, DestSync.Full],
+)
+def test_sfpu_binary_quasar(formats, mathop, dest_sync):
+    """
+    Test SFPU binary operations on Quasar.
+
+    The two operands are consecutive tiles in dest, the result overwrites the first.
+    """
+    # Two tiles stacked vertically, tile 0 is the first operand, tile 1 the second
+    input_dimensions = [64, 32]
+    src_A, tile_cnt_A, _, _ = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=input_dimensions,
+    )
+
+    torch_format = format_dict[formats.input_format]
+    src_A = src_A.flatten().to(torch.float32)
+    if mathop == MathOperation.SfpuElwdiv:
+        # Keep the divisor in [0.5, 2] so the approximate reciprocal stays accurate
+        divisor = src_A[TILE_ELEMENTS:].abs()
+        src_A[TILE_ELEMENTS:] = 0.5 + 1.5 * divisor / divisor.max()
+    src_A = src_A.to(torch_format)
+
+    in0 = src_A[:TILE_ELEMENTS].to(torch.float32)
+    in1 = src_A[TILE_ELEMENTS:].to(torch.float32)
+    ops = {
+        MathOperation.SfpuElwadd: lambda: in0 + in1,
+        MathOperation.SfpuElwsub: lambda: in0 - in1,
+        MathOperation.SfpuElwrsub: lambda: in1 - in0,
+        MathOperation.SfpuElwmul: lambda: in0 * in1,
+        MathOperation.SfpuElwdiv: lambda: in0 / in1,
+    }
+    golden_tensor = ops[mathop]().to(format_dict[formats.output_format])
+
+    res_tensor = run_sfpu_binary_quasar(
+        formats, ("add", mathop.cpp_enum_value), src_A, tile_cnt_A, dest_sync
+    )
+
+    assert passed_test(
+        golden_tensor, res_tensor, formats.output_format
+    ), "Assert against golden failed"
+
+
+@pytest.mark.quasar
+@parametrize(
+    formats=input_output_formats([DataFormat.Int32], same=True),
+    sfpu_op=[
+        ("bitwise_and", "ADD"),
+        ("bitwise_or", "ADD"),
+        ("bitwise_xor", "ADD"),
+        ("add", "LSHFT"),
+        ("add", "RSHFT"),
+        ("add", "LOGICAL_RSHFT"),
+    ],
+    dest_sync=[DestSync.Half, DestSync.Full],
+)
+def test_sfpu_binary_int_quasar(formats, sfpu_op, dest_sync):
+    """
+    Test SFPU bitwise and shift operations on Int32 tiles on Quasar, bit exact.
+
+    Shift amounts cover [-4, 36) so amounts outside of [0, 32) shift out all bits.
+    """
+    iinfo = torch.iinfo(torch.int32)
+    # Sign-magnitude Int32 has no INT_MIN
+    in0 = torch.randint(iinfo.min + 1, iinfo.max, (TILE_ELEMENTS,), dtype=torch.int64)
+    if sfpu_op[0] == "add":
+        in1 = torch.randint(-4, 36, (TILE_ELEMENTS,), dtype=torch.int64)
+    else:
+        in1 = torch.randint(
+            iinfo.min + 1, iinfo.max, (TILE_ELEMENTS,), dtype=torch.int64
+        )
+
+    in_range = (in1 >= 0) & (in1 < 32)
+    amount = torch.where(in_range, in1, torch.zeros_like(in1))
+    bits = in0 & 0xFFFFFFFF
+    ops = {
+        ("bitwise_and", "ADD"): lambda: in0 & in1,
+        ("bitwise_or", "ADD"): lambda: in0 | in1,
+        ("bitwise_xor", "ADD"): lambda: in0 ^ in1,
+        ("add", "LSHFT"): lambda: torch.where(in_range, bits << amount, 0),
+        ("add", "RSHFT"): lambda: torch.where(
+            in_range, in0 >> amount, torch.where(in0 < 0, -1, 0)
+        ),
+        ("add", "LOGICAL_RSHFT"): lambda: torch.where(in_range, bits >> amount, 0),
+    }
+    # Wrap to int32 two's complement, the kernel works on 32 bit lanes
+    golden = ops[sfpu_op]() & 0xFFFFFFFF
+    golden_tensor = torch.where(golden >= 2**31, golden - 2**32, golden).to(
+        torch.int32
+    )
+
+    src_A = torch.cat([in0, in1]).to(torch.int32)
+    res_tensor = run_sfpu_binary_quasar(formats, sfpu_op, src_A, 2, dest_sync)
+
+    # -INT_MIN can come out of a left shift but has no sign-magnitude encoding
+    valid = golden_tensor != iinfo.min
+    assert torch.equal(
+        golden_tensor[valid], res_tensor[valid]
+    ), "Assert against golden failed"
+
+
+@pytest.mark.quasar
+@parametrize(
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32, DataFormat.Int32],
+        same=True,
+    ),
+    dest_sync=[DestSync.Half, DestSync.Full],
+)
+def test_sfpu_where_quasar(formats, dest_sync):
+    """
+    Test SFPU where on Quasar.
+
+    Tile 0 is the condition, tiles 1 and 2 hold the true and false values.
+    """
+    input_dimensions = [96, 32]
+    src_A, tile_cnt_A, _, _ = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=input_dimensions,
+        negative_values=True,
+    )
+
+    src_A = src_A.flatten()
+    # Zero out about half of the condition so both branches are taken
+    condition = src_A[:TILE_ELEMENTS]
+    src_A[:TILE_ELEMENTS] = torch.where(
+        torch.rand(TILE_ELEMENTS) < 0.5, torch.zeros_like(condition), condition
+    )
+
+    golden_tensor = torch.where(
+        src_A[:TILE_ELEMENTS] != 0,
+        src_A[TILE_ELEMENTS : 2 * TILE_ELEMENTS],
+        src_A[2 * TILE_ELEMENTS :],
+    ).to(format_dict[formats.output_format])
+
+    res_tensor = run_sfpu_binary_quasar(
+        formats, ("where", "ADD"), src_A, tile_cnt_A, dest_sync
+    )
+
+    # Where only selects datums, so the result is bit exact
+    assert torch.equal(golden_tensor, res_tensor), "Assert against golden failed"
+
+
+@pytest.mark.quasar
+@parametrize(
+    formats=input_output_formats([DataFormat.Int32], same=True),
+    sfpu_type=["quant_int32", "requant_int32", "dequant_int32"],
+    dest_sync=[DestSync.Half, DestSync.Full],
+)
+def test_sfpu_quant_quasar(formats, sfpu_type, dest_sync):
+    """
+    Test SFPU quantization, requantization and dequantization on Quasar.
+
+    Tile 0 is the input and tile 1 the fp32 scale, all tiles go through L1 as Int32
+    so fp32 operands and results are staged as the sign-magnitude Int32 holding
+    their bits.
+    """
+    scale = (0.5 + 1.5 * torch.rand(TILE_ELEMENTS)).to(torch.float32)
+    if sfpu_type == "quant_int32":
+        # Some products saturate the int8 range, every 16th lands on a tie
+        src = ((torch.rand(TILE_ELEMENTS) * 2 - 1) * 100).to(torch.float32)
+        src[::16] = 0.25
+        scale[::16] = 2.0
+        in0 = sign_magnitude_from_float32(src)
+    else:
+        src = torch.randint(-1000, 1000, (TILE_ELEMENTS,)).to(torch.float32)
+        in0 = src.to(torch.int32)
+
+    src_A = torch.cat([in0, sign_magnitude_from_float32(scale)])
+    res_tensor = run_sfpu_binary_quasar(
+        formats, (sfpu_type, "ADD"), src_A, 2, dest_sync
+    )
+
+    if sfpu_type == "dequant_int32":
+        golden = (src - QUANT_ZERO_POINT) * scale
+        res = float32_from_sign_magnitude(res_tensor)
+        assert torch.allclose(
+            golden, res, rtol=1e-6, atol=0
+        ), "Assert against golden failed"
+    else:
+        # Fused multiply add, rounded to the nearest even and saturated to int8
+        fused = (src.double() * scale.double() + QUANT_ZERO_POINT).float()
+        golden = torch.round(fused).clamp(-127, 127).to(torch.int32)
+        assert torch.equal(golden, res_tensor), "Assert against golden failed"
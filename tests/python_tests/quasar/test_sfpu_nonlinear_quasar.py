@@ -110,6 +110,9 @@ def generate_sfpu_nonlinear_combinations(
                             MathOperation.Tanh,
                             MathOperation.Sigmoid,
                             MathOperation.Silu,
+                            MathOperation.Log,
+                            MathOperation.Abs,
+                            MathOperation.Neg,
                         ]:
                             combinations.append(
                                 (
@@ -283,6 +286,12 @@ def prepare_inputs_for_operation(
         max_val = 10.0
         src_A = min_val + src_A.to(torch.float32) * (max_val - min_val)
         src_A = src_A.to(torch_format)
+    elif mathop == MathOperation.Log:
+        # Log-uniform positive range [0.01, 1000] for log - covers values on both sides of 1
+        log_min = torch.log(torch.tensor(0.01, dtype=torch.float32))
+        log_max = torch.log(torch.tensor(1000.0, dtype=torch.float32))
+        src_A = torch.exp(log_min + src_A.to(torch.float32) * (log_max - log_min))
+        src_A = src_A.to(torch_format)
     elif mathop == MathOperation.Silu:
         # Scale to range [-10, 10] for SiLU - covers meaningful range without saturation
         finfo = torch.finfo(torch_format)
@@ -312,7 +321,8 @@ SFPU_NONLINEAR_FORMATS = input_output_formats(
 )
 def test_sfpu_nonlinear_quasar(formats_dest_acc_sync_implied_math_input_dims_mathop):
     """
-    Test nonlinear SFPU operations (exp, gelu, relu, reciprocal, sqrt, tanh, sigmoid, silu) on Quasar architecture.
+    Test nonlinear SFPU operations (exp, gelu, relu, reciprocal, sqrt, tanh, sigmoid, silu, log, abs, neg)
+    on Quasar architecture.
 
     This test parameterizes over multiple operations to avoid code duplication.
     """
@@ -0,0 +1,345 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import torch
+from helpers.format_config import DataFormat, InputOutputFormat
+from helpers.llk_params import (
+    DataCopyType,
+    DestAccumulation,
+    DestSync,
+    ImpliedMathFormat,
+    UnpackerEngine,
+    format_dict,
+)
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import (
+    DATA_COPY_TYPE,
+    DEST_INDEX,
+    DEST_SYNC,
+    IMPLIED_MATH_FORMAT,
+    NUM_FACES,
+    SFPU_QUASAR_OP,
+    TEST_FACE_DIMS,
+    TILE_COUNT,
+    UNPACKER_ENGINE_SEL,
+)
+from helpers.utils import passed_test
+
+TILE_ELEMENTS = 32 * 32
+
+# Must match FILL_VALUE_FP32 / FILL_VALUE_INT32 in sfpu_unary_quasar_test.cpp
+FILL_VALUE_FLOAT = -2.5
+FILL_VALUE_INT = -5
+
+# Must match DROPOUT_PROBABILITY / DROPOUT_SCALE in sfpu_unary_quasar_test.cpp
+DROPOUT_PROBABILITY = 0.25
+DROPOUT_SCALE = 4 / 3
+
+
+def run_sfpu_unary_quasar(
+    formats,
+    sfpu_type,
+    src_A,
+    dest_sync,
+    typecast=(DataFormat.Float32, DataFormat.Float16_b),
+):
+    """
+    Run one unary SFPU op in place on a single tile and return the result.
+
+    typecast holds the source and destination format of SfpuType::typecast.
+    """
+    dest_acc = (
+        DestAccumulation.Yes
+        if formats.input_format.is_32_bit()
+        else DestAccumulation.No
+    )
+
+    num_faces = 4
+    unpack_to_dest = formats.input_format.is_32_bit()
+    configuration = TestConfig(
+        "sources/quasar/sfpu_unary_quasar_test.cpp",
+        formats,
+        templates=[
+            SFPU_QUASAR_OP(sfpu_type, "ADD", *typecast),
+            IMPLIED_MATH_FORMAT(ImpliedMathFormat.No),
+            DATA_COPY_TYPE(DataCopyType.A2D),
+            UNPACKER_ENGINE_SEL(
+                UnpackerEngine.UnpDest if unpack_to_dest else UnpackerEngine.UnpA
+            ),
+            DEST_SYNC(dest_sync),
+        ],
+        runtimes=[
+            TILE_COUNT(1),
+            NUM_FACES(num_faces),
+            TEST_FACE_DIMS(),
+            DEST_INDEX(0),
+        ],
+        variant_stimuli=StimuliConfig(
+            src_A,
+            formats.input_format,
+            src_A,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=1,
+            tile_count_B=1,
+            tile_count_res=1,
+            num_faces=num_faces,
+        ),
+        unpack_to_dest=unpack_to_dest,
+        dest_acc=dest_acc,
+    )
+
+    res_from_L1 = configuration.run().result
+
+    assert (
+        len(res_from_L1) == TILE_ELEMENTS
+    ), "Result tensor and golden tensor are not of the same length"
+
+    return torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+
+def generate_tile(formats):
+    src_A, _, _, _ = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=[32, 32],
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=[32, 32],
+        negative_values=True,
+    )
+    return src_A.flatten()
+
+
+@pytest.mark.quasar
+@parametrize(
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32, DataFormat.Int32],
+        same=True,
+    ),
+    dest_sync=[DestSync.Half, DestSync.Full],
+)
+def test_sfpu_fill_quasar(formats, dest_sync):
+    """Test SFPU fill on Quasar, every datum of the tile is overwritten."""
+    src_A = generate_tile(formats)
+
+    fill_value = (
+        FILL_VALUE_INT if formats.input_format.is_integer() else FILL_VALUE_FLOAT
+    )
+    golden_tensor = torch.full(
+        (TILE_ELEMENTS,), fill_value, dtype=format_dict[formats.output_format]
+    )
+
+    res_tensor = run_sfpu_unary_quasar(formats, "fill", src_A, dest_sync)
+
+    assert torch.equal(golden_tensor, res_tensor), "Assert against golden failed"
+
+
+@pytest.mark.quasar
+@parametrize(
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32],
+        same=True,
+    ),
+    sfpu_type=[
+        "equal_zero",
+        "not_equal_zero",
+        "less_than_zero",
+        "greater_than_equal_zero",
+        "less_than_equal_zero",
+        "greater_than_zero",
+    ],
+    dest_sync=[DestSync.Half, DestSync.Full],
+)
+def test_sfpu_zero_comp_quasar(formats, sfpu_type, dest_sync):
+    """Test SFPU comparisons with zero on Quasar, the result is 1.0 or 0.0."""
+    src_A = generate_tile(formats)
+    # Zero out about a quarter of the tile so the equal cases are hit
+    src_A = torch.where(
+        torch.rand(TILE_ELEMENTS) < 0.25, torch.zeros_like(src_A), src_A
+    )
+
+    ops = {
+        "equal_zero": lambda x: x == 0,
+        "not_equal_zero": lambda x: x != 0,
+        "less_than_zero": lambda x: x < 0,
+        "greater_than_equal_zero": lambda x: x >= 0,
+        "less_than_equal_zero": lambda x: x <= 0,
+        "greater_than_zero": lambda x: x > 0,
+    }
+    golden_tensor = ops[sfpu_type](src_A).to(format_dict[formats.output_format])
+
+    res_tensor = run_sfpu_unary_quasar(formats, sfpu_type, src_A, dest_sync)
+
+    assert torch.equal(golden_tensor, res_tensor), "Assert against golden failed"
+
+
+@pytest.mark.quasar
+@parametrize(
+    formats=[
+        InputOutputFormat(DataFormat.Float32, DataFormat.Float16_b),
+        InputOutputFormat(DataFormat.Int16, DataFormat.Int16),
+    ],
+    dest_sync=[DestSync.Half, DestSync.Full],
+)
+def test_sfpu_typecast_quasar(formats, dest_sync):
+    """
+    Test the SFPU typecasts on Quasar, bit exact.
+
+    Float32 -> Float16_b runs in a 32 bit dest. UInt16 is not a Quasar register
+    format, so UInt16 -> Float16_b stages values in [0, 32768) in an Int16 tile and
+    the Float16_b result bits are packed back out as Int16.
+    """
+    if formats.input_format == DataFormat.Int16:
+        src_A = torch.randint(0, 2**15, (TILE_ELEMENTS,), dtype=torch.int16)
+        golden_tensor = src_A.to(torch.bfloat16).view(torch.int16)
+    else:
+        src_A = generate_tile(formats)
+        golden_tensor = src_A.to(torch.bfloat16)
+
+    typecast = (
+        (DataFormat.UInt16, DataFormat.Float16_b)
+        if formats.input_format == DataFormat.Int16
+        else (DataFormat.Float32, DataFormat.Float16_b)
+    )
+    res_tensor = run_sfpu_unary_quasar(
+        formats, "typecast", src_A, dest_sync, typecast
+    )
+
+    if formats.input_format == DataFormat.Int16:
+        assert torch.equal(golden_tensor, res_tensor), "Assert against golden failed"
+    else:
+        assert passed_test(
+            golden_tensor, res_tensor, formats.output_format
+        ), "Assert against golden failed"
+
+
+def sign_magnitude_from_float32(tensor):
+    """Int32 values whose sign-magnitude encoding holds the bits of the floats."""
+    bits = tensor.to(torch.float32).view(torch.int32).to(torch.int64) & 0xFFFFFFFF
+    magnitude = bits & 0x7FFFFFFF
+    return torch.where(bits >= 2**31, -magnitude, magnitude).to(torch.int32)
+
+
+def float32_from_sign_magnitude(tensor):
+    """Inverse of sign_magnitude_from_float32."""
+    values = tensor.to(torch.int64)
+    bits = torch.where(values < 0, -values + 2**31, values)
+    return torch.where(bits >= 2**31, bits - 2**32, bits).to(torch.int32).view(
+        torch.float32
+    )
+
+
+def typecast_src_values(src_format):
+    """Source values of a typecast, spanning the range the conversion handles."""
+    iinfo = torch.iinfo(torch.int32)
+    if src_format == DataFormat.Float32:
+        # Magnitudes from 2^-4 to 2^33 cover fractions, rounding and saturation
+        magnitude = torch.exp2(torch.rand(TILE_ELEMENTS, dtype=torch.float64) * 37 - 4)
+        sign = torch.where(torch.rand(TILE_ELEMENTS) < 0.5, -1.0, 1.0)
+        values = (sign * magnitude).to(torch.float32)
+        # Ties have to round to even
+        values[::16] = torch.arange(TILE_ELEMENTS // 16, dtype=torch.float32) + 0.5
+        return values
+    if src_format == DataFormat.UInt16:
+        return torch.randint(0, 2**16, (TILE_ELEMENTS,), dtype=torch.int64)
+    # Sign-magnitude Int32 has no INT_MIN, every other tile keeps to the uint16 range
+    values = torch.randint(iinfo.min + 1, iinfo.max, (TILE_ELEMENTS,))
+    values[::2] = torch.randint(-(2**16), 2**17, (TILE_ELEMENTS // 2,))
+    return values
+
+
+def typecast_golden(src, dst_format):
+    """Typecast of the float64 or int64 source values, as float64 or int64."""
+    if dst_format == DataFormat.Int32:
+        # Truncates, saturating to +-INT_MAX
+        limit = 2**31 - 1
+        return torch.trunc(src.to(torch.float64)).clamp(-limit, limit).to(torch.int64)
+    if dst_format == DataFormat.UInt16:
+        # Integer sources go through fp32, ties round to even
+        rounded = torch.round(src.to(torch.float32).to(torch.float64))
+        return rounded.clamp(0, 2**16 - 1).to(torch.int64)
+    if dst_format == DataFormat.Float16_b:
+        return src.to(torch.float32).to(torch.bfloat16).to(torch.float64)
+    return src.to(torch.float32).to(torch.float64)
+
+
+@pytest.mark.quasar
+@parametrize(
+    formats=input_output_formats([DataFormat.Int32], same=True),
+    typecast=[
+        (DataFormat.Float32, DataFormat.Int32),
+        (DataFormat.Float32, DataFormat.UInt16),
+        (DataFormat.Int32, DataFormat.Float16_b),
+        (DataFormat.Int32, DataFormat.Float32),
+        (DataFormat.Int32, DataFormat.UInt16),
+        (DataFormat.UInt16, DataFormat.Float32),
+    ],
+    dest_sync=[DestSync.Half, DestSync.Full],
+)
+def test_sfpu_typecast_int32_dest_quasar(formats, typecast, dest_sync):
+    """
+    Test the SFPU typecasts between float and integer formats on Quasar, bit exact.
+
+    The kernels convert in place, so source and result share a 32 bit dest and both
+    go through L1 as raw Int32 bits: float bits are staged as the sign-magnitude
+    Int32 holding them and UInt16 values sit in the low 16 bits.
+    """
+    src_format, dst_format = typecast
+
+    src = typecast_src_values(src_format)
+    golden = typecast_golden(src, dst_format)
+    if src_format == DataFormat.Float32:
+        src_A = sign_magnitude_from_float32(src)
+    else:
+        src_A = src.to(torch.int32)
+
+    res_tensor = run_sfpu_unary_quasar(
+        formats, "typecast", src_A, dest_sync, typecast
+    )
+
+    if dst_format.is_integer():
+        res = res_tensor.to(torch.int64)
+    else:
+        res = float32_from_sign_magnitude(res_tensor).to(torch.float64)
+
+    assert torch.equal(golden, res), "Assert against golden failed"
+
+
+@pytest.mark.quasar
+@parametrize(
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32],
+        same=True,
+    ),
+    dest_sync=[DestSync.Half, DestSync.Full],
+)
+def test_sfpu_dropout_quasar(formats, dest_sync):
+    """
+    Test SFPU dropout on Quasar.
+
+    The mask comes from the hardware PRNG, so every datum is checked to be either
+    dropped or scaled and the drop rate is checked against the probability.
+    """
+    src_A = generate_tile(formats)
+    # A dropped datum is only recognisable as a zero if no input is zero
+    src_A = torch.where(src_A == 0, torch.ones_like(src_A), src_A)
+
+    res_tensor = run_sfpu_unary_quasar(formats, "dropout", src_A, dest_sync)
+
+    dropped = res_tensor == 0
+    kept = res_tensor[~dropped].to(torch.float32)
+    golden_kept = src_A[~dropped].to(torch.float32) * DROPOUT_SCALE
+    # Within the rounding of a Float16_b result
+    assert torch.allclose(
+        golden_kept, kept, rtol=1e-2, atol=0
+    ), "Kept datums are not scaled"
+
+    # The number of dropped datums is binomial
+    expected = TILE_ELEMENTS * DROPOUT_PROBABILITY
+    sigma = (expected * (1 - DROPOUT_PROBABILITY)) ** 0.5
+    assert (
+        abs(dropped.sum().item() - expected) <= 5 * sigma
+    ), f"Dropped {dropped.sum().item()} datums, expected about {expected:.0f}"
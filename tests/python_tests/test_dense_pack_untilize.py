@@ -1,8 +1,8 @@
 # SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
 # SPDX-License-Identifier: Apache-2.0
 
+import pytest
 import torch
-from conftest import skip_for_wormhole
 from helpers.format_config import DataFormat
 from helpers.llk_params import DestAccumulation, DestSync, format_dict
 from helpers.param_config import (
@@ -69,12 +69,12 @@ def print_stimuli_and_golden(src_A, golden, input_dimensions, r_dim):
         print(f"R{row}S{segment}\t", golden[i : i + 16])
 
 
-@skip_for_wormhole
 @parametrize(
-    formats=input_output_formats([DataFormat.Float16_b]),
-    dest_acc=[DestAccumulation.No],
+    formats=input_output_formats([DataFormat.Float16_b, DataFormat.Float32], same=True),
+    dest_acc=[DestAccumulation.No, DestAccumulation.Yes],
     input_dimensions=[[32, 32], [32, 64], [32, 128], [32, 256]],
     r_dim=[1, 2, 4, 8, 16],
+    dense_num_faces=[1, 2],
     dest_sync=[DestSync.Half],
 )
 def test_pack_untilize(
@@ -82,8 +82,15 @@ def test_pack_untilize(
     dest_acc,
     input_dimensions,
     r_dim,
+    dense_num_faces,
     dest_sync,
 ):
+    if formats.input_format == DataFormat.Float32 and dest_acc == DestAccumulation.No:
+        pytest.skip("Float32 data requires 32-bit dest")
+
+    # Half of a 32-bit dest only fits 4 32x32 tile regions
+    if dest_acc == DestAccumulation.Yes and input_dimensions[1] > 128:
+        pytest.skip("Block does not fit in a 32-bit dest section")
 
     src_A, tile_cnt_A, src_B, tile_cnt_B = generate_stimuli(
         stimuli_format_A=formats.input_format,
@@ -94,6 +101,7 @@ def test_pack_untilize(
     )
 
     # src_A = generate_specific_stimuli(input_dimensions, r_dim, formats.input_format)
+    # Dense 1 face and 2 face tiles both end up as one row of every face per output row
     golden_tensor = generate_golden_output(
         src_A, input_dimensions, r_dim, formats.input_format
     )
@@ -109,7 +117,10 @@ def test_pack_untilize(
             ),
             DEST_SYNC(dest_sync),
         ],
-        runtimes=[NUM_FACES(4), IN_TILE_DIMS(r_dim, 32, 32, 32)],
+        runtimes=[
+            NUM_FACES(4),
+            IN_TILE_DIMS(r_dim, dense_num_faces * 16, 32, 32),
+        ],
         variant_stimuli=StimuliConfig(
             src_A,
             formats.input_format,
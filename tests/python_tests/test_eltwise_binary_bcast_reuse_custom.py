@@ -0,0 +1,140 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+# Test for eltwise binary operations over a row of tiles that share one broadcast
+# operand, which is unpacked once per block instead of once per tile.
+
+from dataclasses import dataclass
+
+import torch
+from helpers.format_config import DataFormat
+from helpers.golden_generators import (
+    BroadcastGolden,
+    EltwiseBinaryGolden,
+    get_golden_generator,
+)
+from helpers.llk_params import (
+    BroadcastType,
+    DestAccumulation,
+    MathFidelity,
+    MathOperation,
+    format_dict,
+)
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import (
+    BROADCAST_TYPE,
+    MATH_FIDELITY,
+    MATH_OP,
+    TILE_COUNT,
+    TemplateParameter,
+    generate_input_dim,
+)
+from helpers.tilize_untilize import tilize_block, untilize_block
+from helpers.utils import passed_test
+
+
+@dataclass
+class CT_DIM(TemplateParameter):
+    ct_dim: int
+
+    def convert_to_cpp(self) -> str:
+        return f"constexpr std::uint32_t CT_DIM = {self.ct_dim};"
+
+
+@parametrize(
+    formats=input_output_formats([DataFormat.Float16_b, DataFormat.Bfp8_b]),
+    mathop=[MathOperation.Elwadd, MathOperation.Elwsub, MathOperation.Elwmul],
+    broadcast_type=[
+        BroadcastType.None_,
+        BroadcastType.Column,
+        BroadcastType.Row,
+        BroadcastType.Scalar,
+    ],
+    input_dimensions_A=[[32, 32], [32, 128], [32, 256]],
+)
+def test_eltwise_binary_bcast_reuse_custom(
+    formats, mathop, broadcast_type, input_dimensions_A
+):
+    input_dimensions_B = [32, 32]
+    ct_dim = input_dimensions_A[1] // 32
+
+    src_A, tile_cnt_A, src_B, tile_cnt_B = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_dimensions_A,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=input_dimensions_B,
+    )
+
+    src_A_tilized = tilize_block(
+        src_A, input_dimensions_A, formats.input_format
+    ).flatten()
+    src_B_tilized = tilize_block(
+        src_B, input_dimensions_B, formats.input_format
+    ).flatten()
+
+    if broadcast_type == BroadcastType.None_:
+        src_B_golden = src_B.flatten()
+    else:
+        broadcast_golden = get_golden_generator(BroadcastGolden)
+        src_B_broadcasted_tilized = broadcast_golden(
+            broadcast_type,
+            src_B_tilized,
+            formats.input_format,
+            num_faces=4,
+            tile_cnt=tile_cnt_B,
+            face_r_dim=16,
+        )
+        src_B_golden = untilize_block(
+            src_B_broadcasted_tilized, formats.input_format, input_dimensions_B
+        ).flatten()
+
+    # The same broadcast tile applies to every tile of the row
+    src_B_2d = src_B_golden.view(input_dimensions_B[0], input_dimensions_B[1])
+    src_B_expanded = src_B_2d.repeat(1, ct_dim).flatten()
+
+    generate_golden = get_golden_generator(EltwiseBinaryGolden)
+    golden_tensor = generate_golden(
+        mathop, src_A, src_B_expanded, formats.output_format, MathFidelity.LoFi
+    )
+
+    configuration = TestConfig(
+        "sources/eltwise_binary_bcast_reuse_custom_test.cpp",
+        formats,
+        templates=[
+            MATH_FIDELITY(MathFidelity.LoFi),
+            generate_input_dim(input_dimensions_A, input_dimensions_A),
+            MATH_OP(mathop=mathop),
+            BROADCAST_TYPE(broadcast_type),
+            CT_DIM(ct_dim),
+        ],
+        runtimes=[TILE_COUNT(tile_cnt_A)],
+        variant_stimuli=StimuliConfig(
+            src_A_tilized,
+            formats.input_format,
+            src_B_tilized,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=tile_cnt_A,
+        ),
+        dest_acc=DestAccumulation.No,
+    )
+    res_from_L1 = configuration.run().result
+
+    res_from_L1 = untilize_block(
+        res_from_L1, formats.output_format, input_dimensions_A
+    ).flatten()
+
+    assert len(res_from_L1) == len(
+        golden_tensor
+    ), "Result tensor and golden tensor are not of the same length"
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    assert passed_test(
+        golden_tensor, res_tensor, formats.output_format
+    ), "Assert against golden failed"
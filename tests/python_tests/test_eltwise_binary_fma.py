@@ -0,0 +1,85 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+# Test for the FPU fused multiply-add, Output = A * B + C, with C pre-loaded in dest.
+
+import pytest
+import torch
+from helpers.format_config import DataFormat
+from helpers.llk_params import DestAccumulation, MathFidelity, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import INPUT_TILE_CNT, MATH_FIDELITY
+from helpers.utils import passed_test
+
+
+@parametrize(
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Bfp8_b, DataFormat.Float32],
+        same=True,
+    ),
+    dest_acc=[DestAccumulation.No, DestAccumulation.Yes],
+    math_fidelity=[MathFidelity.LoFi, MathFidelity.HiFi2, MathFidelity.HiFi4],
+    input_dimensions=[[32, 32], [64, 64]],
+)
+def test_eltwise_binary_fma(formats, dest_acc, math_fidelity, input_dimensions):
+
+    if formats.input_format == DataFormat.Float32 and dest_acc == DestAccumulation.No:
+        pytest.skip("DataFormat.Float32 not supported with DestAccumulation.No")
+
+    src_A, tile_cnt_A, src_B, tile_cnt_B = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=input_dimensions,
+        sfpu=False,
+    )
+    src_C, tile_cnt_C, _, _ = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=input_dimensions,
+        sfpu=False,
+    )
+
+    # Elementwise, so the golden does not depend on the tile layout
+    torch_format = format_dict[formats.output_format]
+    golden_tensor = (
+        src_A.flatten().to(torch.float32) * src_B.flatten().to(torch.float32)
+        + src_C.flatten().to(torch.float32)
+    ).to(torch_format)
+
+    configuration = TestConfig(
+        "sources/eltwise_binary_fma_test.cpp",
+        formats,
+        templates=[MATH_FIDELITY(math_fidelity)],
+        runtimes=[INPUT_TILE_CNT(tile_cnt_A)],
+        variant_stimuli=StimuliConfig(
+            src_A.flatten(),
+            formats.input_format,
+            src_B.flatten(),
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=tile_cnt_A,
+            buffer_C=src_C.flatten(),
+            stimuli_C_format=formats.input_format,
+            tile_count_C=tile_cnt_C,
+        ),
+        dest_acc=dest_acc,
+    )
+
+    res_from_L1 = configuration.run().result
+
+    assert len(res_from_L1) == len(
+        golden_tensor
+    ), "Result tensor and golden tensor are not of the same length"
+
+    res_tensor = torch.tensor(res_from_L1, dtype=torch_format)
+
+    assert passed_test(
+        golden_tensor, res_tensor, formats.output_format
+    ), "Assert against golden failed"
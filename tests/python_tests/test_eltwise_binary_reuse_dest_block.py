@@ -0,0 +1,213 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+# Test for eltwise binary operations with reuse_dest over a whole block of tiles on
+# Wormhole and Blackhole, one block dest reuse call per accumulation step.
+
+import torch
+from helpers.format_config import DataFormat
+from helpers.llk_params import (
+    BlocksCalculationAlgorithm,
+    BroadcastType,
+    DestAccumulation,
+    DestSync,
+    EltwiseBinaryReuseDestType,
+    MathFidelity,
+    MathOperation,
+    Transpose,
+    format_dict,
+)
+from helpers.param_config import (
+    get_num_blocks_and_num_tiles_in_block,
+    input_output_formats,
+    parametrize,
+)
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import generate_stimuli_w_tile_dimensions
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import (
+    BROADCAST_TYPE,
+    DEST_SYNC,
+    EN_DEST_REUSE,
+    EN_DEST_REUSE_BLOCK,
+    MATH_FIDELITY,
+    MATH_OP,
+    NUM_BLOCKS,
+    NUM_FACES_C_DIM,
+    NUM_FACES_R_DIM,
+    NUM_TILES_IN_BLOCK,
+    REUSE_DEST_TYPE,
+    TEST_FACE_DIMS,
+    UNPACK_TRANS_FACES,
+    UNPACK_TRANS_WITHIN_FACE,
+)
+from helpers.tilize_untilize import tilize_block
+from helpers.utils import passed_test
+
+# Block dest reuse requires full 4-face tiles
+TILE_DIMENSIONS = [32, 32]
+
+
+@parametrize(
+    reuse_dest_type=[
+        EltwiseBinaryReuseDestType.DEST_TO_SRCA,
+        EltwiseBinaryReuseDestType.DEST_TO_SRCB,
+    ],
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32, DataFormat.Bfp8_b],
+        same=True,
+    ),
+    math_op=[MathOperation.Elwadd, MathOperation.Elwsub, MathOperation.Elwmul],
+    input_dimensions=[[512, 32], [256, 64]],
+    output_dimensions=[[128, 32], [128, 64]],
+)
+def test_eltwise_binary_reuse_dest_block(
+    reuse_dest_type,
+    formats,
+    math_op,
+    input_dimensions,
+    output_dimensions,
+):
+    tile_rows, tile_cols = TILE_DIMENSIONS
+    num_faces = 4
+    face_r_dim = 16
+
+    tile_cnt_input = (input_dimensions[0] // tile_rows) * (
+        input_dimensions[1] // tile_cols
+    )
+    tile_cnt_output = (output_dimensions[0] // tile_rows) * (
+        output_dimensions[1] // tile_cols
+    )
+
+    assert tile_cnt_input % tile_cnt_output == 0, (
+        f"Input tile count ({tile_cnt_input}) must be divisible by "
+        f"output tile count ({tile_cnt_output})"
+    )
+
+    src_A, _, src_B, _ = generate_stimuli_w_tile_dimensions(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=input_dimensions,
+        tile_dimensions=TILE_DIMENSIONS,
+    )
+
+    effective_dest_acc = (
+        DestAccumulation.Yes
+        if formats.output_format == DataFormat.Float32
+        else DestAccumulation.No
+    )
+    output_num_blocks, output_tiles_in_block = get_num_blocks_and_num_tiles_in_block(
+        DestSync.Half,
+        effective_dest_acc,
+        formats,
+        output_dimensions,
+        TILE_DIMENSIONS,
+        BlocksCalculationAlgorithm.Standard,
+    )
+
+    # Every accumulation step unpacks one input tile per output tile of the block
+    inner_dim = tile_cnt_input // tile_cnt_output
+    input_tiles_in_block = inner_dim * output_tiles_in_block
+
+    src_A_tilized = tilize_block(
+        src_A, dimensions=input_dimensions, stimuli_format=formats.input_format
+    ).flatten()
+    src_B_tilized = tilize_block(
+        src_B, dimensions=input_dimensions, stimuli_format=formats.input_format
+    ).flatten()
+
+    # Golden: same dest reuse semantics as the per tile API
+    # ELWADD/ELWSUB: new_dest = srcA op srcB, ELWMUL: new_dest = old_dest + srcA * srcB
+    tile_elements = tile_rows * tile_cols
+    torch_format = format_dict[formats.output_format]
+    golden_tensor = torch.zeros(tile_cnt_output * tile_elements, dtype=torch_format)
+
+    for out_t in range(tile_cnt_output):
+        block_idx = out_t // output_tiles_in_block
+        tile_in_block = out_t % output_tiles_in_block
+        dest = torch.zeros(tile_elements, dtype=torch_format)
+
+        for i in range(inner_dim):
+            input_tile_idx = (
+                block_idx * input_tiles_in_block
+                + i * output_tiles_in_block
+                + tile_in_block
+            )
+            start = input_tile_idx * tile_elements
+            a_tile = src_A_tilized[start : start + tile_elements].to(torch_format)
+            b_tile = src_B_tilized[start : start + tile_elements].to(torch_format)
+
+            if reuse_dest_type == EltwiseBinaryReuseDestType.DEST_TO_SRCA:
+                srcA, srcB = dest.clone(), b_tile
+            else:
+                srcA, srcB = a_tile, dest.clone()
+
+            if math_op == MathOperation.Elwadd:
+                dest = srcA + srcB
+            elif math_op == MathOperation.Elwsub:
+                dest = srcA - srcB
+            else:
+                dest = dest + srcA * srcB
+
+        out_start = out_t * tile_elements
+        golden_tensor[out_start : out_start + tile_elements] = dest
+
+    configuration = TestConfig(
+        "sources/eltwise_binary_test.cpp",
+        formats,
+        templates=[
+            MATH_FIDELITY(MathFidelity.LoFi),
+            BROADCAST_TYPE(BroadcastType.None_),
+            MATH_OP(mathop=math_op),
+            DEST_SYNC(),
+            EN_DEST_REUSE(),
+            EN_DEST_REUSE_BLOCK(),
+            REUSE_DEST_TYPE(reuse_dest_type=reuse_dest_type),
+        ],
+        runtimes=[
+            UNPACK_TRANS_FACES(Transpose.No),
+            UNPACK_TRANS_WITHIN_FACE(Transpose.No),
+            NUM_TILES_IN_BLOCK(
+                output_tiles_in_block,
+                input_num_tiles_in_block=input_tiles_in_block,
+                output_num_tiles_in_block=output_tiles_in_block,
+            ),
+            NUM_BLOCKS(
+                output_num_blocks,
+                input_num_blocks=output_num_blocks,
+                output_num_blocks=output_num_blocks,
+            ),
+            NUM_FACES_R_DIM(2),
+            NUM_FACES_C_DIM(2),
+            TEST_FACE_DIMS(face_r_dim=face_r_dim),
+        ],
+        variant_stimuli=StimuliConfig(
+            src_A_tilized,
+            formats.input_format,
+            src_B_tilized,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_input,
+            tile_count_B=tile_cnt_input,
+            tile_count_res=tile_cnt_output,
+            num_faces=num_faces,
+            face_r_dim=face_r_dim,
+            tile_dimensions=TILE_DIMENSIONS,
+            use_dense_tile_dimensions=True,
+        ),
+        dest_acc=DestAccumulation.No,
+        unpack_to_dest=False,
+    )
+
+    res_from_L1 = configuration.run().result
+
+    assert len(res_from_L1) == len(
+        golden_tensor
+    ), "Result tensor and golden tensor are not of the same length"
+
+    res_tensor = torch.tensor(res_from_L1, dtype=torch_format)
+
+    assert passed_test(
+        golden_tensor, res_tensor, formats.output_format
+    ), "Assert against golden failed"
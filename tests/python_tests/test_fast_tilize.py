@@ -3,7 +3,6 @@
 
 import pytest
 import torch
-from conftest import skip_for_blackhole
 from helpers.format_config import DataFormat
 from helpers.golden_generators import TilizeGolden, get_golden_generator
 from helpers.llk_params import DestAccumulation, format_dict
@@ -53,10 +52,14 @@ def generate_input_dimensions(max_size: int) -> list[tuple[int, int]]:
     return dimensions
 
 
-@skip_for_blackhole
 @parametrize(
     formats=input_output_formats(
-        [DataFormat.Float32, DataFormat.Float16_b, DataFormat.Bfp8_b]
+        [
+            DataFormat.Float32,
+            DataFormat.Float16_b,
+            DataFormat.Bfp8_b,
+            DataFormat.Bfp4_b,
+        ]
     ),
     dest_acc=[DestAccumulation.Yes, DestAccumulation.No],
     dimensions=generate_input_dimensions(25),
@@ -69,8 +72,8 @@ def test_fast_tilize(
 
     input_height, input_width = dimensions
 
-    if formats.input == DataFormat.Bfp8_b:
-        pytest.skip("Bfp8_b input format is not supported for fast tilize")
+    if formats.input in (DataFormat.Bfp8_b, DataFormat.Bfp4_b):
+        pytest.skip("Block float input formats are not supported for fast tilize")
 
     input_dimensions = [input_height * 32, input_width * 32]
 
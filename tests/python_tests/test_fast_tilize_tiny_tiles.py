@@ -3,7 +3,6 @@
 
 import pytest
 import torch
-from conftest import skip_for_blackhole
 from helpers.format_config import DataFormat
 from helpers.llk_params import DestAccumulation, format_dict, format_tile_sizes
 from helpers.param_config import input_output_formats, parametrize
@@ -33,7 +32,6 @@ WIDTHS = [
 ]  # base case, two banks, three banks, and Deepseek model sizes
 
 
-@skip_for_blackhole
 @parametrize(
     formats=input_output_formats([DataFormat.Float32, DataFormat.Float16_b]),
     dest_acc=[DestAccumulation.Yes, DestAccumulation.No],
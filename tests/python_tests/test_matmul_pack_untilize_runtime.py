@@ -0,0 +1,115 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import torch
+from helpers.format_config import DataFormat
+from helpers.golden_generators import MatmulGolden, get_golden_generator
+from helpers.llk_params import DestAccumulation, MathFidelity, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import (
+    CRK_TILE_DIMM,
+    MATH_FIDELITY,
+    generate_input_dim,
+)
+from helpers.tilize_untilize import tilize_block
+from helpers.utils import passed_test
+
+
+@parametrize(
+    formats=input_output_formats(
+        [
+            DataFormat.Float16_b,
+            DataFormat.Float16,
+            DataFormat.Float32,
+        ]
+    ),
+    dest_acc=[DestAccumulation.Yes, DestAccumulation.No],
+    math_fidelity=[MathFidelity.LoFi, MathFidelity.HiFi4],
+    rt_dim=[1, 2],
+    kt_dim=[1, 2],
+    # Widths that are not a multiple of the block width exercise the narrower tail block
+    ct_dim=[1, 3, 5, 8, 11],
+    block_ct_dim=[1, 2, 4],
+)
+def test_matmul_pack_untilize_runtime(
+    formats,
+    dest_acc,
+    math_fidelity,
+    rt_dim,
+    kt_dim,
+    ct_dim,
+    block_ct_dim,
+):
+    if block_ct_dim > ct_dim:
+        pytest.skip("block_ct_dim must not exceed the row band width")
+
+    torch_format = format_dict[formats.output_format]
+
+    input_A_dimensions = [rt_dim * 32, kt_dim * 32]
+    input_B_dimensions = [kt_dim * 32, ct_dim * 32]
+
+    src_A, tile_cnt_A, src_B, tile_cnt_B = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_A_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=input_B_dimensions,
+        sfpu=False,
+    )
+
+    # Output is packed untilized, so the golden stays in row-major order
+    generate_golden = get_golden_generator(MatmulGolden)
+    golden_tensor = generate_golden(
+        src_A,
+        src_B,
+        formats.output_format,
+        math_fidelity,
+        input_A_dimensions=input_A_dimensions,
+        input_B_dimensions=input_B_dimensions,
+        input_A_format=formats.input_format,
+        input_B_format=formats.input_format,
+    )
+
+    tilized_A = tilize_block(
+        src_A, dimensions=input_A_dimensions, stimuli_format=formats.input_format
+    )
+    tilized_B = tilize_block(
+        src_B, dimensions=input_B_dimensions, stimuli_format=formats.input_format
+    )
+
+    configuration = TestConfig(
+        "sources/matmul_pack_untilize_runtime_test.cpp",
+        formats,
+        templates=[MATH_FIDELITY(math_fidelity)],
+        runtimes=[
+            generate_input_dim(
+                input_A_dimensions, input_B_dimensions, block_ct_dim=block_ct_dim
+            ),
+            CRK_TILE_DIMM(ct_dim, rt_dim, kt_dim),
+        ],
+        variant_stimuli=StimuliConfig(
+            tilized_A.flatten(),
+            formats.input_format,
+            tilized_B.flatten(),
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=rt_dim * ct_dim,
+        ),
+        dest_acc=dest_acc,
+    )
+
+    res_from_L1 = configuration.run().result
+    assert len(res_from_L1) == len(
+        golden_tensor
+    ), "Result tensor and golden tensor are not of the same length"
+
+    res_tensor = torch.tensor(res_from_L1, dtype=(torch_format))
+
+    assert passed_test(
+        golden_tensor, res_tensor, formats.output_format
+    ), "Assert against golden failed"
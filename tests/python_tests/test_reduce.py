@@ -5,7 +5,7 @@ import math
 
 import pytest
 import torch
-from helpers.format_config import DataFormat, is_dest_acc_needed
+from helpers.format_config import DataFormat, InputOutputFormat, is_dest_acc_needed
 from helpers.golden_generators import ReduceGolden, get_golden_generator
 from helpers.llk_params import (
     BlocksCalculationAlgorithm,
@@ -28,6 +28,7 @@ from helpers.test_config import TestConfig
 from helpers.test_variant_parameters import (
     IN_FACE_DIMS,
     INPUT_TILE_CNT,
+    INT_FPU,
     MATH_FIDELITY,
     MATH_OP,
     NUM_FACES_C_DIM,
@@ -150,6 +151,7 @@ def test_reduce(
         templates=[
             MATH_OP(mathop=mathop_mapping[reduce_dim], pool_type=pool_type),
             MATH_FIDELITY(math_fidelity),
+            INT_FPU(False),
         ],
         runtimes=[
             IN_FACE_DIMS(
@@ -320,6 +322,7 @@ def test_reduce_bfp4_b(
         templates=[
             MATH_OP(mathop=mathop_mapping[reduce_dim], pool_type=pool_type),
             MATH_FIDELITY(math_fidelity),
+            INT_FPU(False),
         ],
         runtimes=[
             IN_FACE_DIMS(
@@ -383,3 +386,108 @@ def test_reduce_bfp4_b(
             formats.output_format,
             tile_shape=tile_shape,
         ), "Assert against golden failed"
+
+
+@parametrize(
+    formats=[
+        InputOutputFormat(DataFormat.Int8, DataFormat.Int8),
+        InputOutputFormat(DataFormat.Int8, DataFormat.Int32),
+    ],
+    reduce_dim=[ReduceDimension.Row, ReduceDimension.Column, ReduceDimension.Scalar],
+    pool_type=[ReducePool.Max, ReducePool.Min, ReducePool.Sum],
+    math_fidelity=[MathFidelity.LoFi, MathFidelity.HiFi2, MathFidelity.HiFi4],
+)
+def test_reduce_int(formats, reduce_dim, pool_type, math_fidelity):
+
+    if pool_type == ReducePool.Sum and math_fidelity == MathFidelity.LoFi:
+        pytest.skip("Integer sum needs HiFi2 or higher to multiply all srcA bits")
+
+    if pool_type == ReducePool.Sum and formats.output_format == DataFormat.Int8:
+        pytest.skip("Sum of a tile does not fit the int8 output")
+
+    tile_dimensions = [32, 32]
+    tile_shape = construct_tile_shape(tile_dimensions)
+    input_dimensions = [128, 32]
+
+    src_A, tile_cnt_A, src_B, tile_cnt_B = generate_stimuli_w_tile_dimensions(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=tile_dimensions,
+        tile_dimensions=tile_dimensions,
+        negative_values=True,
+    )
+
+    # Use the full sign-magnitude int8 range so row and scalar sums overflow int8
+    src_A = torch.randint(-127, 128, src_A.shape, dtype=src_A.dtype)
+    # MIN pools the max of the negated tile, the result is negated back in dest
+    scaler = -1 if pool_type == ReducePool.Min else 1
+    src_B = torch.full((tile_shape.total_tile_size(),), scaler)
+
+    generate_golden = get_golden_generator(ReduceGolden)
+    golden_tensor = generate_golden(
+        src_A,
+        reduce_dim,
+        pool_type,
+        formats.output_format,
+        tile_cnt_A,
+        tile_shape=tile_shape,
+    )
+
+    _, num_tiles_in_block = get_num_blocks_and_num_tiles_in_block(
+        DestSync.Half,
+        DestAccumulation.Yes,
+        formats,
+        input_dimensions,
+        tile_dimensions,
+        BlocksCalculationAlgorithm.Standard,
+    )
+
+    configuration = TestConfig(
+        "sources/reduce_test.cpp",
+        formats,
+        templates=[
+            MATH_OP(mathop=mathop_mapping[reduce_dim], pool_type=pool_type),
+            MATH_FIDELITY(math_fidelity),
+            INT_FPU(True),
+        ],
+        runtimes=[
+            IN_FACE_DIMS(
+                tile_shape.face_r_dim,
+                tile_shape.face_c_dim,
+                tile_shape.face_r_dim,
+                tile_shape.face_c_dim,
+            ),
+            INPUT_TILE_CNT(tile_cnt_A),
+            OUTPUT_TILE_CNT(tile_cnt_A),
+            NUM_TILES_IN_BLOCK(num_tiles_in_block),
+            REDUCE_TO_ONE(False),
+            NUM_FACES_R_DIM(tile_shape.num_faces_r_dim),
+            NUM_FACES_C_DIM(tile_shape.num_faces_c_dim),
+        ],
+        variant_stimuli=StimuliConfig(
+            src_A,
+            formats.input_format,
+            src_B,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=tile_cnt_A,
+            num_faces=tile_shape.total_num_faces(),
+            face_r_dim=tile_shape.face_r_dim,
+            tile_dimensions=tile_dimensions,
+            use_dense_tile_dimensions=True,
+        ),
+        dest_acc=DestAccumulation.Yes,  # Int8 inputs are accumulated in int32 dest
+    )
+
+    res_from_L1 = configuration.run().result
+
+    assert len(res_from_L1) == len(
+        golden_tensor
+    ), "Result tensor and golden tensor are not of the same length"
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    assert torch.equal(golden_tensor, res_tensor), "Assert against golden failed"
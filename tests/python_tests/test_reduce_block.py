@@ -0,0 +1,138 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import math
+
+import pytest
+import torch
+from helpers.format_config import DataFormat, is_dest_acc_needed
+from helpers.golden_generators import ReduceGolden, get_golden_generator
+from helpers.llk_params import (
+    DestAccumulation,
+    MathFidelity,
+    MathOperation,
+    ReduceDimension,
+    ReducePool,
+    format_dict,
+)
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import generate_stimuli_w_tile_dimensions
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import (
+    INPUT_TILE_CNT,
+    MATH_FIDELITY,
+    MATH_OP,
+    REDUCE_PER_TILE,
+)
+from helpers.utils import passed_test, tolerances
+
+mathop_mapping = {
+    ReduceDimension.Row: MathOperation.ReduceRow,
+    ReduceDimension.Column: MathOperation.ReduceColumn,
+    ReduceDimension.Scalar: MathOperation.ReduceScalar,
+}
+
+
+@parametrize(
+    formats=input_output_formats(
+        [
+            DataFormat.Float32,
+            DataFormat.Float16_b,
+            DataFormat.Bfp8_b,
+        ],
+        same=True,
+    ),
+    reduce_dim=[ReduceDimension.Row, ReduceDimension.Column, ReduceDimension.Scalar],
+    pool_type=[ReducePool.Max, ReducePool.Average, ReducePool.Sum],
+    math_fidelity=[MathFidelity.LoFi, MathFidelity.HiFi4],
+    block_ct_dim=[1, 2, 4, 8],
+    per_tile=[False, True],
+)
+def test_reduce_block(
+    formats, reduce_dim, pool_type, math_fidelity, block_ct_dim, per_tile
+):
+
+    if (formats.input_format in [DataFormat.Float16_b, DataFormat.Float32]) and (
+        math_fidelity == MathFidelity.LoFi
+    ):
+        pytest.skip("LoFi fails in these cases for reduce")
+
+    # The block is reduced like the reduce to one case of the single tile reduce, with
+    # per_tile the single tile reduce transposes the row result only after the last tile
+    input_dimensions = [32 * block_ct_dim, 32]
+
+    src_A, tile_cnt_A, src_B, tile_cnt_B = generate_stimuli_w_tile_dimensions(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=[32, 32],
+        tile_dimensions=[32, 32],
+    )
+
+    if pool_type in [ReducePool.Max, ReducePool.Sum]:
+        src_B = torch.full((1024,), 1)
+    elif reduce_dim == ReduceDimension.Scalar:
+        src_B = torch.full((1024,), 1 / math.sqrt(32 * 32))
+    else:
+        src_B = torch.full((1024,), 1 / 32)
+
+    generate_golden = get_golden_generator(ReduceGolden)
+    golden_tensor = generate_golden(
+        src_A,
+        reduce_dim,
+        pool_type,
+        formats.output_format,
+        tile_cnt_A,
+        reduce_to_one=True,
+    )
+
+    dest_acc = (
+        DestAccumulation.Yes
+        if (formats.input_format.is_32_bit() or is_dest_acc_needed(formats))
+        else DestAccumulation.No
+    )
+
+    configuration = TestConfig(
+        "sources/reduce_block_test.cpp",
+        formats,
+        templates=[
+            MATH_OP(mathop=mathop_mapping[reduce_dim], pool_type=pool_type),
+            MATH_FIDELITY(math_fidelity),
+            REDUCE_PER_TILE(per_tile),
+        ],
+        runtimes=[INPUT_TILE_CNT(tile_cnt_A)],
+        variant_stimuli=StimuliConfig(
+            src_A,
+            formats.input_format,
+            src_B,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=1,
+        ),
+        dest_acc=dest_acc,
+    )
+
+    res_from_L1 = configuration.run().result
+
+    assert len(res_from_L1) == len(
+        golden_tensor
+    ), "Result tensor and golden tensor are not of the same length"
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    # Same tolerances as the reduce to one case of the single tile reduce
+    assert passed_test(
+        golden_tensor,
+        res_tensor,
+        formats.output_format,
+        custom_pcc_threshold=(
+            0.90
+            if formats.output_format is not DataFormat.Bfp8_b
+            else pow(0.99, tile_cnt_A)
+        ),
+        custom_atol=tolerances[formats.output_format].atol * tile_cnt_A,
+        custom_rtol=tolerances[formats.output_format].rtol * tile_cnt_A,
+    ), "Assert against golden failed"
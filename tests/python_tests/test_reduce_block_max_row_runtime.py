@@ -0,0 +1,152 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import torch
+from helpers.format_config import DataFormat
+from helpers.golden_generators import (
+    ReduceGapoolGolden,
+    ReduceGolden,
+    get_golden_generator,
+)
+from helpers.llk_params import (
+    DestAccumulation,
+    MathFidelity,
+    PerfReinitType,
+    ReduceDimension,
+    ReducePool,
+    format_dict,
+)
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import (
+    PERF_REINIT_TYPE,
+    REDUCE_POOL_TYPE,
+    generate_input_dim,
+)
+from helpers.utils import passed_test, tolerances
+
+TILE_ELEMENTS = 1024
+NUM_BLOCKS = 4
+
+
+@parametrize(
+    formats=input_output_formats(
+        [DataFormat.Float16_b],  # Only Float16_b is supported for the block reduce
+        same=True,
+    ),
+    dest_acc=[DestAccumulation.No, DestAccumulation.Yes],
+    reduce_pool=[ReducePool.Max, ReducePool.Sum, ReducePool.Average],
+    reinit_type=[
+        PerfReinitType.NONE,
+        PerfReinitType.MINIMAL,
+        PerfReinitType.SHORT,
+        PerfReinitType.FULL,
+    ],
+    block_ct_dim=[1, 2, 4, 8],
+)
+def test_reduce_block_max_row_runtime(
+    formats, dest_acc, reduce_pool, reinit_type, block_ct_dim
+):
+    """
+    Every row band of block_ct_dim tiles is reduced into one tile by the runtime
+    block max row reduce used in SDPA. Between blocks the kernel clobbers the state
+    reinit_type has to restore, so each reinit is checked against the golden too.
+    """
+
+    input_dimensions = [32 * NUM_BLOCKS, 32 * block_ct_dim]
+
+    src_A, tile_cnt_A, _, tile_cnt_B = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=[32, 32],
+    )
+
+    # 1/32 keeps the scaler exact in the single LoFi phase of the SUM/AVG pool
+    scaler = 1 / 32 if reduce_pool == ReducePool.Average else 1
+    src_B = torch.full(
+        (TILE_ELEMENTS,), scaler, dtype=format_dict[formats.input_format]
+    )
+
+    block_size = block_ct_dim * TILE_ELEMENTS
+    blocks = [
+        src_A[block * block_size : (block + 1) * block_size]
+        for block in range(NUM_BLOCKS)
+    ]
+
+    if reduce_pool == ReducePool.Max:
+        generate_golden = get_golden_generator(ReduceGolden)
+        golden_tensor = torch.cat(
+            [
+                generate_golden(
+                    block,
+                    ReduceDimension.Row,
+                    reduce_pool,
+                    formats.output_format,
+                    block_ct_dim,
+                    reduce_to_one=True,
+                )
+                for block in blocks
+            ]
+        )
+    else:
+        # GAPOOL drops the low srcA mantissa bits in LoFi, the block adds up in dest
+        generate_golden = get_golden_generator(ReduceGapoolGolden)
+        golden_tensor = torch.cat(
+            [
+                generate_golden(
+                    block,
+                    src_B,
+                    formats.output_format,
+                    ReduceDimension.Row,
+                    MathFidelity.LoFi,
+                    block_ct_dim,
+                )
+                .to(torch.float32)
+                .view(block_ct_dim, TILE_ELEMENTS)
+                .sum(dim=0)
+                .to(format_dict[formats.output_format])
+                for block in blocks
+            ]
+        )
+
+    configuration = TestConfig(
+        "sources/reduce_block_max_row_runtime_test.cpp",
+        formats,
+        templates=[
+            REDUCE_POOL_TYPE(reduce_pool),
+            PERF_REINIT_TYPE(reinit_type),
+        ],
+        runtimes=[generate_input_dim(input_dimensions, input_dimensions)],
+        variant_stimuli=StimuliConfig(
+            src_A,
+            formats.input_format,
+            src_B,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=NUM_BLOCKS,
+        ),
+        unpack_to_dest=False,
+        dest_acc=dest_acc,
+    )
+
+    res_from_L1 = configuration.run().result
+
+    assert len(res_from_L1) == len(
+        golden_tensor
+    ), "Result tensor and golden tensor are not of the same length"
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    # Tolerances grow with the tiles pooled into every result, like test_reduce_block
+    assert passed_test(
+        golden_tensor,
+        res_tensor,
+        formats.output_format,
+        custom_atol=tolerances[formats.output_format].atol * block_ct_dim,
+        custom_rtol=tolerances[formats.output_format].rtol * block_ct_dim,
+    ), "Assert against golden failed"
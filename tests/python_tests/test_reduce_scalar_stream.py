@@ -0,0 +1,110 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import torch
+from helpers.format_config import DataFormat
+from helpers.golden_generators import ReduceGolden, get_golden_generator
+from helpers.llk_params import (
+    DestAccumulation,
+    MathFidelity,
+    MathOperation,
+    ReduceDimension,
+    ReducePool,
+    format_dict,
+)
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import generate_stimuli_w_tile_dimensions
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import (
+    INPUT_TILE_CNT,
+    MATH_FIDELITY,
+    MATH_OP,
+    REDUCE_COMPENSATED,
+)
+from helpers.utils import passed_test, tolerances
+
+
+@parametrize(
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32],
+        same=True,
+    ),
+    pool_type=[ReducePool.Max, ReducePool.Average, ReducePool.Sum],
+    compensated=[False, True],
+    num_tiles=[1, 4, 16],
+)
+def test_reduce_scalar_stream(formats, pool_type, compensated, num_tiles):
+
+    if compensated and pool_type == ReducePool.Max:
+        pytest.skip("Compensation only applies to Sum and Average")
+
+    dest_acc = (
+        DestAccumulation.Yes
+        if formats.input_format == DataFormat.Float32
+        else DestAccumulation.No
+    )
+
+    src_A, tile_cnt_A, src_B, tile_cnt_B = generate_stimuli_w_tile_dimensions(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=[32 * num_tiles, 32],
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=[32, 32],
+        tile_dimensions=[32, 32],
+    )
+
+    if pool_type == ReducePool.Average:
+        src_B = torch.full((1024,), 1 / 32)
+    else:
+        src_B = torch.full((1024,), 1)
+
+    generate_golden = get_golden_generator(ReduceGolden)
+    golden_tensor = generate_golden(
+        src_A,
+        ReduceDimension.Scalar,
+        pool_type,
+        formats.output_format,
+        tile_cnt_A,
+        reduce_to_one=True,
+    )
+
+    configuration = TestConfig(
+        "sources/reduce_scalar_stream_test.cpp",
+        formats,
+        templates=[
+            MATH_OP(mathop=MathOperation.ReduceScalar, pool_type=pool_type),
+            MATH_FIDELITY(MathFidelity.HiFi4),
+            REDUCE_COMPENSATED(compensated),
+        ],
+        runtimes=[INPUT_TILE_CNT(tile_cnt_A)],
+        variant_stimuli=StimuliConfig(
+            src_A,
+            formats.input_format,
+            src_B,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=1,
+        ),
+        dest_acc=dest_acc,
+    )
+
+    res_from_L1 = configuration.run().result
+
+    assert len(res_from_L1) == len(
+        golden_tensor
+    ), "Result tensor and golden tensor are not of the same length"
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    # Same tolerances as the reduce to one case of the single tile reduce
+    assert passed_test(
+        golden_tensor,
+        res_tensor,
+        formats.output_format,
+        custom_pcc_threshold=0.90,
+        custom_atol=tolerances[formats.output_format].atol * tile_cnt_A,
+        custom_rtol=tolerances[formats.output_format].rtol * tile_cnt_A,
+    ), "Assert against golden failed"
@@ -0,0 +1,92 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import torch
+from helpers.format_config import DataFormat
+from helpers.llk_params import DestAccumulation, ReducePool, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import INPUT_DIMENSIONS, REDUCE_POOL_TYPE
+from helpers.tilize_untilize import tilize_block, untilize_block
+from helpers.utils import passed_test
+
+
+@parametrize(
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32],
+        same=True,
+    ),
+    pool_type=[ReducePool.Max, ReducePool.Min],
+    num_tiles=[1, 2, 4],
+    chunked=[False, True],
+)
+def test_sfpu_argmax_row(formats, pool_type, num_tiles, chunked):
+
+    # Indices are int32 with fp32 dest and uint16 with 16-bit dest
+    if formats.input_format == DataFormat.Float32:
+        dest_acc = DestAccumulation.Yes
+        index_dtype = torch.int32
+    else:
+        dest_acc = DestAccumulation.No
+        index_dtype = torch.uint16
+
+    if dest_acc == DestAccumulation.Yes and num_tiles + 2 > 4:
+        pytest.skip("Row band and result tiles have to fit in half of the fp32 dest")
+
+    input_dimensions = [32, 32 * num_tiles]
+    block_ct_dim = 1 if chunked else num_tiles
+
+    src_A, tile_cnt_A, src_B, tile_cnt_B = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=input_dimensions,
+    )
+
+    rows = src_A.view(input_dimensions).to(torch.float32)
+    if pool_type == ReducePool.Max:
+        golden_values, golden_indices = torch.max(rows, dim=1)
+    else:
+        golden_values, golden_indices = torch.min(rows, dim=1)
+    golden_values = golden_values.to(format_dict[formats.output_format])
+
+    src_A = tilize_block(
+        src_A, input_dimensions, stimuli_format=formats.input_format
+    ).flatten()
+
+    configuration = TestConfig(
+        "sources/sfpu_argmax_row_test.cpp",
+        formats,
+        templates=[REDUCE_POOL_TYPE(pool_type)],
+        runtimes=[INPUT_DIMENSIONS(1, num_tiles, block_ct_dim, 1)],
+        variant_stimuli=StimuliConfig(
+            src_A,
+            formats.input_format,
+            src_B,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=2,
+        ),
+        unpack_to_dest=False,  # Must be False since math kernel does A2D copy
+        dest_acc=dest_acc,
+    )
+    res_from_L1 = configuration.run().result
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+    tile_size = res_tensor.numel() // 2
+    values = untilize_block(res_tensor[:tile_size], formats.output_format, [32, 32])
+    indices = untilize_block(res_tensor[tile_size:], formats.output_format, [32, 32])
+
+    # The result of every row is in column 0
+    res_values = values.view(32, 32)[:, 0].contiguous()
+    res_indices = indices.view(32, 32)[:, 0].contiguous().view(index_dtype)
+
+    assert torch.equal(
+        res_indices.to(torch.int64), golden_indices
+    ), f"Index mismatch: {res_indices.tolist()} != {golden_indices.tolist()}"
+    assert passed_test(golden_values, res_values, formats.output_format)
@@ -0,0 +1,100 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import torch
+from helpers.format_config import DataFormat
+from helpers.llk_params import CumulativeOp, DestAccumulation, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import CUMULATIVE_OP, INPUT_DIMENSIONS
+from helpers.tilize_untilize import tilize_block, untilize_block
+from helpers.utils import passed_test
+
+
+def cumulative_golden(rows: torch.Tensor, op: CumulativeOp) -> torch.Tensor:
+    if op == CumulativeOp.Sum:
+        return torch.cumsum(rows, dim=1)
+    if op == CumulativeOp.Prod:
+        return torch.cumprod(rows, dim=1)
+    return torch.cummax(rows, dim=1).values
+
+
+@parametrize(
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32],
+        same=True,
+    ),
+    op=[CumulativeOp.Sum, CumulativeOp.Prod, CumulativeOp.Max],
+    num_tiles=[1, 2, 4],
+    chunked=[False, True],
+)
+def test_sfpu_cumulative_row(formats, op, num_tiles, chunked):
+
+    if formats.input_format == DataFormat.Float32:
+        dest_acc = DestAccumulation.Yes
+    else:
+        dest_acc = DestAccumulation.No
+
+    if dest_acc == DestAccumulation.Yes and num_tiles + 1 > 4:
+        pytest.skip("Row band and carry tiles have to fit in half of the fp32 dest")
+
+    input_dimensions = [32, 32 * num_tiles]
+    block_ct_dim = 1 if chunked else num_tiles
+
+    src_A, tile_cnt_A, src_B, tile_cnt_B = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=input_dimensions,
+    )
+
+    # Keep long products in range, factors close to 1
+    torch_format = format_dict[formats.input_format]
+    if op == CumulativeOp.Prod:
+        rows = 1.0 + (torch.rand(input_dimensions) - 0.5) * 0.05
+    else:
+        rows = torch.rand(input_dimensions) * 2.0 - 1.0
+    rows = rows.to(torch_format)
+
+    golden_tensor = cumulative_golden(rows.to(torch.float32), op)
+    golden_tensor = golden_tensor.to(format_dict[formats.output_format])
+
+    src_A = tilize_block(
+        rows, input_dimensions, stimuli_format=formats.input_format
+    ).flatten()
+
+    configuration = TestConfig(
+        "sources/sfpu_cumulative_row_test.cpp",
+        formats,
+        templates=[CUMULATIVE_OP(op)],
+        runtimes=[INPUT_DIMENSIONS(1, num_tiles, block_ct_dim, 1)],
+        variant_stimuli=StimuliConfig(
+            src_A,
+            formats.input_format,
+            src_B,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=tile_cnt_A,
+        ),
+        unpack_to_dest=False,  # Must be False since math kernel does A2D copy
+        dest_acc=dest_acc,
+    )
+    res_from_L1 = configuration.run().result
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+    res_tensor = untilize_block(res_tensor, formats.output_format, input_dimensions)
+
+    # Lane-parallel scan order differs from the sequential torch scan, and the carry
+    # between chunks is rounded to the dest format
+    assert passed_test(
+        golden_tensor,
+        res_tensor.view(input_dimensions),
+        formats.output_format,
+        custom_atol=0.05,
+        custom_rtol=0.02,
+    )
@@ -0,0 +1,127 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import torch
+from helpers.format_config import DataFormat
+from helpers.llk_params import DestAccumulation, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import DROPOUT, TILE_COUNT
+from helpers.tilize_untilize import tilize_block
+from helpers.utils import passed_test
+
+THREEFRY_MASK = 0xFFFFFFFF
+THREEFRY_ROTATIONS = [13, 15, 26, 6, 17, 29, 16, 24]
+
+
+def threefry2x32(x0, x1, seed, stream=0, rounds=20):
+    """Threefry-2x32 on int64 tensors holding uint32 values, like the SFPU kernel."""
+    key = [seed, stream, 0x1BD11BDA ^ seed ^ stream]
+    x0 = (x0 + key[0]) & THREEFRY_MASK
+    x1 = (x1 + key[1]) & THREEFRY_MASK
+    for r in range(rounds):
+        x0 = (x0 + x1) & THREEFRY_MASK
+        rot = THREEFRY_ROTATIONS[r % 8]
+        x1 = ((x1 << rot) | (x1 >> (32 - rot))) & THREEFRY_MASK
+        x1 = x1 ^ x0
+        if r % 4 == 3:
+            i = r // 4 + 1
+            x0 = (x0 + key[i % 3]) & THREEFRY_MASK
+            x1 = (x1 + key[(i + 1) % 3] + i) & THREEFRY_MASK
+    return x0, x1
+
+
+def threefry_tile_bits(tile_cnt, seed, stream=0):
+    """Regenerates the 32 random bits of every datum, in tilized order."""
+    # One Threefry evaluation per lane and pair of dst rows, row d gets the first
+    # word and row d + 1 the second
+    lane = torch.arange(32, dtype=torch.int64)
+    row = torch.arange(0, 32, 2, dtype=torch.int64)
+    tile = torch.arange(tile_cnt, dtype=torch.int64)
+    counter = (row[None, :, None] * 32 + lane[None, None, :]).expand(tile_cnt, -1, -1)
+    bits0, bits1 = threefry2x32(
+        counter, tile[:, None, None].expand_as(counter), seed, stream
+    )
+    bits = torch.stack([bits0, bits1], dim=2).reshape(tile_cnt, 32, 32)
+
+    # dst row d covers face d // 8, rows 4 * ((d % 8) // 2) + lane // 8
+    # and columns 2 * (lane % 8) + d % 2
+    d = torch.arange(32)[:, None]
+    position = (
+        (d // 8) * 256
+        + (4 * ((d % 8) // 2) + lane[None, :] // 8) * 16
+        + 2 * (lane[None, :] % 8)
+        + d % 2
+    )
+    tile_bits = torch.zeros(tile_cnt, 1024, dtype=torch.int64)
+    tile_bits[:, position.flatten()] = bits.reshape(tile_cnt, 1024)
+    return tile_bits.flatten()
+
+
+def dropout_mask(tile_cnt, probability, seed):
+    """Regenerates the drop mask of every datum, in tilized order."""
+    threshold = min(int(probability * 2**31), 2**31 - 1)
+    return (threefry_tile_bits(tile_cnt, seed) >> 1) < threshold
+
+
+@parametrize(
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32],
+        same=True,
+    ),
+    dest_acc=[DestAccumulation.No, DestAccumulation.Yes],
+    probability=[0.1, 0.5],
+    seed=[0, 0xDEADBEEF],
+    input_dimensions=[[32, 32], [64, 64]],
+)
+def test_sfpu_dropout_threefry(formats, dest_acc, probability, seed, input_dimensions):
+
+    if formats.input_format == DataFormat.Float32 and dest_acc == DestAccumulation.No:
+        pytest.skip("Float32 requires DestAccumulation.Yes")
+
+    scale = 1.0 / (1.0 - probability)
+
+    src_A, tile_cnt_A, src_B, tile_cnt_B = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=input_dimensions,
+    )
+
+    # The mask only depends on (seed, tile index, position), so the whole
+    # comparison is done in tilized order
+    src_A = tilize_block(
+        src_A, input_dimensions, stimuli_format=formats.input_format
+    ).flatten()
+    drop = dropout_mask(tile_cnt_A, probability, seed)
+    golden_tensor = torch.where(
+        drop, torch.zeros_like(src_A), src_A.to(torch.float32) * scale
+    ).to(format_dict[formats.output_format])
+
+    configuration = TestConfig(
+        "sources/sfpu_dropout_threefry_test.cpp",
+        formats,
+        templates=[DROPOUT(probability, scale, seed)],
+        runtimes=[TILE_COUNT(tile_cnt_A)],
+        variant_stimuli=StimuliConfig(
+            src_A,
+            formats.input_format,
+            src_B,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=tile_cnt_A,
+        ),
+        unpack_to_dest=False,  # Must be False since math kernel does A2D copy
+        dest_acc=dest_acc,
+    )
+    res_from_L1 = configuration.run().result
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    assert torch.all(res_tensor[drop] == 0), "Mask differs from the regenerated one"
+    assert passed_test(golden_tensor, res_tensor, formats.output_format)
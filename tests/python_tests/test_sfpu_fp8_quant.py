@@ -0,0 +1,123 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import torch
+from helpers.format_config import DataFormat
+from helpers.llk_params import DestAccumulation, Fp8Format, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import FP8_QUANT, TILE_COUNT
+from helpers.tilize_untilize import tilize_block, untilize_block
+from helpers.utils import passed_test
+
+# torch dtype, largest finite value, mantissa bits, smallest subnormal
+FP8_FORMATS = {
+    Fp8Format.E4M3: (torch.float8_e4m3fn, 448.0, 3, 2.0**-9),
+    Fp8Format.E5M2: (torch.float8_e5m2, 57344.0, 2, 2.0**-16),
+}
+
+
+@parametrize(
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32],
+        same=True,
+    ),
+    fp8_format=[Fp8Format.E4M3, Fp8Format.E5M2],
+    dequantize=[False, True],
+    num_tiles=[1, 2],
+)
+def test_sfpu_fp8_quant(formats, fp8_format, dequantize, num_tiles):
+
+    if formats.input_format == DataFormat.Float32:
+        dest_acc = DestAccumulation.Yes
+    else:
+        dest_acc = DestAccumulation.No
+
+    if dest_acc == DestAccumulation.Yes and 2 * num_tiles > 4:
+        pytest.skip("Quantized and scales tiles have to fit in half of the fp32 dest")
+
+    fp8_dtype, fp8_max, mantissa_bits, fp8_min_subnormal = FP8_FORMATS[fp8_format]
+    input_dimensions = [32, 32 * num_tiles]
+
+    src_A, tile_cnt_A, src_B, tile_cnt_B = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=input_dimensions,
+    )
+
+    # Every row of every tile is one block, give the blocks very different ranges
+    torch_format = format_dict[formats.input_format]
+    row_ranges = 2.0 ** torch.randint(-10, 10, (32, num_tiles, 1)).to(torch.float32)
+    rows = (torch.randn(32, num_tiles, 32) * row_ranges).to(torch_format)
+    rows[0, 0, :] = 0.0  # all zero block keeps scale 1
+    src_A = rows.view(input_dimensions)
+
+    blocks = rows.to(torch.float32)
+    absmax = blocks.abs().amax(dim=2, keepdim=True)
+    golden_scales = torch.where(
+        absmax == 0.0, torch.ones_like(absmax), absmax / fp8_max
+    )
+    if dest_acc == DestAccumulation.No:
+        golden_scales = golden_scales.to(torch.bfloat16).to(torch.float32)
+    golden_quant = (blocks / golden_scales).clamp(-fp8_max, fp8_max)
+    golden_quant = golden_quant.to(fp8_dtype).to(torch.float32)
+    golden_tensor = golden_quant * golden_scales if dequantize else golden_quant
+    golden_tensor = golden_tensor.view(input_dimensions)
+    golden_tensor = golden_tensor.to(format_dict[formats.output_format])
+
+    src_A = tilize_block(
+        src_A, input_dimensions, stimuli_format=formats.input_format
+    ).flatten()
+
+    configuration = TestConfig(
+        "sources/sfpu_fp8_quant_test.cpp",
+        formats,
+        templates=[FP8_QUANT(fp8_format, dequantize)],
+        runtimes=[TILE_COUNT(tile_cnt_A)],
+        variant_stimuli=StimuliConfig(
+            src_A,
+            formats.input_format,
+            src_B,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=2 * tile_cnt_A,
+        ),
+        unpack_to_dest=False,  # Must be False since math kernel does A2D copy
+        dest_acc=dest_acc,
+    )
+    res_from_L1 = configuration.run().result
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+    data_size = res_tensor.numel() // 2
+    res_data = untilize_block(
+        res_tensor[:data_size], formats.output_format, input_dimensions
+    )
+
+    # The scale of every row is in column 0 of the scales tile of its tile
+    res_scales = untilize_block(
+        res_tensor[data_size:], formats.output_format, input_dimensions
+    )
+    res_scales = res_scales.view(32, num_tiles, 32)[:, :, 0].contiguous()
+    assert passed_test(
+        golden_scales.view(32, num_tiles).to(format_dict[formats.output_format]),
+        res_scales,
+        formats.output_format,
+    )
+
+    # The reciprocal of the scale is not exact, so a datum may land on a neighbouring
+    # FP8 value: allow one FP8 step relative to the datum, plus the subnormal step
+    fp8_step = 2.0**-mantissa_bits
+    atol = fp8_min_subnormal * (golden_scales.max().item() if dequantize else 1.0)
+    assert passed_test(
+        golden_tensor,
+        res_data.view(input_dimensions),
+        formats.output_format,
+        custom_atol=atol,
+        custom_rtol=fp8_step,
+    )
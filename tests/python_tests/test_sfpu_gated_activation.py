@@ -0,0 +1,104 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import torch
+from helpers.format_config import DataFormat
+from helpers.llk_params import (
+    ApproximationMode,
+    DestAccumulation,
+    GatedActivation,
+    format_dict,
+)
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import APPROX_MODE, GATED_ACTIVATION, TILE_COUNT
+from helpers.tilize_untilize import tilize_block, untilize_block
+from helpers.utils import passed_test
+
+GATED_ACTIVATION_GOLDEN = {
+    GatedActivation.SwiGLU: torch.nn.functional.silu,
+    GatedActivation.GeGLU: torch.nn.functional.gelu,
+}
+
+
+@parametrize(
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32],
+        same=True,
+    ),
+    dest_acc=[DestAccumulation.No, DestAccumulation.Yes],
+    activation=[GatedActivation.SwiGLU, GatedActivation.GeGLU],
+    approx_mode=[ApproximationMode.No, ApproximationMode.Yes],
+    input_dimensions=[[32, 32], [64, 64]],
+)
+def test_sfpu_gated_activation(
+    formats, dest_acc, activation, approx_mode, input_dimensions
+):
+
+    if formats.input_format == DataFormat.Float32 and dest_acc == DestAccumulation.No:
+        pytest.skip("Float32 requires DestAccumulation.Yes")
+
+    if activation == GatedActivation.SwiGLU and approx_mode == ApproximationMode.Yes:
+        pytest.skip("SwiGLU has no approximate variant")
+
+    src_A, tile_cnt_A, src_B, tile_cnt_B = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=input_dimensions,
+    )
+    if dest_acc == DestAccumulation.Yes and 2 * tile_cnt_A > 4:
+        pytest.skip("Gate and up tiles have to fit in half of the fp32 dest")
+
+    # Gate covers both tails of the activation, up is the linear projection
+    torch_format = format_dict[formats.input_format]
+    gate = torch.linspace(-6.0, 6.0, src_A.numel()).to(torch_format)
+    up = (torch.rand(src_B.numel()) * 4.0 - 2.0).to(torch_format)
+
+    golden_tensor = (
+        GATED_ACTIVATION_GOLDEN[activation](gate.to(torch.float32))
+        * up.to(torch.float32)
+    ).view(input_dimensions)
+    golden_tensor = golden_tensor.to(format_dict[formats.output_format])
+
+    src_A = tilize_block(
+        gate, input_dimensions, stimuli_format=formats.input_format
+    ).flatten()
+    src_B = tilize_block(
+        up, input_dimensions, stimuli_format=formats.input_format
+    ).flatten()
+
+    configuration = TestConfig(
+        "sources/sfpu_gated_activation_test.cpp",
+        formats,
+        templates=[APPROX_MODE(approx_mode), GATED_ACTIVATION(activation)],
+        runtimes=[TILE_COUNT(tile_cnt_A)],
+        variant_stimuli=StimuliConfig(
+            src_A,
+            formats.input_format,
+            src_B,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=tile_cnt_A,
+        ),
+        unpack_to_dest=False,  # Must be False since math kernel does A2D copy
+        dest_acc=dest_acc,
+    )
+    res_from_L1 = configuration.run().result
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+    res_tensor = untilize_block(res_tensor, formats.output_format, input_dimensions)
+
+    # Same activation approximations as the unfused silu and gelu kernels
+    assert passed_test(
+        golden_tensor,
+        res_tensor,
+        formats.output_format,
+        custom_atol=0.05,
+        custom_rtol=0.05,
+    )
@@ -0,0 +1,108 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import torch
+from helpers.format_config import DataFormat
+from helpers.llk_params import DestAccumulation, NormType, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import NORM, TILE_COUNT
+from helpers.tilize_untilize import tilize_block, untilize_block
+from helpers.utils import passed_test
+
+EPSILON = 1e-5
+
+
+@parametrize(
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32],
+        same=True,
+    ),
+    dest_acc=[DestAccumulation.No, DestAccumulation.Yes],
+    norm_type=[NormType.LayerNorm, NormType.RMSNorm],
+    affine=[False, True],
+    num_tiles=[1, 2],
+)
+def test_sfpu_layernorm(formats, dest_acc, norm_type, affine, num_tiles):
+
+    if formats.input_format == DataFormat.Float32 and dest_acc == DestAccumulation.No:
+        pytest.skip("Float32 requires DestAccumulation.Yes")
+
+    num_operands = 3 if affine else 1
+    if dest_acc == DestAccumulation.Yes and num_operands * num_tiles > 4:
+        pytest.skip("Input, gamma and beta tiles have to fit in half of the fp32 dest")
+
+    torch_format = format_dict[formats.input_format]
+
+    # Every column is normalized over the rows of num_tiles tiles stacked vertically
+    input_dimensions = [32 * num_tiles, 32]
+    all_dimensions = [32 * num_tiles * num_operands, 32]
+
+    src_A, _, src_B, tile_cnt_B = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=input_dimensions,
+    )
+
+    x = src_A.view(input_dimensions).to(torch_format)
+    operands = [x]
+    if affine:
+        # Gamma and beta hold one value per normalized row, broadcast along the columns
+        gamma = (torch.rand(input_dimensions[0], 1) + 0.5).expand(input_dimensions)
+        beta = (torch.rand(input_dimensions[0], 1) - 0.5).expand(input_dimensions)
+        operands += [gamma.to(torch_format), beta.to(torch_format)]
+
+    src_A = tilize_block(
+        torch.cat(operands).flatten(),
+        all_dimensions,
+        stimuli_format=formats.input_format,
+    ).flatten()
+
+    # GOLDEN GENERATION
+    # *******************************************************
+
+    x_fp32 = x.to(torch.float32)
+    if norm_type == NormType.LayerNorm:
+        mean = x_fp32.mean(dim=0, keepdim=True)
+        var = x_fp32.var(dim=0, unbiased=False, keepdim=True)
+        golden_tensor = (x_fp32 - mean) * torch.rsqrt(var + EPSILON)
+    else:
+        mean_square = (x_fp32 * x_fp32).mean(dim=0, keepdim=True)
+        golden_tensor = x_fp32 * torch.rsqrt(mean_square + EPSILON)
+
+    if affine:
+        gamma, beta = operands[1].to(torch.float32), operands[2].to(torch.float32)
+        golden_tensor = golden_tensor * gamma + beta
+
+    golden_tensor = golden_tensor.to(format_dict[formats.output_format])
+
+    # *******************************************************
+
+    configuration = TestConfig(
+        "sources/sfpu_layernorm_test.cpp",
+        formats,
+        templates=[NORM(norm_type, affine)],
+        runtimes=[TILE_COUNT(num_tiles * num_operands)],
+        variant_stimuli=StimuliConfig(
+            src_A,
+            formats.input_format,
+            src_B,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=num_tiles * num_operands,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=num_tiles,
+        ),
+        unpack_to_dest=False,  # Must be False since math kernel does A2D copy
+        dest_acc=dest_acc,
+    )
+    res_from_L1 = configuration.run().result
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+    res_tensor = untilize_block(res_tensor, formats.output_format, input_dimensions)
+
+    assert passed_test(golden_tensor, res_tensor, formats.output_format)
@@ -0,0 +1,88 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import torch
+from helpers.format_config import DataFormat
+from helpers.llk_params import DestAccumulation, PiecewiseFunction, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import PIECEWISE_POLY, TILE_COUNT
+from helpers.tilize_untilize import tilize_block, untilize_block
+from helpers.utils import passed_test
+
+PIECEWISE_GOLDEN = {
+    PiecewiseFunction.Sigmoid: torch.sigmoid,
+    PiecewiseFunction.Gelu: torch.nn.functional.gelu,
+    PiecewiseFunction.Softplus: torch.nn.functional.softplus,
+}
+
+
+@parametrize(
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32],
+        same=True,
+    ),
+    dest_acc=[DestAccumulation.No, DestAccumulation.Yes],
+    function=[
+        PiecewiseFunction.Sigmoid,
+        PiecewiseFunction.Gelu,
+        PiecewiseFunction.Softplus,
+    ],
+    input_dimensions=[[32, 32], [64, 64]],
+)
+def test_sfpu_piecewise_poly(formats, dest_acc, function, input_dimensions):
+
+    if formats.input_format == DataFormat.Float32 and dest_acc == DestAccumulation.No:
+        pytest.skip("Float32 requires DestAccumulation.Yes")
+
+    src_A, tile_cnt_A, src_B, tile_cnt_B = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=input_dimensions,
+    )
+    # Cover the fitted range, both tails and every interval boundary
+    src_A = torch.linspace(-10.0, 10.0, src_A.numel()).to(src_A.dtype)
+
+    golden_tensor = (
+        PIECEWISE_GOLDEN[function](src_A.view(input_dimensions).to(torch.float32))
+    ).to(format_dict[formats.output_format])
+
+    src_A = tilize_block(
+        src_A, input_dimensions, stimuli_format=formats.input_format
+    ).flatten()
+
+    configuration = TestConfig(
+        "sources/sfpu_piecewise_poly_test.cpp",
+        formats,
+        templates=[PIECEWISE_POLY(function)],
+        runtimes=[TILE_COUNT(tile_cnt_A)],
+        variant_stimuli=StimuliConfig(
+            src_A,
+            formats.input_format,
+            src_B,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=tile_cnt_A,
+        ),
+        unpack_to_dest=False,  # Must be False since math kernel does A2D copy
+        dest_acc=dest_acc,
+    )
+    res_from_L1 = configuration.run().result
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+    res_tensor = untilize_block(res_tensor, formats.output_format, input_dimensions)
+
+    # The example specs are fitted to bfloat16 accuracy, also for Float32 outputs
+    assert passed_test(
+        golden_tensor,
+        res_tensor,
+        formats.output_format,
+        custom_atol=0.01,
+        custom_rtol=0.02,
+    )
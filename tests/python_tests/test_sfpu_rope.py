@@ -0,0 +1,99 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import torch
+from helpers.format_config import DataFormat
+from helpers.llk_params import DestAccumulation, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import ROPE, TILE_COUNT, generate_input_dim
+from helpers.tilize_untilize import tilize_block, untilize_block
+from helpers.utils import passed_test
+
+
+def rope_golden(x, position_offset, freq_base):
+    num_positions, head_dim = x.shape
+    half = head_dim // 2
+    x = x.to(torch.float64)
+
+    inv_freq = freq_base ** (-2.0 * torch.arange(half, dtype=torch.float64) / head_dim)
+    positions = position_offset + torch.arange(num_positions, dtype=torch.float64)
+    angles = torch.outer(positions, inv_freq)
+    cos, sin = torch.cos(angles), torch.sin(angles)
+
+    x1, x2 = x[:, :half], x[:, half:]
+    return torch.cat([x1 * cos - x2 * sin, x2 * cos + x1 * sin], dim=1)
+
+
+@parametrize(
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32],
+        same=True,
+    ),
+    dest_acc=[DestAccumulation.No, DestAccumulation.Yes],
+    # [positions, head_dim]
+    input_dimensions=[
+        [32, 32],
+        [32, 64],
+        [64, 64],
+        [32, 128],
+        [64, 128],
+    ],
+    position_offset=[0, 100],
+)
+def test_sfpu_rope(formats, dest_acc, input_dimensions, position_offset):
+
+    if formats.input_format == DataFormat.Float32 and dest_acc == DestAccumulation.No:
+        pytest.skip("Float32 requires DestAccumulation.Yes")
+
+    tile_cnt = input_dimensions[0] * input_dimensions[1] // 1024
+    if dest_acc == DestAccumulation.Yes and tile_cnt > 4:
+        pytest.skip("The whole block has to fit in half of the fp32 dest")
+
+    freq_base = 10000.0
+
+    src_A, tile_cnt_A, src_B, tile_cnt_B = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=input_dimensions,
+    )
+
+    golden_tensor = rope_golden(
+        src_A.view(input_dimensions), position_offset, freq_base
+    ).to(format_dict[formats.output_format])
+
+    src_A = tilize_block(
+        src_A, input_dimensions, stimuli_format=formats.input_format
+    ).flatten()
+
+    configuration = TestConfig(
+        "sources/sfpu_rope_test.cpp",
+        formats,
+        templates=[
+            generate_input_dim(input_dimensions, input_dimensions),
+            ROPE(position_offset, freq_base),
+        ],
+        runtimes=[TILE_COUNT(tile_cnt_A)],
+        variant_stimuli=StimuliConfig(
+            src_A,
+            formats.input_format,
+            src_B,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=tile_cnt_A,
+        ),
+        unpack_to_dest=False,  # Must be False since math kernel does A2D copy
+        dest_acc=dest_acc,
+    )
+    res_from_L1 = configuration.run().result
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+    res_tensor = untilize_block(res_tensor, formats.output_format, input_dimensions)
+
+    assert passed_test(golden_tensor, res_tensor, formats.output_format)
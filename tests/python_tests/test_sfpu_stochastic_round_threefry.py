@@ -0,0 +1,121 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import torch
+from helpers.format_config import DataFormat
+from helpers.llk_params import DestAccumulation
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import STOCHASTIC_ROUND, TILE_COUNT
+from helpers.tilize_untilize import tilize_block
+from test_sfpu_dropout_threefry import threefry_tile_bits
+
+FP16B_MASK = 0xFFFF0000
+FP16B_ULP = 0x10000
+
+
+def float32_bits(tensor):
+    """Bits of a float32 tensor as uint32 values in int64."""
+    return tensor.to(torch.float32).view(torch.int32).to(torch.int64) & 0xFFFFFFFF
+
+
+def float32_from_bits(bits):
+    """float32 tensor holding the uint32 values of an int64 tensor."""
+    return torch.where(bits >= 2**31, bits - 2**32, bits).to(torch.int32).view(
+        torch.float32
+    )
+
+
+@parametrize(
+    formats=input_output_formats(
+        # Rounds fp32 in dest to fp16b, so the discarded bits have to reach dest
+        [DataFormat.Float32],
+        same=True,
+    ),
+    seed=[0, 0xDEADBEEF],
+    per_face=[False, True],
+    input_dimensions=[[32, 32], [64, 64]],
+)
+def test_sfpu_stochastic_round_threefry(formats, seed, per_face, input_dimensions):
+    """
+    Checks the Threefry stochastic rounding bit exact against the regenerated random
+    bits, and its two defining properties on their own: every result is one of the
+    two fp16b values around its input, and the rounding error has zero mean.
+    Rounding the faces one by one with their datum offsets must give the same
+    result as rounding the whole tile.
+    """
+
+    src_A, tile_cnt_A, src_B, tile_cnt_B = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=input_dimensions,
+    )
+
+    # The random bits only depend on (seed, tile index, position), so the whole
+    # comparison is done in tilized order
+    src_A = tilize_block(
+        src_A, input_dimensions, stimuli_format=formats.input_format
+    ).flatten()
+
+    # Every 16th datum is already an fp16b value and has to come back unchanged
+    src_bits = float32_bits(src_A)
+    src_bits[::16] &= FP16B_MASK
+    src_A = float32_from_bits(src_bits)
+
+    random_bits = threefry_tile_bits(tile_cnt_A, seed)
+    golden_bits = (src_bits + (random_bits >> 16)) & FP16B_MASK
+
+    configuration = TestConfig(
+        "sources/sfpu_stochastic_round_threefry_test.cpp",
+        formats,
+        templates=[STOCHASTIC_ROUND(seed, per_face)],
+        runtimes=[TILE_COUNT(tile_cnt_A)],
+        variant_stimuli=StimuliConfig(
+            src_A,
+            formats.input_format,
+            src_B,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=tile_cnt_A,
+        ),
+        unpack_to_dest=True,
+        dest_acc=DestAccumulation.Yes,
+    )
+    res_from_L1 = configuration.run().result
+
+    res_tensor = torch.tensor(res_from_L1, dtype=torch.float32)
+    res_bits = float32_bits(res_tensor)
+
+    assert len(res_bits) == len(
+        golden_bits
+    ), "Result tensor and golden tensor are not of the same length"
+
+    # Truncation and the next fp16b value away from zero
+    lower_bits = src_bits & FP16B_MASK
+    upper_bits = lower_bits + FP16B_ULP
+    rounded_up = res_bits == upper_bits
+    assert torch.all(
+        (res_bits == lower_bits) | rounded_up
+    ), "Result is not one of the two fp16b values around the input"
+    assert torch.all(
+        res_bits[::16] == src_bits[::16]
+    ), "Exact fp16b values were changed by the rounding"
+
+    # Rounding away from zero with a probability equal to the discarded fraction
+    # makes the error, in units of the fp16b spacing, zero mean with a variance of
+    # fraction * (1 - fraction) per datum
+    fraction = (src_bits - lower_bits).to(torch.float64) / FP16B_ULP
+    error = rounded_up.to(torch.float64) - fraction
+    sigma = torch.sqrt(torch.sum(fraction * (1 - fraction)))
+    assert (
+        torch.abs(torch.sum(error)) <= 5 * sigma
+    ), f"Rounding is biased: error sum {torch.sum(error):.2f}, sigma {sigma:.2f}"
+
+    assert torch.equal(
+        res_bits, golden_bits
+    ), "Result differs from the regenerated stochastic rounding"
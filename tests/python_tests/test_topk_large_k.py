@@ -0,0 +1,145 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+"""
+Large-k TopK SFPU Test
+
+Streams the multi-tile bitonic sort, merge and tile exchange over rows longer
+than dest to find the top k (up to 1024) values of every row together with
+their indices. Rows that hold exactly k values are fully argsorted.
+
+Sorting only moves datums, so the values are compared bit exact against
+torch.topk, the indices are checked to point at the reported values.
+"""
+
+import pytest
+import torch
+from helpers.format_config import DataFormat, InputOutputFormat
+from helpers.golden_generators import TopKGolden, UntilizeGolden, get_golden_generator
+from helpers.llk_params import DestAccumulation, TopKSortDirection, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import (
+    DEST_SYNC,
+    INPUT_DIMENSIONS,
+    TILE_COUNT,
+    TOPK,
+)
+from test_topk import (
+    NUM_STAGES,
+    prepare_input_tensor_for_topk,
+    transform_result_tensor_to_right_form,
+    validate_topk_indices,
+)
+
+# Keeps the in place work buffer, value and index tiles of all tile rows, in L1
+MAX_VALUE_TILES_PER_ROW = 64
+
+
+@parametrize(
+    formats=input_output_formats(
+        [
+            DataFormat.Float16_b,
+        ]
+    ),
+    K=[32, 64, 128, 256, 512, 1024],
+    # Row length in multiples of K, 1 is a full row argsort
+    runs_per_row=[1, 2, 4],
+    num_rows=[32, 64],
+    sort_direction=[TopKSortDirection.Descending, TopKSortDirection.Ascending],
+)
+def test_topk_large_k(
+    formats: InputOutputFormat,
+    K: int,
+    runs_per_row: int,
+    num_rows: int,
+    sort_direction: TopKSortDirection,
+):
+    num_value_tiles = K * runs_per_row // 32
+    if num_value_tiles * (num_rows // 32) > MAX_VALUE_TILES_PER_ROW:
+        pytest.skip("Value and index tiles of the whole input do not fit in L1")
+
+    input_dimensions = [num_rows, K * runs_per_row * NUM_STAGES]
+
+    src_A, tile_cnt_A, src_B, tile_cnt_B = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=input_dimensions,
+        sfpu=False,
+    )
+
+    golden_generator = get_golden_generator(TopKGolden)
+    golden_tensor = golden_generator(
+        src_A,
+        formats.input_format,
+        K,
+        sort_direction,
+        input_dimensions=input_dimensions,
+    )
+
+    src_A_tilized = prepare_input_tensor_for_topk(src_A, formats, input_dimensions)
+    tile_cnt_res = (num_rows // 32) * (K // 32) * NUM_STAGES
+
+    configuration = TestConfig(
+        test_name="sources/topk_large_k_test.cpp",
+        formats=formats,
+        templates=[
+            DEST_SYNC(),
+            TOPK(
+                topk_k=K,
+                topk_matrix_width=input_dimensions[1],
+                topk_sort_direction=sort_direction,
+            ),
+        ],
+        runtimes=[
+            INPUT_DIMENSIONS(input_dimensions[0] // 32, input_dimensions[1] // 32),
+            TILE_COUNT(tile_cnt_A),
+        ],
+        variant_stimuli=StimuliConfig(
+            src_A_tilized,
+            formats.input_format,
+            src_B,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=tile_cnt_res,
+        ),
+        dest_acc=DestAccumulation.No,
+        unpack_to_dest=False,
+    )
+
+    res_from_L1 = configuration.run().result
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    res_tensor = transform_result_tensor_to_right_form(
+        res_tensor, formats, K, input_dimensions
+    )
+
+    assert len(res_tensor) == len(
+        golden_tensor
+    ), "Result tensor and golden tensor are not of the same length"
+
+    assert validate_topk_indices(
+        res_tensor, golden_tensor, src_A_tilized, formats, input_dimensions, K
+    )
+
+    untilizer = get_golden_generator(UntilizeGolden)
+    res_values = untilizer(
+        res_tensor, formats.output_format, [num_rows, K * NUM_STAGES]
+    ).view(num_rows, K * NUM_STAGES)[:, :K]
+
+    values = src_A.view(num_rows, NUM_STAGES, -1)[:, 0, :]
+    golden_values = torch.topk(
+        values,
+        K,
+        dim=1,
+        largest=(sort_direction == TopKSortDirection.Descending),
+        sorted=True,
+    ).values
+
+    assert torch.equal(
+        golden_values, res_values.to(golden_values.dtype)
+    ), "TopK values differ from torch.topk"
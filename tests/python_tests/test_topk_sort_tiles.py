@@ -0,0 +1,124 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+"""
+Multi-tile TopK sort SFPU Test
+
+Sorts every row of a block of value tiles together with its index tiles in a
+single dest section (full row argsort), the building block of the large-k TopK.
+The golden is a TopK with K equal to the number of value columns.
+"""
+
+import torch
+from helpers.format_config import DataFormat, InputOutputFormat
+from helpers.golden_generators import TopKGolden, get_golden_generator
+from helpers.llk_params import DestAccumulation, TopKSortDirection, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import (
+    DEST_SYNC,
+    INPUT_DIMENSIONS,
+    TILE_COUNT,
+    TOPK,
+)
+from helpers.utils import passed_test
+from test_topk import (
+    NUM_STAGES,
+    get_value_tiles_from_topk_tensor,
+    prepare_input_tensor_for_topk,
+    transform_result_tensor_to_right_form,
+    validate_topk_indices,
+)
+
+
+@parametrize(
+    formats=input_output_formats(
+        [
+            DataFormat.Float16_b,
+        ]
+    ),
+    input_dimensions=[
+        [32, 128],
+        [64, 128],
+        [32, 256],
+    ],
+    sort_direction=[TopKSortDirection.Descending, TopKSortDirection.Ascending],
+)
+def test_topk_sort_tiles(
+    formats: InputOutputFormat,
+    input_dimensions: list,
+    sort_direction: TopKSortDirection,
+):
+    # Every value of the row is kept
+    K = input_dimensions[1] // NUM_STAGES
+
+    src_A, tile_cnt_A, src_B, tile_cnt_B = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=input_dimensions,
+        sfpu=False,
+    )
+
+    golden_generator = get_golden_generator(TopKGolden)
+    golden_tensor = golden_generator(
+        src_A,
+        formats.input_format,
+        K,
+        sort_direction,
+        input_dimensions=input_dimensions,
+    )
+
+    src_A = prepare_input_tensor_for_topk(src_A, formats, input_dimensions)
+
+    configuration = TestConfig(
+        test_name="sources/topk_sort_tiles_test.cpp",
+        formats=formats,
+        templates=[
+            DEST_SYNC(),
+            TOPK(
+                topk_k=K,
+                topk_matrix_width=input_dimensions[1],
+                topk_sort_direction=sort_direction,
+            ),
+        ],
+        runtimes=[
+            INPUT_DIMENSIONS(input_dimensions[0] // 32, input_dimensions[1] // 32),
+            TILE_COUNT(tile_cnt_A),
+        ],
+        variant_stimuli=StimuliConfig(
+            src_A,
+            formats.input_format,
+            src_B,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=tile_cnt_A,
+        ),
+        dest_acc=DestAccumulation.No,
+        unpack_to_dest=False,
+    )
+
+    res_from_L1 = configuration.run().result
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    res_tensor = transform_result_tensor_to_right_form(
+        res_tensor, formats, K, input_dimensions
+    )
+
+    assert len(res_tensor) == len(
+        golden_tensor
+    ), "Result tensor and golden tensor are not of the same length"
+
+    assert validate_topk_indices(
+        res_tensor, golden_tensor, src_A, formats, input_dimensions, K
+    )
+
+    res_values = get_value_tiles_from_topk_tensor(res_tensor, K, input_dimensions)
+    golden_values = get_value_tiles_from_topk_tensor(golden_tensor, K, input_dimensions)
+
+    assert passed_test(
+        golden_values, res_values, formats.output_format, print_errors=True
+    )
@@ -0,0 +1,110 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import torch
+from helpers.format_config import DataFormat
+from helpers.golden_generators import (
+    TILE_DIMENSIONS,
+    EltwiseBinaryGolden,
+    get_golden_generator,
+)
+from helpers.llk_params import (
+    BlocksCalculationAlgorithm,
+    DestAccumulation,
+    DestSync,
+    MathFidelity,
+    MathOperation,
+    format_dict,
+)
+from helpers.param_config import (
+    get_num_blocks_and_num_tiles_in_block,
+    input_output_formats,
+    parametrize,
+)
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import (
+    MATH_OP,
+    NUM_BLOCKS,
+    NUM_TILES_IN_BLOCK,
+    generate_input_dim,
+)
+from helpers.utils import passed_test
+
+
+@parametrize(
+    formats=input_output_formats(
+        [
+            DataFormat.Float16_b,
+            DataFormat.Float16,
+            DataFormat.Bfp8_b,
+        ]
+    ),
+    dest_acc=[DestAccumulation.No, DestAccumulation.Yes],
+    mathop=[MathOperation.Elwadd, MathOperation.Elwsub],
+    input_dimensions=[[32, 32], [64, 64], [32, 256], [128, 256]],
+)
+def test_unpack_AB_gather(formats, dest_acc, mathop, input_dimensions):
+
+    src_A, tile_cnt_A, src_B, tile_cnt_B = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=input_dimensions,
+    )
+
+    # The kernel gathers A in reverse order and B rotated by one tile
+    gathered_A = src_A.view(tile_cnt_A, -1).flip(0).flatten()
+    gathered_B = src_B.view(tile_cnt_B, -1).roll(-1, 0).flatten()
+
+    generate_golden = get_golden_generator(EltwiseBinaryGolden)
+    golden_tensor = generate_golden(
+        mathop,
+        gathered_A,
+        gathered_B,
+        formats.output_format,
+        MathFidelity.LoFi,
+        input_format=formats.input_format,
+    )
+
+    num_blocks, num_tiles_in_block = get_num_blocks_and_num_tiles_in_block(
+        DestSync.Half,
+        dest_acc,
+        formats,
+        input_dimensions,
+        TILE_DIMENSIONS,
+        BlocksCalculationAlgorithm.Standard,
+    )
+
+    configuration = TestConfig(
+        "sources/unpack_AB_gather_test.cpp",
+        formats,
+        templates=[
+            MATH_OP(mathop=mathop),
+            generate_input_dim(input_dimensions, input_dimensions),
+        ],
+        runtimes=[
+            NUM_BLOCKS(num_blocks),
+            NUM_TILES_IN_BLOCK(num_tiles_in_block),
+        ],
+        variant_stimuli=StimuliConfig(
+            src_A,
+            formats.input_format,
+            src_B,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=tile_cnt_A,
+        ),
+        dest_acc=dest_acc,
+    )
+
+    res_from_L1 = configuration.run().result
+
+    assert len(res_from_L1) == len(golden_tensor)
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    assert passed_test(golden_tensor, res_tensor, formats.output_format)
@@ -50,10 +50,16 @@ void run_kernel(RUNTIME_PARAMETERS params)
 #if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
     const FormatConfig& formats = params.formats;
 #endif
+#ifdef ARCH_BLACKHOLE
     _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false, false>(params.num_faces, formats.math);
+#else
+    _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false>(params.num_faces, formats.math);
+#endif
     _llk_math_pack_sync_init_<dest_sync, is_fp32_dest_acc_en>();
     _llk_math_hw_configure_<is_fp32_dest_acc_en>(formats.math, formats.math);
+#ifdef ARCH_BLACKHOLE
     _llk_math_reconfig_remap_(true);
+#endif
 
     _llk_math_wait_for_dest_available_<dest_sync>();
     for (std::uint32_t tile_index_within_block = 0; tile_index_within_block < BLOCK_CT_DIM; ++tile_index_within_block) // Loop over tiles in the block
@@ -80,15 +86,38 @@ void run_kernel(RUNTIME_PARAMETERS params)
 #if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
     const FormatConfig& formats = params.formats;
 #endif
+    // Ugly but we are converting one 4 face tile into two 2 face tiles (in0_tile_c_dim == 32)
+    // or four 1 face tiles (in0_tile_c_dim == 16) side by side
+    const std::uint32_t dense_num_faces     = params.in0_tile_c_dim / FACE_C_DIM;
+    const std::uint32_t tiles_per_dest_tile = params.num_faces / dense_num_faces;
+    const std::uint32_t dense_block_ct_dim  = BLOCK_CT_DIM * tiles_per_dest_tile;
+    const std::uint32_t dense_full_ct_dim   = FULL_CT_DIM * tiles_per_dest_tile;
+
+#ifdef ARCH_BLACKHOLE
     _llk_pack_hw_configure_<is_fp32_dest_acc_en, false, false>(formats.pack_src, formats.pack_dst, 0 /* tile_size */);
     _llk_pack_dest_init_<dest_sync, is_fp32_dest_acc_en>();
-    // Ugly but we are converting one 4 face tile into two 2 face tiles side by side
-    _llk_pack_untilize_init_<BLOCK_CT_DIM * 2, FULL_CT_DIM * 2, false, TILE_C_DIM, true>(
-        formats.pack_src, formats.pack_dst, params.in0_tile_r_dim, params.num_faces / 2);
+    _llk_pack_untilize_init_runtime_<false, TILE_C_DIM, true>(
+        formats.pack_src, formats.pack_dst, dense_block_ct_dim, dense_full_ct_dim, params.in0_tile_r_dim, dense_num_faces);
+#else
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, true>(formats.pack_src, formats.pack_dst, 0 /* tile_size */);
+    _llk_pack_dest_init_<dest_sync, is_fp32_dest_acc_en, true /* untilize */, true /* dense */>(params.in0_tile_r_dim);
+    _llk_pack_untilize_init_runtime_<false, false, TILE_C_DIM, true>(
+        formats.pack_dst, dense_block_ct_dim, dense_full_ct_dim, params.in0_tile_r_dim, dense_num_faces);
+#endif
 
     _llk_packer_wait_for_math_done_();
-    _llk_pack_untilize_<BLOCK_CT_DIM * 2, FULL_CT_DIM * 2, false, 0, true>(
-        L1_ADDRESS(params.buffer_Res[0]), formats.pack_dst, params.in0_tile_r_dim, params.num_faces / 2, 0 /* tile_dst_rt_offset */);
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_untilize_runtime_(L1_ADDRESS(params.buffer_Res[0]), dense_num_faces, 0 /* tile_dst_offset */);
+#else
+    _llk_pack_untilize_runtime_<false, false, TILE_C_DIM, true>(
+        L1_ADDRESS(params.buffer_Res[0]),
+        formats.pack_dst,
+        dense_block_ct_dim,
+        dense_full_ct_dim,
+        params.in0_tile_r_dim,
+        dense_num_faces,
+        0 /* tile_dst_offset */);
+#endif
     _llk_pack_dest_section_done_<dest_sync, is_fp32_dest_acc_en>();
 }
 
@@ -42,7 +42,7 @@ void run_kernel(RUNTIME_PARAMETERS params)
             FACE_R_DIM,
             4 /* num_faces */,
             4 /* num_faces */);
-        _llk_unpack_AB_sub_bcast_col_init_custom_<BROADCAST_TYPE>();
+        _llk_unpack_AB_bcast_reuse_init_custom_<BROADCAST_TYPE>();
         PROFILER_SYNC();
     }
     {
@@ -67,7 +67,7 @@ void run_kernel(RUNTIME_PARAMETERS params)
         {
             for (std::uint32_t loop = 0; loop < static_cast<std::uint32_t>(LOOP_FACTOR); loop++)
             {
-                _llk_unpack_AB_sub_bcast_col_custom_<BROADCAST_TYPE>(PERF_ADDRESS(PERF_INPUT_A, 0), PERF_ADDRESS(PERF_INPUT_B, 0), CT_DIM);
+                _llk_unpack_AB_bcast_reuse_custom_<BROADCAST_TYPE>(PERF_ADDRESS(PERF_INPUT_A, 0), PERF_ADDRESS(PERF_INPUT_B, 0), CT_DIM);
             }
         }
         PROFILER_SYNC();
@@ -94,7 +94,7 @@ void run_kernel(RUNTIME_PARAMETERS params)
         ZONE_SCOPED("INIT")
         _llk_math_pack_sync_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
         _llk_math_hw_configure_<is_fp32_dest_acc_en>(formats.math, formats.math);
-        _llk_math_eltwise_binary_init_custom_<ELTWISE_BINARY_OP, BROADCAST_TYPE, MATH_FIDELITY>(4, 0);
+        _llk_math_eltwise_binary_bcast_reuse_init_custom_<ELTWISE_BINARY_OP, BROADCAST_TYPE, MATH_FIDELITY>();
         PROFILER_SYNC();
     }
     {
@@ -121,7 +121,7 @@ void run_kernel(RUNTIME_PARAMETERS params)
             // Custom blocked sub+bcast math consumes the valids produced by unpack mock.
             for (std::uint32_t loop = 0; loop < static_cast<std::uint32_t>(LOOP_FACTOR); loop++)
             {
-                _llk_math_sub_bcast_cols_reuse_custom_(CT_DIM);
+                _llk_math_eltwise_binary_bcast_reuse_custom_<DstSync::SyncHalf, is_fp32_dest_acc_en>(0 /* dst_index */, CT_DIM);
             }
         }
         else // L1_TO_L1
@@ -129,7 +129,7 @@ void run_kernel(RUNTIME_PARAMETERS params)
             for (std::uint32_t loop = 0; loop < static_cast<std::uint32_t>(LOOP_FACTOR); loop++)
             {
                 _llk_math_wait_for_dest_available_<DstSync::SyncHalf>();
-                _llk_math_sub_bcast_cols_reuse_custom_(CT_DIM);
+                _llk_math_eltwise_binary_bcast_reuse_custom_<DstSync::SyncHalf, is_fp32_dest_acc_en>(0 /* dst_index */, CT_DIM);
                 _llk_math_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
             }
         }
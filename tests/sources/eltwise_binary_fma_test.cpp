@@ -0,0 +1,135 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+/* Fused multiply-add test, Output = A * B + C.
+   C is unpacked straight into dest when it is 32-bit and dest is in fp32 mode, otherwise it is unpacked to srcA and
+   moved into dest with a datacopy. The FPU then multiplies A and B and accumulates the product into C. */
+#include <cstdint>
+
+#include "ckernel.h"
+#include "llk_defs.h"
+#include "params.h"
+#include "tensor_shape.h"
+
+// Globals
+std::uint32_t unp_cfg_context          = 0;
+std::uint32_t pack_sync_tile_dst_ptr   = 0;
+std::uint32_t math_sync_tile_dst_index = 0;
+
+using namespace ckernel;
+
+// Unpacker and math have to agree on how C reaches dest
+inline bool unpack_c_to_dest(const std::uint32_t c_format)
+{
+    return is_fp32_dest_acc_en && (c_format == to_underlying(DataFormat::Float32));
+}
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "llk_unpack_A.h"
+#include "llk_unpack_AB.h"
+#include "llk_unpack_common.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+    _llk_unpack_hw_configure_<is_fp32_dest_acc_en>(
+        formats.unpack_A_src, formats.unpack_B_src, formats.unpack_A_dst, formats.unpack_B_dst, FACE_R_DIM, FACE_R_DIM, 4 /* num_faces */, 4 /* num_faces */);
+
+    const bool c_to_dest                = unpack_c_to_dest(formats.unpack_A_src);
+    constexpr std::uint32_t dest_format = to_underlying(DataFormat::Float32);
+
+    for (int i = 0; i < params.INPUT_TILE_CNT; ++i)
+    {
+        if (c_to_dest)
+        {
+            // Unpack to dest needs the 32-bit dest format, srcA goes back to its own format for A
+            _llk_unpack_reconfig_data_format_srca_impl_<is_fp32_dest_acc_en>(formats.unpack_A_src, dest_format, params.TILE_SIZE_UNPACK_A);
+            _llk_unpack_A_init_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, true /* unpack_to_dest */>(
+                0, 0, FACE_R_DIM, 4, formats.unpack_A_src, dest_format);
+            _llk_unpack_A_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, true /* unpack_to_dest */>(
+                L1_ADDRESS(params.buffer_C[i]), formats.unpack_A_src, dest_format);
+            _llk_unpack_reconfig_data_format_srca_impl_<is_fp32_dest_acc_en>(formats.unpack_A_src, formats.unpack_A_dst, params.TILE_SIZE_UNPACK_A);
+        }
+        else
+        {
+            _llk_unpack_A_init_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, false /* unpack_to_dest */>(
+                0, 0, FACE_R_DIM, 4, formats.unpack_A_src, formats.unpack_A_dst);
+            _llk_unpack_A_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, false /* unpack_to_dest */>(
+                L1_ADDRESS(params.buffer_C[i]), formats.unpack_A_src, formats.unpack_A_dst);
+        }
+
+        _llk_unpack_AB_init_<BroadcastType::NONE>(DEFAULT_TENSOR_SHAPE);
+        _llk_unpack_AB_<BroadcastType::NONE>(L1_ADDRESS(params.buffer_A[i]), L1_ADDRESS(params.buffer_B[i]));
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+#include "llk_math_common.h"
+#include "llk_math_eltwise_binary.h"
+#include "llk_math_eltwise_unary_datacopy.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+    _llk_math_pack_sync_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    _llk_math_hw_configure_<is_fp32_dest_acc_en>(formats.math, formats.math);
+
+    const bool c_to_dest              = unpack_c_to_dest(formats.unpack_A_src);
+    const std::uint32_t c_dest_format = c_to_dest ? to_underlying(DataFormat::Float32) : formats.math;
+    constexpr std::uint32_t dst_index = 0;
+
+    for (int i = 0; i < params.INPUT_TILE_CNT; ++i)
+    {
+        _llk_math_wait_for_dest_available_<DstSync::SyncHalf>();
+        if (!c_to_dest)
+        {
+#ifdef ARCH_BLACKHOLE
+            _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false, false>(4, formats.math);
+#else
+            _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false>(4, formats.math);
+#endif
+            _llk_math_eltwise_unary_datacopy_<DataCopyType::A2D, DstSync::SyncHalf, is_fp32_dest_acc_en, BroadcastType::NONE, false>(
+                dst_index, formats.math, formats.math);
+        }
+
+        _llk_math_eltwise_binary_fma_init_<BroadcastType::NONE, MATH_FIDELITY>(DEFAULT_TENSOR_SHAPE);
+        _llk_math_eltwise_binary_fma_<BroadcastType::NONE, DstSync::SyncHalf, is_fp32_dest_acc_en, MATH_FIDELITY, true /* unpack_to_dest */>(
+            DEFAULT_TENSOR_SHAPE, dst_index, formats.unpack_A_src, c_dest_format);
+        _llk_math_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+#include "llk_pack.h"
+#include "llk_pack_common.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en>(formats.pack_src, formats.pack_dst, TILE_WIDTH * TILE_HEIGHT);
+    _llk_pack_init_<false /* untilize */, false /* zero_output */>(formats.pack_dst);
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+
+    for (int i = 0; i < params.INPUT_TILE_CNT; ++i)
+    {
+        _llk_packer_wait_for_math_done_();
+        _llk_pack_<DstSync::SyncHalf, is_fp32_dest_acc_en, false /* untilize */>(0, L1_ADDRESS(params.buffer_Res[i]));
+        _llk_pack_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    }
+}
+
+#endif
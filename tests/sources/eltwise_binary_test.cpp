@@ -102,7 +102,12 @@ void run_kernel(RUNTIME_PARAMETERS params)
     constexpr auto REUSE_DEST_TYPE              = ckernel::EltwiseBinaryReuseDestType::NONE;
 #endif
 
+#ifdef EN_DEST_REUSE_BLOCK
+    _llk_math_eltwise_binary_with_dest_reuse_block_init_<ELTWISE_BINARY_OP, BROADCAST_TYPE, MATH_FIDELITY, REUSE_DEST_TYPE>(
+        tensor_shape, tiles_in_block, ACC_TO_DEST);
+#else
     _llk_math_eltwise_binary_init_<ELTWISE_BINARY_OP, BROADCAST_TYPE, MATH_FIDELITY, REUSE_DEST_TYPE>(tensor_shape, ACC_TO_DEST);
+#endif
 
     // Perform element-wise operation
     for (std::uint32_t block = 0; block < num_blocks; block++)
@@ -110,6 +115,10 @@ void run_kernel(RUNTIME_PARAMETERS params)
         _llk_math_wait_for_dest_available_<dest_sync>();
         for (std::uint32_t n = 0; n < num_tiles_accumulations; n++)
         {
+#ifdef EN_DEST_REUSE_BLOCK
+            _llk_math_eltwise_binary_with_dest_reuse_block_<ELTWISE_BINARY_OP, BROADCAST_TYPE, dest_sync, is_fp32_dest_acc_en, MATH_FIDELITY, REUSE_DEST_TYPE>(
+                tensor_shape, 0 /* dst_index */, tiles_in_block, false /* clear_fp32_dst_acc */);
+#else
             for (std::uint32_t tile = 0; tile < tiles_in_block; tile++)
             {
                 LLK_ASSERT(
@@ -118,6 +127,7 @@ void run_kernel(RUNTIME_PARAMETERS params)
                 _llk_math_eltwise_binary_<ELTWISE_BINARY_OP, BROADCAST_TYPE, dest_sync, is_fp32_dest_acc_en, MATH_FIDELITY, REUSE_DEST_TYPE>(
                     tensor_shape, tile /* dst_index */, false /* clear_fp32_dst_acc */);
             }
+#endif
         }
         _llk_math_dest_section_done_<dest_sync, is_fp32_dest_acc_en>();
     }
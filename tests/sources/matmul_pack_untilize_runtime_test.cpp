@@ -0,0 +1,173 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+
+#include "ckernel.h"
+#include "llk_defs.h"
+#include "params.h"
+
+// Globals
+std::uint32_t unp_cfg_context          = 0;
+std::uint32_t pack_sync_tile_dst_ptr   = 0;
+std::uint32_t math_sync_tile_dst_index = 0;
+
+// The kernel computes a matmul of a [FULL_RT_DIM x KT_DIM] by [KT_DIM x FULL_CT_DIM] tile matrix and writes the result
+// directly to L1 in row-major order. Every row band of the output is split into dest sections of BLOCK_CT_DIM tiles,
+// with a narrower tail section when FULL_CT_DIM is not a multiple of BLOCK_CT_DIM. All widths are runtime values.
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "llk_unpack_AB_matmul.h"
+#include "llk_unpack_common.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#ifdef RUNTIME_FORMATS
+    const FormatConfig& formats = params.formats;
+#endif
+
+    _llk_unpack_hw_configure_<is_fp32_dest_acc_en>(
+        formats.unpack_A_src,
+        formats.unpack_B_src,
+        formats.unpack_A_dst,
+        formats.unpack_B_dst,
+        FACE_R_DIM,
+        FACE_R_DIM,
+        4 /* num_faces */,
+        4 /* num_faces */,
+        params.TILE_SIZE_UNPACK_A,
+        params.TILE_SIZE_UNPACK_B);
+    _llk_unpack_AB_matmul_init_<>();
+
+    for (std::uint32_t rt = 0; rt < params.FULL_RT_DIM; rt++)
+    {
+        for (std::uint32_t ct = 0; ct < params.FULL_CT_DIM; ct += params.BLOCK_CT_DIM)
+        {
+            const std::uint32_t block_ct_dim = std::min(params.BLOCK_CT_DIM, params.FULL_CT_DIM - ct);
+            for (std::uint32_t tile = 0; tile < block_ct_dim; tile++)
+            {
+                for (std::uint32_t kt = 0; kt < params.KT_DIM; kt++)
+                {
+                    _llk_unpack_AB_matmul_<>(
+                        L1_ADDRESS(params.buffer_A[0]),
+                        L1_ADDRESS(params.buffer_B[0]),
+                        rt * params.KT_DIM + kt,
+                        kt * params.FULL_CT_DIM + ct + tile,
+                        params.TILE_SIZE_UNPACK_A,
+                        params.TILE_SIZE_UNPACK_B);
+                }
+            }
+        }
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+#include "llk_math_common.h"
+#include "llk_math_matmul.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#ifdef RUNTIME_FORMATS
+    const FormatConfig& formats = params.formats;
+#endif
+
+    _llk_math_matmul_init_<MATH_FIDELITY>();
+    _llk_math_pack_sync_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    _llk_math_hw_configure_<is_fp32_dest_acc_en>(formats.math, formats.math);
+#ifdef ARCH_BLACKHOLE
+    _llk_math_reconfig_remap_(true);
+#endif
+
+    LLK_ASSERT(
+        (params.BLOCK_CT_DIM <= get_dest_max_tiles<DstSync::SyncHalf, is_fp32_dest_acc_en, DstTileShape::Tile32x32>()),
+        "BLOCK_CT_DIM exceeds max dest tiles");
+
+    for (std::uint32_t rt = 0; rt < params.FULL_RT_DIM; rt++)
+    {
+        for (std::uint32_t ct = 0; ct < params.FULL_CT_DIM; ct += params.BLOCK_CT_DIM)
+        {
+            const std::uint32_t block_ct_dim = std::min(params.BLOCK_CT_DIM, params.FULL_CT_DIM - ct);
+            _llk_math_wait_for_dest_available_<DstSync::SyncHalf>();
+            for (std::uint32_t tile = 0; tile < block_ct_dim; tile++)
+            {
+                for (std::uint32_t kt = 0; kt < params.KT_DIM; kt++)
+                {
+                    _llk_math_matmul_<MATH_FIDELITY>(tile);
+                }
+            }
+            _llk_math_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+        }
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+#include "llk_pack.h"
+#include "llk_pack_common.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#ifdef RUNTIME_FORMATS
+    const FormatConfig& formats = params.formats;
+#endif
+    const bool UNTILIZE                = true;
+    const std::uint32_t tile_row_bytes = SCALE_DATUM_SIZE(formats.pack_dst, TILE_C_DIM);
+    const std::uint32_t band_stride    = (params.FULL_CT_DIM * TILE_R_DIM * tile_row_bytes) / 16;
+    const std::uint32_t base_address   = L1_ADDRESS(params.buffer_Res[0]);
+
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, UNTILIZE, false>(formats.pack_src, formats.pack_dst, params.TILE_SIZE_PACK);
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    _llk_pack_untilize_init_runtime_(formats.pack_src, formats.pack_dst, params.BLOCK_CT_DIM, params.FULL_CT_DIM, FACE_R_DIM, 4);
+#else
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, UNTILIZE>(formats.pack_src, formats.pack_dst, params.TILE_SIZE_PACK);
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en, UNTILIZE>();
+    _llk_pack_untilize_init_runtime_(formats.pack_dst, params.BLOCK_CT_DIM, params.FULL_CT_DIM, FACE_R_DIM, 4);
+#endif
+
+    std::uint32_t programmed_ct_dim = params.BLOCK_CT_DIM;
+    for (std::uint32_t rt = 0; rt < params.FULL_RT_DIM; rt++)
+    {
+        for (std::uint32_t ct = 0; ct < params.FULL_CT_DIM; ct += params.BLOCK_CT_DIM)
+        {
+            const std::uint32_t block_ct_dim = std::min(params.BLOCK_CT_DIM, params.FULL_CT_DIM - ct);
+            // Only the tail block of a row band needs the mop reprogrammed
+            if (block_ct_dim != programmed_ct_dim)
+            {
+#ifdef ARCH_BLACKHOLE
+                _llk_pack_untilize_mop_config_runtime_(block_ct_dim, FACE_R_DIM, 4);
+#else
+                _llk_pack_untilize_mop_config_runtime_(block_ct_dim, params.FULL_CT_DIM, FACE_R_DIM, 4);
+#endif
+                programmed_ct_dim = block_ct_dim;
+            }
+
+            const std::uint32_t address = base_address + rt * band_stride + (ct * tile_row_bytes) / 16;
+
+            _llk_packer_wait_for_math_done_();
+#ifdef ARCH_BLACKHOLE
+            _llk_pack_untilize_runtime_(address, 4, 0);
+#else
+            _llk_pack_untilize_runtime_(address, formats.pack_dst, block_ct_dim, params.FULL_CT_DIM, FACE_R_DIM, 4, 0);
+#endif
+            _llk_pack_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+        }
+    }
+
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_untilize_uninit_(formats.pack_src);
+#else
+    _llk_pack_untilize_uninit_(FACE_R_DIM);
+#endif
+}
+
+#endif
@@ -26,9 +26,9 @@ void run_kernel(RUNTIME_PARAMETERS params)
 #endif
     _llk_unpack_hw_configure_<is_fp32_dest_acc_en>(
         formats.unpack_A_src, formats.unpack_B_src, formats.unpack_A_dst, formats.unpack_B_dst, FACE_R_DIM, FACE_R_DIM, 4 /*num_faces */, 4 /* num_faces */);
-    _llk_unpack_AB_sub_bcast_col_init_custom_<BROADCAST_TYPE>();
+    _llk_unpack_AB_bcast_reuse_init_custom_<BROADCAST_TYPE>();
 
-    _llk_unpack_AB_sub_bcast_col_custom_<BROADCAST_TYPE>(L1_ADDRESS(params.buffer_A[0]), L1_ADDRESS(params.buffer_B[0]), CT_DIM);
+    _llk_unpack_AB_bcast_reuse_custom_<BROADCAST_TYPE>(L1_ADDRESS(params.buffer_A[0]), L1_ADDRESS(params.buffer_B[0]), CT_DIM);
 }
 
 #endif
@@ -46,12 +46,12 @@ void run_kernel(RUNTIME_PARAMETERS params)
 #endif
     _llk_math_pack_sync_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
     _llk_math_hw_configure_<is_fp32_dest_acc_en>(formats.math, formats.math);
-    _llk_math_eltwise_binary_init_custom_<ELTWISE_BINARY_OP, BROADCAST_TYPE, MATH_FIDELITY>(4, 0);
+    _llk_math_eltwise_binary_bcast_reuse_init_custom_<ELTWISE_BINARY_OP, BROADCAST_TYPE, MATH_FIDELITY>();
 
     _llk_math_wait_for_dest_available_<DstSync::SyncHalf>();
 
     // call custom LLK
-    _llk_math_sub_bcast_cols_reuse_custom_(CT_DIM);
+    _llk_math_eltwise_binary_bcast_reuse_custom_<DstSync::SyncHalf, is_fp32_dest_acc_en>(0 /* dst_index */, CT_DIM);
 
     _llk_math_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
 }
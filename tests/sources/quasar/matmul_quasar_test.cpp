@@ -44,7 +44,8 @@ void run_kernel(RUNTIME_PARAMETERS params)
     tdma_desc_src_a.buf_desc.f.y_dim        = FACE_R_DIM;  // Default face dimension is 16, tiny tiles not supported for quasar
     tdma_desc_src_a.buf_desc.f.z_dim        = num_faces_A; // Number of faces = 4, tiny tiles not supported for quasar
     tdma_desc_src_a.buf_desc_id             = buf_desc_id_src_a;
-    tdma_desc_src_a.reg_data_format         = static_cast<std::uint32_t>(formats.unpack_A_dst);
+    tdma_desc_src_a.reg_data_format         = static_cast<std::uint32_t>(
+        _llk_unpack_matmul_src_reg_format_<MATMUL_EN_X2>(static_cast<DataFormat>(formats.unpack_A_src), static_cast<DataFormat>(formats.unpack_A_dst)));
 
     // src B input configuration
     tdma_descriptor_t tdma_desc_src_b;
@@ -55,7 +56,8 @@ void run_kernel(RUNTIME_PARAMETERS params)
     tdma_desc_src_b.buf_desc.f.y_dim        = FACE_R_DIM;  // Default face dimension is 16, tiny tiles not supported for quasar
     tdma_desc_src_b.buf_desc.f.z_dim        = num_faces_B; // Number of faces = 4, tiny tiles not supported for quasar
     tdma_desc_src_b.buf_desc_id             = buf_desc_id_src_b;
-    tdma_desc_src_b.reg_data_format         = static_cast<std::uint32_t>(formats.unpack_B_dst);
+    tdma_desc_src_b.reg_data_format         = static_cast<std::uint32_t>(
+        _llk_unpack_matmul_src_reg_format_<MATMUL_EN_X2>(static_cast<DataFormat>(formats.unpack_B_src), static_cast<DataFormat>(formats.unpack_B_dst)));
 
     _configure_buf_desc_table_(tdma_desc_src_a.buf_desc_id, tdma_desc_src_a.buf_desc);
     _configure_buf_desc_table_(tdma_desc_src_b.buf_desc_id, tdma_desc_src_b.buf_desc);
@@ -88,8 +90,8 @@ void run_kernel(RUNTIME_PARAMETERS params)
 
     _llk_math_srcAB_hw_configure_<IMPLIED_MATH_FORMAT, is_fp32_dest_acc_en, false>(
         static_cast<DataFormat>(formats.math), static_cast<DataFormat>(formats.math));
-    _llk_math_matmul_init_<(ckernel::MathFidelity)MATH_FIDELITY, false, false>(CT_DIM, RT_DIM); // disable flags for matmul with indexing and mxfp_2x not part
-                                                                                                // of P0 test suite
+    // Matmul with direct indexing is not part of the P0 test suite, MATMUL_EN_X2 must match the unpacker source register format
+    _llk_math_matmul_init_<(ckernel::MathFidelity)MATH_FIDELITY, false, MATMUL_EN_X2>(CT_DIM, RT_DIM);
 
     for (std::uint32_t i = 0; i < KT_DIM; i++)
     {
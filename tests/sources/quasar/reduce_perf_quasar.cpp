@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Math isolated reduce throughput on Quasar, unpack only marks the sources valid so the
+// reduce runs on whatever is in srcA/srcB, pack only takes part in the profiler zones.
+
+#include <cstdint>
+
+#include "ckernel.h"
+#include "llk_defs.h"
+#include "params.h"
+#include "perf.h"
+#include "profiler.h"
+#include "tensor_shape.h"
+
+#ifdef LLK_TRISC_UNPACK
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#ifndef SPEED_OF_LIGHT
+    const std::uint32_t LOOP_FACTOR = params.LOOP_FACTOR;
+    const std::uint32_t TILE_CNT    = params.TILE_CNT;
+#endif
+    {
+        ZONE_SCOPED("INIT")
+        PROFILER_SYNC();
+    }
+    {
+        ZONE_SCOPED("TILE_LOOP")
+        // Every tile releases srcA once per face and srcB once
+        for (std::uint32_t i = 0; i < LOOP_FACTOR * TILE_CNT; ++i)
+        {
+            _perf_unpack_loop_set_valid<true, true>(1);
+            _perf_unpack_loop_set_valid<true, false>(TILE_NUM_FACES - 1);
+        }
+        PROFILER_SYNC();
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+#include "llk_math_common.h"
+#include "llk_math_reduce.h"
+
+using namespace ckernel;
+
+constexpr std::uint32_t NUM_DEST_TILES = is_fp32_dest_acc_en ? DEST_NUM_TILES_FP16_HALF / 2 : DEST_NUM_TILES_FP16_HALF;
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+
+#ifndef SPEED_OF_LIGHT
+    const std::uint32_t LOOP_FACTOR = params.LOOP_FACTOR;
+    const std::uint32_t TILE_CNT    = params.TILE_CNT;
+#endif
+    {
+        ZONE_SCOPED("INIT")
+        DataFormat src_format = static_cast<DataFormat>(formats.math);
+        _llk_math_srcAB_hw_configure_<IMPLIED_MATH_FORMAT, is_fp32_dest_acc_en, IS_INT_FPU>(src_format, src_format);
+        _llk_math_reduce_init_<POOL_TYPE, REDUCE_DIM, MATH_FIDELITY, IS_INT_FPU>(ckernel::DEFAULT_TENSOR_SHAPE);
+        PROFILER_SYNC();
+    }
+    {
+        ZONE_SCOPED("TILE_LOOP")
+        for (std::uint32_t loop = 0; loop < LOOP_FACTOR; ++loop)
+        {
+            for (std::uint32_t i = 0; i < TILE_CNT; ++i)
+            {
+                _llk_math_reduce_<POOL_TYPE, REDUCE_DIM, IS_INT_FPU>(i % NUM_DEST_TILES);
+            }
+        }
+        wait_mop_idle();
+        wait_fpu_idle();
+        wait_sfpu_idle();
+        PROFILER_SYNC();
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+    (void)params;
+    {
+        ZONE_SCOPED("INIT")
+        PROFILER_SYNC();
+    }
+    {
+        ZONE_SCOPED("TILE_LOOP")
+        PROFILER_SYNC();
+    }
+}
+
+#endif
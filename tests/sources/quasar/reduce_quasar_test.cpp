@@ -84,11 +84,11 @@ void run_kernel(RUNTIME_PARAMETERS params)
 
     DataFormat src_format = static_cast<DataFormat>(formats.math);
 
-    _llk_math_srcAB_hw_configure_<IMPLIED_MATH_FORMAT, is_fp32_dest_acc_en, false /* int32 dest */>(src_format, src_format);
-    _llk_math_reduce_init_<POOL_TYPE, REDUCE_DIM, MATH_FIDELITY>(ckernel::DEFAULT_TENSOR_SHAPE); // tiny-tiles not yet supported with reduce
+    _llk_math_srcAB_hw_configure_<IMPLIED_MATH_FORMAT, is_fp32_dest_acc_en, IS_INT_FPU>(src_format, src_format);
+    _llk_math_reduce_init_<POOL_TYPE, REDUCE_DIM, MATH_FIDELITY, IS_INT_FPU>(ckernel::DEFAULT_TENSOR_SHAPE); // tiny-tiles not yet supported with reduce
     for (std::uint32_t i = 0; i < params.TILE_CNT; ++i)
     {
-        _llk_math_reduce_(i);
+        _llk_math_reduce_<POOL_TYPE, REDUCE_DIM, IS_INT_FPU>(i);
     }
     _llk_math_set_dvalid_<p_cleardvalid::FPU, dest_sync>();
 }
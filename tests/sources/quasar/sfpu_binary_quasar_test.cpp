@@ -0,0 +1,279 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+
+#include "ckernel.h"
+#include "llk_defs.h"
+#include "llk_memory_checks.h"
+#include "sfpu_stub.h"
+
+// Binary SFPU test: tile 0 holds the first operand and tile 1 the second, the result overwrites tile 0
+// WHERE takes the condition from tile 0, the true values from tile 1 and the false values from tile 2
+// Quantization takes the input from tile 0 and the scale from tile 1
+constexpr std::uint32_t IN0_TILE = 0;
+constexpr std::uint32_t IN1_TILE = 1;
+constexpr std::uint32_t IN2_TILE = 2;
+constexpr std::uint32_t OUT_TILE = 0;
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "llk_math_common.h"
+#include "llk_unpack_common.h"
+#include "llk_unpack_unary_operand.h"
+#include "params.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+    const std::uint32_t buf_desc_id          = 0;
+    const std::uint32_t num_tiles_per_unpack = params.TILE_CNT;
+
+    if (unpack_to_dest)
+    {
+        // Unpacking to DEST directly
+        set_up_dest_dvalid_per_thread<dest_dvalid_client::UNPACK>({dest_dvalid_client::UNPACK, dest_dvalid_client::SFPU, dest_dvalid_client::PACK});
+        if (static_cast<DataFormat>(formats.pack_src) == DataFormat::Int32)
+        {
+            _llk_math_upk_to_dest_hw_configure_<IMPLIED_MATH_FORMAT, false /*fp32_dest*/, true /*int32_dest*/>();
+        }
+        else
+        {
+            _llk_math_upk_to_dest_hw_configure_<IMPLIED_MATH_FORMAT, is_fp32_dest_acc_en, false /*int32_dest*/>();
+        }
+    }
+    else
+    {
+        set_up_dest_dvalid_per_thread<dest_dvalid_client::UNPACK>({dest_dvalid_client::FPU, dest_dvalid_client::SFPU, dest_dvalid_client::PACK});
+    }
+
+    buffer_descriptor_u bd_val = {0};
+
+    bd_val.f.l1_addr_16B = L1_ADDRESS(params.buffer_A[0]);
+    bd_val.f.format      = static_cast<std::uint8_t>(formats.unpack_A_src);
+    bd_val.f.x_dim       = params.TEST_FACE_C_DIM;
+    bd_val.f.y_dim       = params.TEST_FACE_R_DIM;
+    bd_val.f.z_dim       = params.num_faces;
+
+    tdma_descriptor_t td_val;
+    td_val.buf_desc        = bd_val;
+    td_val.buf_desc_id     = buf_desc_id;
+    td_val.reg_data_format = static_cast<std::uint8_t>(formats.unpack_A_dst);
+    _configure_buf_desc_table_(td_val.buf_desc_id, td_val.buf_desc);
+
+    if (is_fp32_dest_acc_en && !unpack_to_dest)
+    {
+        // If Dst fmt is 32b and operation is Mov2D, we need both SrcA/B fmts to be configured since Mov2D will be implemented via ELWADD
+        _llk_unpack_configure_binary_<p_unpacr::UNP_A, p_unpacr::UNP_B>(td_val, td_val);
+    }
+    else
+    {
+        _llk_unpack_configure_unary_<UNPACKER_ENGINE_SEL>(td_val);
+    }
+
+    _llk_unpack_unary_operand_init_<UNPACKER_ENGINE_SEL, false /*transpose*/, is_fp32_dest_acc_en>(buf_desc_id, num_tiles_per_unpack);
+    _llk_unpack_unary_operand_<UNPACKER_ENGINE_SEL>(0);
+
+    if (unpack_to_dest)
+    {
+        _llk_unpack_dest_dvalid_section_done_<dest_sync>();
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+const bool is_int_fpu_en = false;
+
+#include "cfg_defines.h"
+#include "cmath_common.h"
+#include "llk_math_common.h"
+#include "llk_math_eltwise_unary_datacopy.h"
+#include "llk_math_eltwise_unary_sfpu_common.h"
+#include "params.h"
+#include "sfpu/ckernel_sfpu_binary.h"
+#include "sfpu/ckernel_sfpu_binary_bitwise.h"
+#include "sfpu/ckernel_sfpu_quant.h"
+#include "sfpu/ckernel_sfpu_shift.h"
+#include "sfpu/ckernel_sfpu_where.h"
+
+using namespace ckernel;
+using namespace ckernel::math;
+using namespace ckernel::sfpu;
+
+// Zero point of the quantization ops, 3.0f, dequantization takes it negated
+constexpr std::uint32_t QUANT_ZERO_POINT   = 0x40400000;
+constexpr std::uint32_t DEQUANT_ZERO_POINT = 0xC0400000;
+
+inline void init_sfpu_binary_op()
+{
+    constexpr SfpuType op = SFPU_UNARY_OPERATION;
+    if constexpr (op == SfpuType::quant_int32 || op == SfpuType::requant_int32)
+    {
+        _init_quant_zero_point_(QUANT_ZERO_POINT);
+    }
+    else if constexpr (op == SfpuType::dequant_int32)
+    {
+        _init_quant_zero_point_(DEQUANT_ZERO_POINT);
+    }
+}
+
+// SfpuType::add runs the BinaryOp selected by SFPU_BINARY_OPERATION, the other ops are selected by their SfpuType
+template <std::uint32_t SFPMEM_TYPE>
+inline void call_sfpu_binary_op(const std::uint32_t tile_idx, const int iterations)
+{
+    constexpr SfpuType op        = SFPU_UNARY_OPERATION;
+    constexpr BinaryOp binary_op = SFPU_BINARY_OPERATION;
+    if constexpr (op == SfpuType::bitwise_and)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_sfpu_binary_bitwise_<BinaryBitwiseOp::AND>, tile_idx, iterations, IN0_TILE, IN1_TILE, OUT_TILE);
+    }
+    else if constexpr (op == SfpuType::bitwise_or)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_sfpu_binary_bitwise_<BinaryBitwiseOp::OR>, tile_idx, iterations, IN0_TILE, IN1_TILE, OUT_TILE);
+    }
+    else if constexpr (op == SfpuType::bitwise_xor)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_sfpu_binary_bitwise_<BinaryBitwiseOp::XOR>, tile_idx, iterations, IN0_TILE, IN1_TILE, OUT_TILE);
+    }
+    else if constexpr (op == SfpuType::where)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_where_<SFPMEM_TYPE>, tile_idx, iterations, IN0_TILE, IN1_TILE, IN2_TILE, OUT_TILE);
+    }
+    else if constexpr (op == SfpuType::quant_int32)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_quant_int32_, tile_idx, iterations, IN0_TILE, IN1_TILE, OUT_TILE);
+    }
+    else if constexpr (op == SfpuType::requant_int32)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_requant_int32_, tile_idx, iterations, IN0_TILE, IN1_TILE, OUT_TILE);
+    }
+    else if constexpr (op == SfpuType::dequant_int32)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_dequant_int32_, tile_idx, iterations, IN0_TILE, IN1_TILE, OUT_TILE);
+    }
+    else if constexpr (binary_op == BinaryOp::LSHFT || binary_op == BinaryOp::RSHFT || binary_op == BinaryOp::LOGICAL_RSHFT)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_sfpu_binary_shift_<binary_op>, tile_idx, iterations, IN0_TILE, IN1_TILE, OUT_TILE);
+    }
+    else
+    {
+        static_assert(op == SfpuType::add, "SFPU op not covered by the Quasar binary SFPU test");
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_sfpu_binary_<binary_op>, tile_idx, iterations, IN0_TILE, IN1_TILE, OUT_TILE);
+    }
+}
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+    // Setup dvalid for MATH kernel
+    if (unpack_to_dest)
+    {
+        // Chain must match UNPACK's chain: {UNPACK, SFPU, PACK}
+        set_up_dest_dvalid_per_thread<dest_dvalid_client::SFPU>({dest_dvalid_client::UNPACK, dest_dvalid_client::SFPU, dest_dvalid_client::PACK});
+    }
+    else
+    {
+        set_up_dest_dvalid_per_thread<dest_dvalid_client::FPU>({dest_dvalid_client::FPU, dest_dvalid_client::SFPU, dest_dvalid_client::PACK});
+        set_up_dest_dvalid_per_thread<dest_dvalid_client::SFPU>({dest_dvalid_client::FPU, dest_dvalid_client::SFPU, dest_dvalid_client::PACK});
+    }
+
+    DataFormat src_format    = static_cast<DataFormat>(formats.math);
+    const bool is_int32_dest = static_cast<DataFormat>(formats.pack_src) == DataFormat::Int32;
+    if (is_int32_dest)
+    {
+        _llk_math_srcAB_hw_configure_<IMPLIED_MATH_FORMAT, false /*fp32_dest*/, true /*int32_dest*/>(src_format, src_format);
+    }
+    else
+    {
+        _llk_math_srcAB_hw_configure_<IMPLIED_MATH_FORMAT, is_fp32_dest_acc_en, is_int_fpu_en>(src_format, src_format);
+    }
+
+    const std::uint32_t num_sfpu_iterations = params.TEST_FACE_R_DIM / ckernel::math::SFP_ROWS;
+
+    if (!unpack_to_dest)
+    {
+        const std::uint32_t num_rows = params.num_faces * params.TEST_FACE_R_DIM;
+        _llk_math_eltwise_unary_datacopy_init_<DATA_COPY_TYPE, is_fp32_dest_acc_en>(num_rows, 1);
+
+        // Datacopy both operand tiles from SRC to DEST
+        for (std::uint32_t i = 0; i < params.TILE_CNT; ++i)
+        {
+            _llk_math_eltwise_unary_datacopy_(num_rows, params.DST_INDEX + i);
+        }
+
+        _llk_math_set_dvalid_<p_cleardvalid::FPU, dest_sync>();
+    }
+
+    _llk_math_eltwise_unary_sfpu_init_();
+    init_sfpu_binary_op();
+    // Operand tile indices are relative to DST_INDEX, which is where the SFPU starts
+    if (is_int32_dest)
+    {
+        call_sfpu_binary_op<p_sfpu::sfpmem::INT32>(params.DST_INDEX, static_cast<int>(num_sfpu_iterations));
+    }
+    else
+    {
+        call_sfpu_binary_op<p_sfpu::sfpmem::DEFAULT>(params.DST_INDEX, static_cast<int>(num_sfpu_iterations));
+    }
+
+    _llk_math_set_dvalid_<p_cleardvalid::SFPU, dest_sync>();
+
+    // Wait for all operations to complete
+    wait_sfpu_idle();
+    wait_fpu_idle();
+    wait_mop_idle();
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+#include "cfg_defines.h"
+#include "llk_pack.h"
+#include "llk_pack_common.h"
+#include "params.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+    std::uint32_t const buf_desc_id        = 8;
+    const std::uint32_t num_tiles_per_pack = 1; // only the result tile is packed
+
+    // Setup dvalid for PACK
+    if (unpack_to_dest)
+    {
+        set_up_dest_dvalid_per_thread<dest_dvalid_client::PACK>({dest_dvalid_client::UNPACK, dest_dvalid_client::SFPU, dest_dvalid_client::PACK});
+    }
+    else
+    {
+        set_up_dest_dvalid_per_thread<dest_dvalid_client::PACK>({dest_dvalid_client::FPU, dest_dvalid_client::SFPU, dest_dvalid_client::PACK});
+    }
+
+    buffer_descriptor_u bd_val = {0};
+    bd_val.f.l1_addr_16B       = params.buffer_Res[0] / 16;
+    bd_val.f.format            = static_cast<std::uint8_t>(formats.pack_dst);
+    bd_val.f.x_dim             = params.TEST_FACE_C_DIM;
+    bd_val.f.y_dim             = params.TEST_FACE_R_DIM;
+    bd_val.f.z_dim             = params.num_faces;
+
+    tdma_descriptor_t tdma_desc;
+    tdma_desc.buf_desc        = bd_val;
+    tdma_desc.buf_desc_id     = buf_desc_id;
+    tdma_desc.reg_data_format = static_cast<std::uint8_t>(formats.pack_src);
+    _configure_buf_desc_table_(tdma_desc.buf_desc_id, tdma_desc.buf_desc);
+
+    _llk_pack_hw_configure_<p_pacr::PACK0>(tdma_desc);
+    _llk_pack_init_(buf_desc_id, num_tiles_per_pack);
+    _llk_pack_(params.DST_INDEX + OUT_TILE, 0);
+    _llk_pack_dest_dvalid_section_done_<dest_sync, is_fp32_dest_acc_en>();
+}
+#endif
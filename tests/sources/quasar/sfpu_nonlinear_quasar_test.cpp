@@ -82,8 +82,11 @@ const bool is_int_fpu_en = false;
 #include "params.h"
 
 // Include all necessary SFPU headers
+#include "sfpu/ckernel_sfpu_abs.h"
 #include "sfpu/ckernel_sfpu_exp.h"
 #include "sfpu/ckernel_sfpu_gelu.h"
+#include "sfpu/ckernel_sfpu_log.h"
+#include "sfpu/ckernel_sfpu_negative.h"
 #include "sfpu/ckernel_sfpu_recip.h"
 #include "sfpu/ckernel_sfpu_relu.h"
 #include "sfpu/ckernel_sfpu_sigmoid.h"
@@ -177,6 +180,38 @@ struct sfpu_op_dispatcher<SfpuType::silu>
     }
 };
 
+template <>
+struct sfpu_op_dispatcher<SfpuType::log>
+{
+    static void init()
+    {
+        _init_log_();
+    }
+
+    static void call(int tile_idx, int num_sfpu_iterations)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_log_, tile_idx, num_sfpu_iterations);
+    }
+};
+
+template <>
+struct sfpu_op_dispatcher<SfpuType::abs>
+{
+    static void call(int tile_idx, int num_sfpu_iterations)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_abs_, tile_idx, num_sfpu_iterations);
+    }
+};
+
+template <>
+struct sfpu_op_dispatcher<SfpuType::neg>
+{
+    static void call(int tile_idx, int num_sfpu_iterations)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_negative_, tile_idx, num_sfpu_iterations);
+    }
+};
+
 // Convert constexpr SFPU_UNARY_OPERATION to template parameter using tag dispatch
 inline void call_sfpu_operation_quasar(int tile_idx, int num_sfpu_iterations)
 {
@@ -208,6 +243,15 @@ inline void call_sfpu_operation_quasar(int tile_idx, int num_sfpu_iterations)
         case SfpuType::silu:
             sfpu_op_dispatcher<SfpuType::silu>::call(tile_idx, num_sfpu_iterations);
             break;
+        case SfpuType::log:
+            sfpu_op_dispatcher<SfpuType::log>::call(tile_idx, num_sfpu_iterations);
+            break;
+        case SfpuType::abs:
+            sfpu_op_dispatcher<SfpuType::abs>::call(tile_idx, num_sfpu_iterations);
+            break;
+        case SfpuType::neg:
+            sfpu_op_dispatcher<SfpuType::neg>::call(tile_idx, num_sfpu_iterations);
+            break;
         default:
             break;
     }
@@ -221,6 +265,9 @@ inline void init_sfpu_operation_quasar()
         case SfpuType::gelu:
             sfpu_op_dispatcher<SfpuType::gelu>::init();
             break;
+        case SfpuType::log:
+            sfpu_op_dispatcher<SfpuType::log>::init();
+            break;
         default:
             break;
     }
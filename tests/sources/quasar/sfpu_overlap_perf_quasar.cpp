@@ -0,0 +1,239 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// L1 to L1 datacopy followed by SFPU square, one tile per dest section. With SFPU_OVERLAP the
+// SFPU runs on TRISC3 and overlaps the datacopy of the next tile, otherwise MATH runs it inline.
+
+#include <cstdint>
+
+#include "ckernel.h"
+#include "llk_defs.h"
+#include "params.h"
+#include "perf.h"
+#include "profiler.h"
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "llk_unpack_common.h"
+#include "llk_unpack_unary_operand.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+#ifndef SPEED_OF_LIGHT
+    const std::uint32_t LOOP_FACTOR = params.LOOP_FACTOR;
+    const std::uint32_t TILE_CNT    = params.TILE_CNT;
+#endif
+    const std::uint32_t buf_desc_id = 0;
+
+    {
+        ZONE_SCOPED("INIT")
+        buffer_descriptor_u bd_val = {0};
+        bd_val.f.l1_addr_16B       = L1_ADDRESS(params.buffer_A[0]);
+        bd_val.f.format            = static_cast<std::uint8_t>(formats.unpack_A_src);
+        bd_val.f.x_dim             = FACE_C_DIM;
+        bd_val.f.y_dim             = FACE_R_DIM;
+        bd_val.f.z_dim             = TILE_NUM_FACES;
+
+        tdma_descriptor_t td_val;
+        td_val.buf_desc        = bd_val;
+        td_val.buf_desc_id     = buf_desc_id;
+        td_val.reg_data_format = static_cast<std::uint8_t>(formats.unpack_A_dst);
+        _configure_buf_desc_table_(td_val.buf_desc_id, td_val.buf_desc);
+
+        _llk_unpack_configure_unary_<p_unpacr::UNP_A>(td_val);
+        _llk_unpack_unary_operand_init_<p_unpacr::UNP_A, false /*transpose*/, is_fp32_dest_acc_en>(buf_desc_id, 1 /*num_tiles*/);
+        PROFILER_SYNC();
+    }
+    {
+        ZONE_SCOPED("TILE_LOOP")
+        for (std::uint32_t loop = 0; loop < LOOP_FACTOR; ++loop)
+        {
+            for (std::uint32_t i = 0; i < TILE_CNT; ++i)
+            {
+                _llk_unpack_unary_operand_<p_unpacr::UNP_A>(i);
+            }
+        }
+        PROFILER_SYNC();
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+const bool is_int_fpu_en = false;
+
+#include "cmath_common.h"
+#include "llk_math_common.h"
+#include "llk_math_eltwise_unary_datacopy.h"
+#include "llk_math_eltwise_unary_sfpu_common.h"
+#include "sfpu/ckernel_sfpu_square.h"
+
+using namespace ckernel;
+using namespace ckernel::math;
+using namespace ckernel::sfpu;
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+#ifndef SPEED_OF_LIGHT
+    const std::uint32_t LOOP_FACTOR = params.LOOP_FACTOR;
+    const std::uint32_t TILE_CNT    = params.TILE_CNT;
+#endif
+    constexpr std::uint32_t num_rows  = TILE_NUM_FACES * FACE_R_DIM;
+    constexpr int num_sfpu_iterations = FACE_R_DIM / SFP_ROWS;
+
+    {
+        ZONE_SCOPED("INIT")
+        DataFormat src_format = static_cast<DataFormat>(formats.math);
+        _llk_math_srcAB_hw_configure_<IMPLIED_MATH_FORMAT, is_fp32_dest_acc_en, is_int_fpu_en>(src_format, src_format);
+        if constexpr (SFPU_OVERLAP)
+        {
+            _llk_math_sfpu_pack_sync_init_<dest_sync>();
+        }
+        else
+        {
+            _llk_math_pack_sync_init_<dest_sync>();
+            _llk_math_eltwise_unary_sfpu_init_();
+        }
+        _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en>(num_rows, 1);
+        PROFILER_SYNC();
+    }
+    {
+        ZONE_SCOPED("TILE_LOOP")
+        for (std::uint32_t loop = 0; loop < LOOP_FACTOR; ++loop)
+        {
+            for (std::uint32_t i = 0; i < TILE_CNT; ++i)
+            {
+                _llk_math_wait_for_dest_available_();
+                _llk_math_eltwise_unary_datacopy_(num_rows, 0 /*dest_idx*/);
+                if constexpr (SFPU_OVERLAP)
+                {
+                    _llk_math_dest_section_done_to_sfpu_<dest_sync, is_fp32_dest_acc_en>();
+                }
+                else
+                {
+                    _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_square_, 0 /*dest_idx*/, num_sfpu_iterations);
+                    _llk_math_dest_section_done_<dest_sync, is_fp32_dest_acc_en>();
+                }
+            }
+        }
+        PROFILER_SYNC();
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_ISOLATE_SFPU
+
+#include "cmath_common.h"
+#include "llk_math_eltwise_unary_sfpu_common.h"
+#include "sfpu/ckernel_sfpu_square.h"
+
+using namespace ckernel;
+using namespace ckernel::math;
+using namespace ckernel::sfpu;
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#ifndef SPEED_OF_LIGHT
+    const std::uint32_t LOOP_FACTOR = params.LOOP_FACTOR;
+    const std::uint32_t TILE_CNT    = params.TILE_CNT;
+#endif
+    constexpr int num_sfpu_iterations = FACE_R_DIM / SFP_ROWS;
+
+    {
+        ZONE_SCOPED("INIT")
+        if constexpr (SFPU_OVERLAP)
+        {
+            _llk_math_sfpu_sync_init_();
+            _llk_math_eltwise_unary_sfpu_init_();
+        }
+        PROFILER_SYNC();
+    }
+    {
+        ZONE_SCOPED("TILE_LOOP")
+        if constexpr (SFPU_OVERLAP)
+        {
+            for (std::uint32_t loop = 0; loop < LOOP_FACTOR; ++loop)
+            {
+                for (std::uint32_t i = 0; i < TILE_CNT; ++i)
+                {
+                    _llk_math_sfpu_wait_for_dest_section_();
+                    _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_square_, 0 /*dest_idx*/, num_sfpu_iterations);
+                    _llk_math_sfpu_dest_section_done_<dest_sync, is_fp32_dest_acc_en>();
+                }
+            }
+        }
+        PROFILER_SYNC();
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+#include "llk_pack.h"
+#include "llk_pack_common.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+#ifndef SPEED_OF_LIGHT
+    const std::uint32_t LOOP_FACTOR = params.LOOP_FACTOR;
+    const std::uint32_t TILE_CNT    = params.TILE_CNT;
+#endif
+    std::uint32_t const buf_desc_id = 8;
+
+    {
+        ZONE_SCOPED("INIT")
+        buffer_descriptor_u bd_val = {0};
+        bd_val.f.l1_addr_16B       = L1_ADDRESS(params.buffer_Res[0]);
+        bd_val.f.format            = static_cast<std::uint8_t>(formats.pack_dst);
+        bd_val.f.x_dim             = FACE_C_DIM;
+        bd_val.f.y_dim             = FACE_R_DIM;
+        bd_val.f.z_dim             = TILE_NUM_FACES;
+
+        tdma_descriptor_t tdma_desc;
+        tdma_desc.buf_desc        = bd_val;
+        tdma_desc.buf_desc_id     = buf_desc_id;
+        tdma_desc.reg_data_format = static_cast<std::uint8_t>(formats.pack_src);
+        _configure_buf_desc_table_(tdma_desc.buf_desc_id, tdma_desc.buf_desc);
+
+        _llk_pack_hw_configure_<p_pacr::PACK0>(tdma_desc);
+        _llk_pack_init_<is_fp32_dest_acc_en>(buf_desc_id, 1 /*num_tiles_per_pack*/);
+        PROFILER_SYNC();
+    }
+    {
+        ZONE_SCOPED("TILE_LOOP")
+        for (std::uint32_t loop = 0; loop < LOOP_FACTOR; ++loop)
+        {
+            for (std::uint32_t i = 0; i < TILE_CNT; ++i)
+            {
+                if constexpr (SFPU_OVERLAP)
+                {
+                    _llk_packer_wait_for_sfpu_done_();
+                    _llk_pack_(0 /*dest_idx*/, i);
+                    _llk_pack_sfpu_dest_semaphore_section_done_<p_pacr::PACK0, dest_sync, is_fp32_dest_acc_en>();
+                }
+                else
+                {
+                    _llk_packer_wait_for_math_done_();
+                    _llk_pack_(0 /*dest_idx*/, i);
+                    _llk_pack_dest_semaphore_section_done_<p_pacr::PACK0, dest_sync, is_fp32_dest_acc_en>();
+                }
+            }
+        }
+        PROFILER_SYNC();
+    }
+}
+
+#endif
@@ -0,0 +1,201 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Math isolated SFPU throughput on Quasar, the SFPU op runs on whatever is in dest,
+// unpack and pack only take part in the profiler zones.
+
+#include <cstdint>
+
+#include "ckernel.h"
+#include "llk_defs.h"
+#include "params.h"
+#include "perf.h"
+#include "profiler.h"
+#include "sfpu_stub.h"
+
+#ifdef LLK_TRISC_UNPACK
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+    (void)params;
+    {
+        ZONE_SCOPED("INIT")
+        PROFILER_SYNC();
+    }
+    {
+        ZONE_SCOPED("TILE_LOOP")
+        PROFILER_SYNC();
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+const bool is_int_fpu_en = false;
+
+#include "ckernel_sfpu.h"
+#include "cmath_common.h"
+#include "llk_math_common.h"
+#include "llk_math_eltwise_unary_sfpu_common.h"
+
+using namespace ckernel;
+using namespace ckernel::math;
+using namespace ckernel::sfpu;
+
+// Multi operand ops read their operands from the tiles following the one the SFPU starts on
+constexpr std::uint32_t NUM_OPERAND_TILES = 3;
+
+inline void init_sfpu_perf_op()
+{
+    if constexpr (SFPU_UNARY_OPERATION == SfpuType::log)
+    {
+        _init_log_();
+    }
+    else if constexpr (SFPU_UNARY_OPERATION == SfpuType::dropout)
+    {
+        _init_dropout_(0xDEADBEEF);
+    }
+    else if constexpr (
+        SFPU_UNARY_OPERATION == SfpuType::quant_int32 || SFPU_UNARY_OPERATION == SfpuType::requant_int32 ||
+        SFPU_UNARY_OPERATION == SfpuType::dequant_int32)
+    {
+        _init_quant_zero_point_(0x40400000u /* 3.0f */);
+    }
+}
+
+inline void call_sfpu_perf_op(const std::uint32_t tile_idx, const int iterations)
+{
+    constexpr SfpuType op = SFPU_UNARY_OPERATION;
+    if constexpr (op == SfpuType::exponential)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_exp_<true>, tile_idx, iterations);
+    }
+    else if constexpr (op == SfpuType::log)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_log_, tile_idx, iterations);
+    }
+    else if constexpr (op == SfpuType::abs)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_abs_, tile_idx, iterations);
+    }
+    else if constexpr (op == SfpuType::neg)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_negative_, tile_idx, iterations);
+    }
+    else if constexpr (op == SfpuType::fill)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_fill_<p_sfpu::sfpmem::DEFAULT>, tile_idx, iterations, 0x3F800000u /* 1.0f */);
+    }
+    else if constexpr (
+        op == SfpuType::equal_zero || op == SfpuType::not_equal_zero || op == SfpuType::less_than_zero || op == SfpuType::greater_than_equal_zero ||
+        op == SfpuType::less_than_equal_zero || op == SfpuType::greater_than_zero)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_zero_comp_<op>, tile_idx, iterations);
+    }
+    else if constexpr (op == SfpuType::typecast)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_typecast_fp32_to_fp16b_, tile_idx, iterations);
+    }
+    else if constexpr (op == SfpuType::dropout)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_dropout_, tile_idx, iterations, 0x20000000u /* 0.25 */, 0x3FAAAAABu /* 4/3 */);
+    }
+    else if constexpr (op == SfpuType::quant_int32)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_quant_int32_, tile_idx, iterations, 0u, 1u, 0u);
+    }
+    else if constexpr (op == SfpuType::requant_int32)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_requant_int32_, tile_idx, iterations, 0u, 1u, 0u);
+    }
+    else if constexpr (op == SfpuType::dequant_int32)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_dequant_int32_, tile_idx, iterations, 0u, 1u, 0u);
+    }
+    else if constexpr (
+        op == SfpuType::add &&
+        (SFPU_BINARY_OPERATION == BinaryOp::LSHFT || SFPU_BINARY_OPERATION == BinaryOp::RSHFT || SFPU_BINARY_OPERATION == BinaryOp::LOGICAL_RSHFT))
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_sfpu_binary_shift_<SFPU_BINARY_OPERATION>, tile_idx, iterations, 0u, 1u, 0u);
+    }
+    else if constexpr (op == SfpuType::add)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_sfpu_binary_<SFPU_BINARY_OPERATION>, tile_idx, iterations, 0u, 1u, 0u);
+    }
+    else if constexpr (op == SfpuType::bitwise_and)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_sfpu_binary_bitwise_<BinaryBitwiseOp::AND>, tile_idx, iterations, 0u, 1u, 0u);
+    }
+    else if constexpr (op == SfpuType::bitwise_or)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_sfpu_binary_bitwise_<BinaryBitwiseOp::OR>, tile_idx, iterations, 0u, 1u, 0u);
+    }
+    else if constexpr (op == SfpuType::bitwise_xor)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_sfpu_binary_bitwise_<BinaryBitwiseOp::XOR>, tile_idx, iterations, 0u, 1u, 0u);
+    }
+    else if constexpr (op == SfpuType::where)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_where_<>, tile_idx, iterations, 0u, 1u, 2u, 0u);
+    }
+    else
+    {
+        static_assert(op == SfpuType::exponential, "SFPU op not covered by the Quasar SFPU perf test");
+    }
+}
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+
+#ifndef SPEED_OF_LIGHT
+    const std::uint32_t LOOP_FACTOR = params.LOOP_FACTOR;
+    const std::uint32_t TILE_CNT    = params.TILE_CNT;
+#endif
+    const int num_sfpu_iterations       = FACE_R_DIM / ckernel::math::SFP_ROWS;
+    constexpr std::uint32_t num_op_sets = DEST_NUM_TILES_FP16_HALF / NUM_OPERAND_TILES;
+
+    {
+        ZONE_SCOPED("INIT")
+        DataFormat src_format = static_cast<DataFormat>(formats.math);
+        _llk_math_srcAB_hw_configure_<IMPLIED_MATH_FORMAT, is_fp32_dest_acc_en, is_int_fpu_en>(src_format, src_format);
+        _llk_math_eltwise_unary_sfpu_init_();
+        init_sfpu_perf_op();
+        PROFILER_SYNC();
+    }
+    {
+        ZONE_SCOPED("TILE_LOOP")
+        for (std::uint32_t loop = 0; loop < LOOP_FACTOR; ++loop)
+        {
+            for (std::uint32_t i = 0; i < TILE_CNT; ++i)
+            {
+                call_sfpu_perf_op((i % num_op_sets) * NUM_OPERAND_TILES, num_sfpu_iterations);
+            }
+        }
+        wait_sfpu_idle();
+        PROFILER_SYNC();
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+    (void)params;
+    {
+        ZONE_SCOPED("INIT")
+        PROFILER_SYNC();
+    }
+    {
+        ZONE_SCOPED("TILE_LOOP")
+        PROFILER_SYNC();
+    }
+}
+
+#endif
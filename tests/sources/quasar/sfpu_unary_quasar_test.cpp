@@ -0,0 +1,298 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+
+#include "ckernel.h"
+#include "llk_defs.h"
+#include "llk_memory_checks.h"
+#include "sfpu_stub.h"
+
+// Unary SFPU test for the fill, comparison with zero, typecast and dropout kernels, the op runs on every tile in place
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "llk_math_common.h"
+#include "llk_unpack_common.h"
+#include "llk_unpack_unary_operand.h"
+#include "params.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+    const std::uint32_t buf_desc_id          = 0;
+    const std::uint32_t num_tiles_per_unpack = params.TILE_CNT;
+
+    if (unpack_to_dest)
+    {
+        // Unpacking to DEST directly
+        set_up_dest_dvalid_per_thread<dest_dvalid_client::UNPACK>({dest_dvalid_client::UNPACK, dest_dvalid_client::SFPU, dest_dvalid_client::PACK});
+        if (static_cast<DataFormat>(formats.pack_src) == DataFormat::Int32)
+        {
+            _llk_math_upk_to_dest_hw_configure_<IMPLIED_MATH_FORMAT, false /*fp32_dest*/, true /*int32_dest*/>();
+        }
+        else
+        {
+            _llk_math_upk_to_dest_hw_configure_<IMPLIED_MATH_FORMAT, is_fp32_dest_acc_en, false /*int32_dest*/>();
+        }
+    }
+    else
+    {
+        set_up_dest_dvalid_per_thread<dest_dvalid_client::UNPACK>({dest_dvalid_client::FPU, dest_dvalid_client::SFPU, dest_dvalid_client::PACK});
+    }
+
+    buffer_descriptor_u bd_val = {0};
+
+    bd_val.f.l1_addr_16B = L1_ADDRESS(params.buffer_A[0]);
+    bd_val.f.format      = static_cast<std::uint8_t>(formats.unpack_A_src);
+    bd_val.f.x_dim       = params.TEST_FACE_C_DIM;
+    bd_val.f.y_dim       = params.TEST_FACE_R_DIM;
+    bd_val.f.z_dim       = params.num_faces;
+
+    tdma_descriptor_t td_val;
+    td_val.buf_desc        = bd_val;
+    td_val.buf_desc_id     = buf_desc_id;
+    td_val.reg_data_format = static_cast<std::uint8_t>(formats.unpack_A_dst);
+    _configure_buf_desc_table_(td_val.buf_desc_id, td_val.buf_desc);
+
+    if (is_fp32_dest_acc_en && !unpack_to_dest)
+    {
+        // If Dst fmt is 32b and operation is Mov2D, we need both SrcA/B fmts to be configured since Mov2D will be implemented via ELWADD
+        _llk_unpack_configure_binary_<p_unpacr::UNP_A, p_unpacr::UNP_B>(td_val, td_val);
+    }
+    else
+    {
+        _llk_unpack_configure_unary_<UNPACKER_ENGINE_SEL>(td_val);
+    }
+
+    _llk_unpack_unary_operand_init_<UNPACKER_ENGINE_SEL, false /*transpose*/, is_fp32_dest_acc_en>(buf_desc_id, num_tiles_per_unpack);
+    _llk_unpack_unary_operand_<UNPACKER_ENGINE_SEL>(0);
+
+    if (unpack_to_dest)
+    {
+        _llk_unpack_dest_dvalid_section_done_<dest_sync>();
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+const bool is_int_fpu_en = false;
+
+#include "cfg_defines.h"
+#include "cmath_common.h"
+#include "llk_math_common.h"
+#include "llk_math_eltwise_unary_datacopy.h"
+#include "llk_math_eltwise_unary_sfpu_common.h"
+#include "params.h"
+#include "sfpu/ckernel_sfpu_comp.h"
+#include "sfpu/ckernel_sfpu_dropout.h"
+#include "sfpu/ckernel_sfpu_fill.h"
+#include "sfpu/ckernel_sfpu_typecast_fp32_fp16b.h"
+#include "sfpu/ckernel_sfpu_typecast_fp32_int32.h"
+#include "sfpu/ckernel_sfpu_typecast_fp32_uint16.h"
+#include "sfpu/ckernel_sfpu_typecast_int32_fp16b.h"
+#include "sfpu/ckernel_sfpu_typecast_int32_fp32.h"
+#include "sfpu/ckernel_sfpu_typecast_int32_uint16.h"
+#include "sfpu/ckernel_sfpu_typecast_uint16_fp16b.h"
+#include "sfpu/ckernel_sfpu_typecast_uint16_fp32.h"
+
+using namespace ckernel;
+using namespace ckernel::math;
+using namespace ckernel::sfpu;
+
+// Fill values, -2.5f for float tiles and -5 in sign-magnitude for Int32 tiles
+constexpr std::uint32_t FILL_VALUE_FP32  = 0xC0200000;
+constexpr std::uint32_t FILL_VALUE_INT32 = 0x80000005;
+
+// Dropout drops a quarter of the datums (0.25 * 2^31) and scales the rest by 4/3
+constexpr std::uint32_t DROPOUT_PROBABILITY = 0x20000000;
+constexpr std::uint32_t DROPOUT_SCALE       = 0x3FAAAAAB;
+constexpr std::uint32_t DROPOUT_SEED        = 0xDEADBEEF;
+
+inline void init_sfpu_unary_op()
+{
+    if constexpr (SFPU_UNARY_OPERATION == SfpuType::dropout)
+    {
+        _init_dropout_(DROPOUT_SEED);
+    }
+}
+
+// The typecast is selected by TYPECAST_SRC_FORMAT and TYPECAST_DST_FORMAT
+inline void call_sfpu_unary_op(const std::uint32_t tile_idx, const int iterations, const DataFormat dest_format)
+{
+    constexpr SfpuType op = SFPU_UNARY_OPERATION;
+    if constexpr (op == SfpuType::fill)
+    {
+        if (dest_format == DataFormat::Int32)
+        {
+            _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_fill_<p_sfpu::sfpmem::INT32>, tile_idx, iterations, FILL_VALUE_INT32);
+        }
+        else
+        {
+            _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_fill_<p_sfpu::sfpmem::DEFAULT>, tile_idx, iterations, FILL_VALUE_FP32);
+        }
+    }
+    else if constexpr (
+        op == SfpuType::equal_zero || op == SfpuType::not_equal_zero || op == SfpuType::less_than_zero || op == SfpuType::greater_than_equal_zero ||
+        op == SfpuType::less_than_equal_zero || op == SfpuType::greater_than_zero)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_zero_comp_<op>, tile_idx, iterations);
+    }
+    else if constexpr (op == SfpuType::typecast)
+    {
+        constexpr DataFormat src = TYPECAST_SRC_FORMAT;
+        constexpr DataFormat dst = TYPECAST_DST_FORMAT;
+        if constexpr (src == DataFormat::Float32 && dst == DataFormat::Float16_b)
+        {
+            _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_typecast_fp32_to_fp16b_, tile_idx, iterations);
+        }
+        else if constexpr (src == DataFormat::Float32 && dst == DataFormat::Int32)
+        {
+            _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_typecast_fp32_to_int32_, tile_idx, iterations);
+        }
+        else if constexpr (src == DataFormat::Float32 && dst == DataFormat::UInt16)
+        {
+            _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_typecast_fp32_to_uint16_, tile_idx, iterations);
+        }
+        else if constexpr (src == DataFormat::Int32 && dst == DataFormat::Float16_b)
+        {
+            _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_typecast_int32_to_fp16b_, tile_idx, iterations);
+        }
+        else if constexpr (src == DataFormat::Int32 && dst == DataFormat::Float32)
+        {
+            _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_typecast_int32_to_fp32_, tile_idx, iterations);
+        }
+        else if constexpr (src == DataFormat::Int32 && dst == DataFormat::UInt16)
+        {
+            _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_typecast_int32_to_uint16_, tile_idx, iterations);
+        }
+        else if constexpr (src == DataFormat::UInt16 && dst == DataFormat::Float16_b)
+        {
+            _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_typecast_uint16_to_fp16b_, tile_idx, iterations);
+        }
+        else
+        {
+            static_assert(src == DataFormat::UInt16 && dst == DataFormat::Float32, "Typecast not covered by the Quasar unary SFPU test");
+            _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_typecast_uint16_to_fp32_, tile_idx, iterations);
+        }
+    }
+    else if constexpr (op == SfpuType::dropout)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_dropout_, tile_idx, iterations, DROPOUT_PROBABILITY, DROPOUT_SCALE);
+    }
+    else
+    {
+        static_assert(op == SfpuType::fill, "SFPU op not covered by the Quasar unary SFPU test");
+    }
+}
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+    // Setup dvalid for MATH kernel
+    if (unpack_to_dest)
+    {
+        // Chain must match UNPACK's chain: {UNPACK, SFPU, PACK}
+        set_up_dest_dvalid_per_thread<dest_dvalid_client::SFPU>({dest_dvalid_client::UNPACK, dest_dvalid_client::SFPU, dest_dvalid_client::PACK});
+    }
+    else
+    {
+        set_up_dest_dvalid_per_thread<dest_dvalid_client::FPU>({dest_dvalid_client::FPU, dest_dvalid_client::SFPU, dest_dvalid_client::PACK});
+        set_up_dest_dvalid_per_thread<dest_dvalid_client::SFPU>({dest_dvalid_client::FPU, dest_dvalid_client::SFPU, dest_dvalid_client::PACK});
+    }
+
+    DataFormat src_format  = static_cast<DataFormat>(formats.math);
+    DataFormat dest_format = static_cast<DataFormat>(formats.pack_src);
+    if (dest_format == DataFormat::Int32)
+    {
+        _llk_math_srcAB_hw_configure_<IMPLIED_MATH_FORMAT, false /*fp32_dest*/, true /*int32_dest*/>(src_format, src_format);
+    }
+    else
+    {
+        _llk_math_srcAB_hw_configure_<IMPLIED_MATH_FORMAT, is_fp32_dest_acc_en, is_int_fpu_en>(src_format, src_format);
+    }
+
+    const std::uint32_t num_sfpu_iterations = params.TEST_FACE_R_DIM / ckernel::math::SFP_ROWS;
+
+    if (!unpack_to_dest)
+    {
+        const std::uint32_t num_rows = params.num_faces * params.TEST_FACE_R_DIM;
+        _llk_math_eltwise_unary_datacopy_init_<DATA_COPY_TYPE, is_fp32_dest_acc_en>(num_rows, 1);
+
+        // Datacopy all tiles from SRC to DEST
+        for (std::uint32_t i = 0; i < params.TILE_CNT; ++i)
+        {
+            _llk_math_eltwise_unary_datacopy_(num_rows, params.DST_INDEX + i);
+        }
+
+        _llk_math_set_dvalid_<p_cleardvalid::FPU, dest_sync>();
+    }
+
+    _llk_math_eltwise_unary_sfpu_init_();
+    init_sfpu_unary_op();
+    for (std::uint32_t i = 0; i < params.TILE_CNT; ++i)
+    {
+        call_sfpu_unary_op(params.DST_INDEX + i, static_cast<int>(num_sfpu_iterations), dest_format);
+    }
+
+    _llk_math_set_dvalid_<p_cleardvalid::SFPU, dest_sync>();
+
+    // Wait for all operations to complete
+    wait_sfpu_idle();
+    wait_fpu_idle();
+    wait_mop_idle();
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+#include "cfg_defines.h"
+#include "llk_pack.h"
+#include "llk_pack_common.h"
+#include "params.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+    std::uint32_t const buf_desc_id        = 8;
+    const std::uint32_t num_tiles_per_pack = params.TILE_CNT;
+
+    // Setup dvalid for PACK
+    if (unpack_to_dest)
+    {
+        set_up_dest_dvalid_per_thread<dest_dvalid_client::PACK>({dest_dvalid_client::UNPACK, dest_dvalid_client::SFPU, dest_dvalid_client::PACK});
+    }
+    else
+    {
+        set_up_dest_dvalid_per_thread<dest_dvalid_client::PACK>({dest_dvalid_client::FPU, dest_dvalid_client::SFPU, dest_dvalid_client::PACK});
+    }
+
+    buffer_descriptor_u bd_val = {0};
+    bd_val.f.l1_addr_16B       = params.buffer_Res[0] / 16;
+    bd_val.f.format            = static_cast<std::uint8_t>(formats.pack_dst);
+    bd_val.f.x_dim             = params.TEST_FACE_C_DIM;
+    bd_val.f.y_dim             = params.TEST_FACE_R_DIM;
+    bd_val.f.z_dim             = params.num_faces;
+
+    tdma_descriptor_t tdma_desc;
+    tdma_desc.buf_desc        = bd_val;
+    tdma_desc.buf_desc_id     = buf_desc_id;
+    tdma_desc.reg_data_format = static_cast<std::uint8_t>(formats.pack_src);
+    _configure_buf_desc_table_(tdma_desc.buf_desc_id, tdma_desc.buf_desc);
+
+    _llk_pack_hw_configure_<p_pacr::PACK0>(tdma_desc);
+    _llk_pack_init_(buf_desc_id, num_tiles_per_pack);
+    _llk_pack_(params.DST_INDEX, 0);
+    _llk_pack_dest_dvalid_section_done_<dest_sync, is_fp32_dest_acc_en>();
+}
+#endif
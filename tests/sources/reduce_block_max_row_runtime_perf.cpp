@@ -0,0 +1,223 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+
+#include "ckernel.h"
+#include "ckernel_defs.h"
+#include "llk_defs.h"
+#include "params.h"
+#include "perf.h"
+#include "profiler.h"
+
+// Globals
+std::uint32_t unp_cfg_context          = 0;
+std::uint32_t pack_sync_tile_dst_ptr   = 0;
+std::uint32_t math_sync_tile_dst_index = 0;
+
+using namespace ckernel;
+
+// Every row band of BLOCK_CT_DIM tiles is one block, reduced into a single tile like the SDPA max row reduce.
+// PERF_REINIT_TYPE selects the math reinit issued before every block but the first.
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "experimental/llk_unpack_AB_reduce_custom_runtime.h"
+#include "llk_unpack_common.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+
+#ifndef SPEED_OF_LIGHT
+    const std::uint32_t LOOP_FACTOR  = params.LOOP_FACTOR;
+    const std::uint32_t FULL_RT_DIM  = params.FULL_RT_DIM;
+    const std::uint32_t BLOCK_CT_DIM = params.BLOCK_CT_DIM;
+#endif
+    const std::uint32_t num_blocks = FULL_RT_DIM * LOOP_FACTOR;
+
+    {
+        ZONE_SCOPED("INIT")
+        _llk_unpack_hw_configure_<is_fp32_dest_acc_en>(
+            formats.unpack_A_src,
+            formats.unpack_B_src,
+            formats.unpack_A_dst,
+            formats.unpack_B_dst,
+            FACE_R_DIM,
+            FACE_R_DIM,
+            /* num_faces */ 4,
+            /* num_faces */ 4);
+        _llk_unpack_AB_reduce_block_max_row_init_runtime_<is_fp32_dest_acc_en>(BLOCK_CT_DIM);
+        PROFILER_SYNC();
+    }
+    {
+        ZONE_SCOPED("TILE_LOOP")
+        if constexpr (PERF_RUN_TYPE == PerfRunType::PACK_ISOLATE)
+        {
+            return;
+        }
+        else if constexpr (PERF_RUN_TYPE == PerfRunType::MATH_ISOLATE)
+        {
+            // One scaler for the whole block, then every operand tile of the block
+            for (std::uint32_t block = 0; block < num_blocks; block++)
+            {
+                _perf_unpack_loop_set_valid<false, true>(1);
+                _perf_unpack_loop_set_valid<true, false>(BLOCK_CT_DIM);
+            }
+            return;
+        }
+        else
+        {
+            for (std::uint32_t block = 0; block < num_blocks; block++)
+            {
+                _llk_unpack_AB_reduce_block_max_row_runtime_(
+                    PERF_ADDRESS(PERF_INPUT_A, (block % FULL_RT_DIM) * BLOCK_CT_DIM), PERF_ADDRESS(PERF_INPUT_B, 0));
+            }
+        }
+        PROFILER_SYNC();
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+#include "experimental/llk_math_reduce_runtime_custom.h"
+#include "llk_math_common.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+
+#ifndef SPEED_OF_LIGHT
+    const std::uint32_t LOOP_FACTOR  = params.LOOP_FACTOR;
+    const std::uint32_t FULL_RT_DIM  = params.FULL_RT_DIM;
+    const std::uint32_t BLOCK_CT_DIM = params.BLOCK_CT_DIM;
+#endif
+    const std::uint32_t num_blocks = FULL_RT_DIM * LOOP_FACTOR;
+
+    {
+        ZONE_SCOPED("INIT")
+        _llk_math_pack_sync_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+        _llk_math_hw_configure_<is_fp32_dest_acc_en>(formats.math, formats.math);
+        _llk_math_reduce_block_max_row_init_runtime_<is_fp32_dest_acc_en, POOL_TYPE>(BLOCK_CT_DIM);
+        PROFILER_SYNC();
+    }
+    {
+        ZONE_SCOPED("TILE_LOOP")
+        if constexpr (PERF_RUN_TYPE == PerfRunType::PACK_ISOLATE)
+        {
+            return;
+        }
+        else if constexpr (PERF_RUN_TYPE == PerfRunType::UNPACK_ISOLATE || PERF_RUN_TYPE == PerfRunType::L1_CONGESTION)
+        {
+            for (std::uint32_t block = 0; block < num_blocks; block++)
+            {
+                _perf_math_loop_clear_valid<true, false>(BLOCK_CT_DIM);
+                _perf_math_loop_clear_valid<false, true>(1);
+            }
+            return;
+        }
+        else
+        {
+            for (std::uint32_t block = 0; block < num_blocks; block++)
+            {
+                if (block > 0)
+                {
+                    if constexpr (PERF_REINIT_TYPE == PerfReinitType::MINIMAL)
+                    {
+                        _llk_math_reduce_block_max_row_reinit_minimal_runtime_();
+                    }
+                    else if constexpr (PERF_REINIT_TYPE == PerfReinitType::SHORT)
+                    {
+                        _llk_math_reduce_block_max_row_reinit_short_runtime_<is_fp32_dest_acc_en>(BLOCK_CT_DIM);
+                    }
+                    else if constexpr (PERF_REINIT_TYPE == PerfReinitType::FULL)
+                    {
+                        _llk_math_reduce_block_max_row_init_runtime_<is_fp32_dest_acc_en, POOL_TYPE>(BLOCK_CT_DIM);
+                    }
+                }
+
+                if constexpr (PERF_RUN_TYPE == PerfRunType::MATH_ISOLATE)
+                {
+                    _llk_math_reduce_block_max_row_runtime_<is_fp32_dest_acc_en>(0);
+                }
+                else
+                {
+                    _llk_math_wait_for_dest_available_<DstSync::SyncHalf>();
+                    _llk_math_reduce_block_max_row_runtime_<is_fp32_dest_acc_en>(0);
+                    _llk_math_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+                }
+            }
+        }
+        PROFILER_SYNC();
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+#include "llk_pack.h"
+#include "llk_pack_common.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+
+#ifndef SPEED_OF_LIGHT
+    const std::uint32_t LOOP_FACTOR = params.LOOP_FACTOR;
+    const std::uint32_t FULL_RT_DIM = params.FULL_RT_DIM;
+#endif
+    const std::uint32_t num_blocks = FULL_RT_DIM * LOOP_FACTOR;
+
+    {
+        ZONE_SCOPED("INIT")
+        _llk_pack_hw_configure_<is_fp32_dest_acc_en>(formats.pack_src, formats.pack_dst, TILE_WIDTH * TILE_HEIGHT);
+        _llk_pack_init_<
+            /* untilize */ false,
+            /* zero output */ false>(formats.pack_dst);
+        _llk_pack_reduce_mask_config_<
+            /* untilize */ false,
+            ReduceDim::REDUCE_ROW>();
+        _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+        PROFILER_SYNC();
+    }
+    {
+        ZONE_SCOPED("TILE_LOOP")
+        if constexpr (PERF_RUN_TYPE == PerfRunType::UNPACK_ISOLATE || PERF_RUN_TYPE == PerfRunType::MATH_ISOLATE)
+        {
+            _llk_pack_reduce_mask_clear_();
+            return;
+        }
+        if constexpr (PERF_RUN_TYPE == PerfRunType::PACK_ISOLATE || PERF_RUN_TYPE == PerfRunType::L1_CONGESTION)
+        {
+            for (std::uint32_t block = 0; block < num_blocks; block++)
+            {
+                _llk_pack_<DstSync::SyncHalf, is_fp32_dest_acc_en>(0, PERF_ADDRESS(PERF_OUTPUT, block % FULL_RT_DIM));
+            }
+        }
+        else
+        {
+            for (std::uint32_t block = 0; block < num_blocks; block++)
+            {
+                _llk_packer_wait_for_math_done_();
+                _llk_pack_<DstSync::SyncHalf, is_fp32_dest_acc_en>(0, PERF_ADDRESS(PERF_OUTPUT, block % FULL_RT_DIM));
+                _llk_pack_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+            }
+        }
+
+        _llk_pack_reduce_mask_clear_();
+
+        PROFILER_SYNC();
+    }
+}
+
+#endif
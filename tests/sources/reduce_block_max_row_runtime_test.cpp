@@ -0,0 +1,153 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+
+#include "ckernel.h"
+#include "ckernel_defs.h"
+#include "llk_defs.h"
+#include "params.h"
+
+// Globals
+std::uint32_t unp_cfg_context          = 0;
+std::uint32_t pack_sync_tile_dst_ptr   = 0;
+std::uint32_t math_sync_tile_dst_index = 0;
+
+using namespace ckernel;
+
+// Every row band of BLOCK_CT_DIM tiles is one block, reduced into a single result tile like the SDPA max row reduce.
+// Unless PERF_REINIT_TYPE is NONE, math clobbers the state the selected reinit is expected to restore before every block
+// but the first and then issues that reinit, so a reinit that misses part of the state shows up as a wrong result.
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "experimental/llk_unpack_AB_reduce_custom_runtime.h"
+#include "llk_unpack_common.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+    _llk_unpack_hw_configure_<is_fp32_dest_acc_en>(
+        formats.unpack_A_src,
+        formats.unpack_B_src,
+        formats.unpack_A_dst,
+        formats.unpack_B_dst,
+        FACE_R_DIM,
+        FACE_R_DIM,
+        /* num_faces */ 4,
+        /* num_faces */ 4);
+    _llk_unpack_AB_reduce_block_max_row_init_runtime_<is_fp32_dest_acc_en>(params.BLOCK_CT_DIM);
+
+    for (std::uint32_t block = 0; block < params.FULL_RT_DIM; block++)
+    {
+        _llk_unpack_AB_reduce_block_max_row_runtime_(L1_ADDRESS(params.buffer_A[block * params.BLOCK_CT_DIM]), L1_ADDRESS(params.buffer_B[0]));
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+#include "experimental/llk_math_reduce_runtime_custom.h"
+#include "llk_math_common.h"
+
+// Leaves behind the state the ops run between two SDPA reduces clobber, up to what the selected reinit restores:
+// the minimal reinit restores the addrmods, the short reinit also the MOP and the full init also the replay buffer.
+template <PerfReinitType reinit_type>
+inline void clobber_reduce_block_max_row_state()
+{
+    addr_mod_t {.srca = {.incr = 0}, .srcb = {.incr = 0}, .dest = {.incr = 0}}.set(ADDR_MOD_1);
+    addr_mod_t {.srca = {.incr = 0}, .srcb = {.incr = 0}, .dest = {.incr = 0}}.set(ADDR_MOD_2);
+    addr_mod_t {.srca = {.incr = 0}, .srcb = {.incr = 0}, .dest = {.incr = 8}}.set(ADDR_MOD_6);
+#ifndef ARCH_BLACKHOLE
+    // The Blackhole minimal reinit relies on ADDR_MOD_3 being preserved
+    addr_mod_t {.srca = {.incr = 0}, .srcb = {.incr = 0}, .dest = {.incr = 0}}.set(ADDR_MOD_3);
+#endif
+
+    if constexpr (reinit_type == PerfReinitType::SHORT || reinit_type == PerfReinitType::FULL)
+    {
+        ckernel_template tmp(1, 1, TT_OP_NOP);
+        tmp.program();
+    }
+
+    if constexpr (reinit_type == PerfReinitType::FULL)
+    {
+        lltt::record<lltt::NoExec>(0, 15);
+        for (std::uint32_t i = 0; i < 15; i++)
+        {
+            TTI_NOP;
+        }
+    }
+}
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+    _llk_math_pack_sync_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    _llk_math_hw_configure_<is_fp32_dest_acc_en>(formats.math, formats.math);
+    _llk_math_reduce_block_max_row_init_runtime_<is_fp32_dest_acc_en, POOL_TYPE>(params.BLOCK_CT_DIM);
+
+    for (std::uint32_t block = 0; block < params.FULL_RT_DIM; block++)
+    {
+        if (block > 0)
+        {
+            if constexpr (PERF_REINIT_TYPE == PerfReinitType::MINIMAL)
+            {
+                clobber_reduce_block_max_row_state<PERF_REINIT_TYPE>();
+                _llk_math_reduce_block_max_row_reinit_minimal_runtime_();
+            }
+            else if constexpr (PERF_REINIT_TYPE == PerfReinitType::SHORT)
+            {
+                clobber_reduce_block_max_row_state<PERF_REINIT_TYPE>();
+                _llk_math_reduce_block_max_row_reinit_short_runtime_<is_fp32_dest_acc_en>(params.BLOCK_CT_DIM);
+            }
+            else if constexpr (PERF_REINIT_TYPE == PerfReinitType::FULL)
+            {
+                clobber_reduce_block_max_row_state<PERF_REINIT_TYPE>();
+                _llk_math_reduce_block_max_row_init_runtime_<is_fp32_dest_acc_en, POOL_TYPE>(params.BLOCK_CT_DIM);
+            }
+        }
+
+        _llk_math_wait_for_dest_available_<DstSync::SyncHalf>();
+        _llk_math_reduce_block_max_row_runtime_<is_fp32_dest_acc_en>(0);
+        _llk_math_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+#include "llk_pack.h"
+#include "llk_pack_common.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en>(formats.pack_src, formats.pack_dst, TILE_WIDTH * TILE_HEIGHT);
+    _llk_pack_init_<
+        /* untilize */ false,
+        /* zero output */ false>(formats.pack_dst);
+    _llk_pack_reduce_mask_config_<
+        /* untilize */ false,
+        ReduceDim::REDUCE_ROW>();
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+
+    for (std::uint32_t block = 0; block < params.FULL_RT_DIM; block++)
+    {
+        _llk_packer_wait_for_math_done_();
+        _llk_pack_<DstSync::SyncHalf, is_fp32_dest_acc_en>(0, L1_ADDRESS(params.buffer_Res[block]));
+        _llk_pack_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    }
+
+    _llk_pack_reduce_mask_clear_();
+}
+
+#endif
@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+#include <cstdio>
+
+#include "ckernel.h"
+#include "llk_defs.h"
+#include "params.h"
+#include "tensor_shape.h"
+
+std::uint32_t unp_cfg_context          = 0;
+std::uint32_t pack_sync_tile_dst_ptr   = 0;
+std::uint32_t math_sync_tile_dst_index = 0;
+
+// All INPUT_TILE_CNT input tiles are reduced into dest tile 0, either by one block reduce call or with
+// REDUCE_PER_TILE by one single tile reduce per tile that leaves the row transpose to the last tile.
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "llk_unpack_AB_reduce.h"
+#include "llk_unpack_common.h"
+#include "params.h"
+#include "tensor_shape.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+    constexpr ckernel::TensorShape tensor_shape = ckernel::DEFAULT_TENSOR_SHAPE;
+    _llk_unpack_hw_configure_<is_fp32_dest_acc_en>(
+        formats.unpack_A_src,
+        formats.unpack_B_src,
+        formats.unpack_A_dst,
+        formats.unpack_B_dst,
+        tensor_shape.face_r_dim,
+        tensor_shape.face_r_dim,
+        tensor_shape.total_num_faces(),
+        tensor_shape.total_num_faces(),
+        params.TILE_SIZE_UNPACK_A,
+        params.TILE_SIZE_UNPACK_B);
+    _llk_unpack_AB_reduce_init_<POOL_TYPE, REDUCE_DIM>(tensor_shape);
+    for (int i = 0; i < params.INPUT_TILE_CNT; ++i)
+    {
+        _llk_unpack_AB_reduce_<POOL_TYPE, REDUCE_DIM>(L1_ADDRESS(params.buffer_A[i]), L1_ADDRESS(params.buffer_B[0]));
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+#include "llk_math_common.h"
+#include "llk_math_reduce.h"
+#include "params.h"
+#include "tensor_shape.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+    constexpr ckernel::TensorShape tensor_shape = ckernel::DEFAULT_TENSOR_SHAPE;
+
+    _llk_math_pack_sync_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    _llk_math_hw_configure_<is_fp32_dest_acc_en>(formats.math, formats.math);
+    if constexpr (REDUCE_PER_TILE)
+    {
+        _llk_math_reduce_init_<POOL_TYPE, REDUCE_DIM, is_fp32_dest_acc_en, MATH_FIDELITY>();
+
+        _llk_math_wait_for_dest_available_<DstSync::SyncHalf>();
+        for (int i = 0; i < params.INPUT_TILE_CNT; ++i)
+        {
+            _llk_math_reduce_<POOL_TYPE, REDUCE_DIM, is_fp32_dest_acc_en, MATH_FIDELITY>(0, tensor_shape, i == params.INPUT_TILE_CNT - 1);
+        }
+        _llk_math_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    }
+    else
+    {
+        _llk_math_reduce_block_init_<POOL_TYPE, REDUCE_DIM, is_fp32_dest_acc_en, MATH_FIDELITY>(params.INPUT_TILE_CNT);
+
+        _llk_math_wait_for_dest_available_<DstSync::SyncHalf>();
+        _llk_math_reduce_block_<POOL_TYPE, REDUCE_DIM, is_fp32_dest_acc_en, MATH_FIDELITY>(0, params.INPUT_TILE_CNT, tensor_shape);
+        _llk_math_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+#include "llk_pack.h"
+#include "llk_pack_common.h"
+#include "params.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+    constexpr ckernel::TensorShape tensor_shape = ckernel::DEFAULT_TENSOR_SHAPE;
+
+    const std::uint32_t tile_size = tensor_shape.total_tensor_size();
+    const std::uint32_t num_faces = tensor_shape.total_num_faces();
+
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false /* untilize */, false /* tilize */>(
+        formats.pack_src,
+        formats.pack_dst,
+        tile_size,
+        tensor_shape.face_r_dim,
+        tensor_shape.total_col_dim(),
+        num_faces,
+        false /* partial_face */,
+        false /* narrow_tile */);
+#else
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false /* untilize */>(
+        formats.pack_src, formats.pack_dst, tile_size, tensor_shape.face_r_dim, num_faces, false /* partial_face */, false /* narrow_tile */);
+#endif
+
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_init_<false /* untilize */, false /* zero_output */>(formats.pack_dst, tensor_shape.face_r_dim, tensor_shape.total_col_dim(), num_faces);
+#else
+    _llk_pack_init_<false /* untilize */, false /* zero_output */>(
+        formats.pack_dst, tensor_shape.face_r_dim, num_faces, false /* partial_face */, false /* narrow_tile */);
+#endif
+
+    _llk_pack_reduce_mask_config_<false, REDUCE_DIM>();
+
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+#else
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en, false /* untilize */>(tensor_shape.face_r_dim, false /* narrow_tile */);
+#endif
+
+    _llk_packer_wait_for_math_done_();
+    _llk_pack_<DstSync::SyncHalf, is_fp32_dest_acc_en, false /* untilize */>(0, L1_ADDRESS(params.buffer_Res[0]));
+    _llk_pack_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    _llk_pack_reduce_mask_clear_();
+}
+
+#endif
@@ -95,9 +95,7 @@ void run_kernel(RUNTIME_PARAMETERS params)
 #endif
     constexpr MathFidelity MATH_FIDELITY = MathFidelity::HiFi4;
 
-    // todo: INT32 reduce is not supported yet
     constexpr bool ENFORCE_FP32_ACC = false;
-    constexpr bool IS_INT_FPU       = false;
 
     // Create a default 32x32 tile with 4 faces of 16x16
     const ckernel::TensorShape DEFAULT_TENSOR_SHAPE = {FACE_R_DIM, FACE_C_DIM, MAX_NUM_FACES_R_DIM, MAX_NUM_FACES_C_DIM};
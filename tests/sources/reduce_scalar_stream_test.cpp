@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+#include <cstdio>
+
+#include "ckernel.h"
+#include "llk_defs.h"
+#include "params.h"
+#include "tensor_shape.h"
+
+std::uint32_t unp_cfg_context          = 0;
+std::uint32_t pack_sync_tile_dst_ptr   = 0;
+std::uint32_t math_sync_tile_dst_index = 0;
+
+using namespace ckernel;
+
+// Every input tile is reduced to a scalar into the partial tile, which the SFPU folds into the accumulator tile,
+// only the accumulator tile is packed after the last input tile.
+static constexpr std::uint32_t PARTIAL_TILE = 0;
+static constexpr std::uint32_t ACC_TILE     = 1;
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "llk_unpack_AB_reduce.h"
+#include "llk_unpack_common.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+    _llk_unpack_hw_configure_<is_fp32_dest_acc_en>(
+        formats.unpack_A_src, formats.unpack_B_src, formats.unpack_A_dst, formats.unpack_B_dst, FACE_R_DIM, FACE_R_DIM, 4 /* num_faces */, 4 /* num_faces */);
+    _llk_unpack_AB_reduce_init_<POOL_TYPE, REDUCE_DIM>(DEFAULT_TENSOR_SHAPE);
+    for (int i = 0; i < params.INPUT_TILE_CNT; ++i)
+    {
+        _llk_unpack_AB_reduce_<POOL_TYPE, REDUCE_DIM>(L1_ADDRESS(params.buffer_A[i]), L1_ADDRESS(params.buffer_B[0]));
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+#include "ckernel_sfpu.h"
+#include "llk_math_common.h"
+#include "llk_math_eltwise_unary_sfpu.h"
+#include "llk_math_reduce.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+    _llk_math_pack_sync_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    _llk_math_hw_configure_<is_fp32_dest_acc_en>(formats.math, formats.math);
+    _llk_math_reduce_init_<POOL_TYPE, REDUCE_DIM, is_fp32_dest_acc_en, MATH_FIDELITY, false>();
+    _llk_math_eltwise_unary_sfpu_init_<SfpuType::reduce_scalar_stream>();
+
+    _llk_math_wait_for_dest_available_<DstSync::SyncHalf>();
+    for (int i = 0; i < params.INPUT_TILE_CNT; ++i)
+    {
+        _llk_math_reduce_<POOL_TYPE, REDUCE_DIM, is_fp32_dest_acc_en, MATH_FIDELITY>(PARTIAL_TILE, DEFAULT_TENSOR_SHAPE);
+
+        _llk_math_eltwise_unary_sfpu_start_<DstSync::SyncHalf>(PARTIAL_TILE);
+        ckernel::sfpu::_calculate_reduce_scalar_accumulate_<is_fp32_dest_acc_en, POOL_TYPE, REDUCE_COMPENSATED>(0, ACC_TILE - PARTIAL_TILE, i == 0);
+        _llk_math_eltwise_unary_sfpu_done_();
+    }
+
+    if constexpr (REDUCE_COMPENSATED)
+    {
+        _llk_math_eltwise_unary_sfpu_start_<DstSync::SyncHalf>(ACC_TILE);
+        ckernel::sfpu::_calculate_reduce_scalar_finalize_<is_fp32_dest_acc_en>(0);
+        _llk_math_eltwise_unary_sfpu_done_();
+    }
+    _llk_math_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+#include "llk_pack.h"
+#include "llk_pack_common.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en>(formats.pack_src, formats.pack_dst, TILE_WIDTH * TILE_HEIGHT);
+    _llk_pack_init_<false /* untilize */, false /* zero_output */>(formats.pack_dst);
+    _llk_pack_reduce_mask_config_<false /* untilize */, REDUCE_DIM>();
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+
+    _llk_packer_wait_for_math_done_();
+    _llk_pack_<DstSync::SyncHalf, is_fp32_dest_acc_en, false /* untilize */>(ACC_TILE, L1_ADDRESS(params.buffer_Res[0]));
+    _llk_pack_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    _llk_pack_reduce_mask_clear_();
+}
+
+#endif
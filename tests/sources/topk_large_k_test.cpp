@@ -0,0 +1,287 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Large-k TopK SFPU Test - streams the multi-tile bitonic sort and merge over rows longer than dest
+//
+// Every tile row holds NUM_VALUE_TILES value tiles followed by the same number of index tiles. The top TOPK_K datums
+// of every row (k up to 1024) are found with the schedule of _bitonic_topk_for_each_step_, working in place in
+// buffer_A. Tiles are transposed on the first unpack, so every row of the matrix is a dest column.
+//
+// Every step reads the tiles the previous step packed, so the packer posts the PACK_DONE semaphore after every step
+// and the unpacker waits on it before starting the next one. The last step packs the run to buffer_Res, RUN_TILES
+// value tiles followed by RUN_TILES index tiles per tile row.
+
+#include <cstdint>
+
+#include "ckernel.h"
+#include "ckernel_sfpu_topk_large_k.h"
+#include "llk_defs.h"
+#include "params.h"
+
+// Globals required by the test framework.
+std::uint32_t unp_cfg_context          = 0;
+std::uint32_t pack_sync_tile_dst_ptr   = 0;
+std::uint32_t math_sync_tile_dst_index = 0;
+
+enum class Stage : int
+{
+    Values  = 0, // Stage for processing value tiles.
+    Indices = 1  // Stage for processing index tiles.
+};
+
+constexpr int NUM_STAGES = 2;
+
+using ckernel::sfpu::TopkTileOp;
+
+constexpr int RUN_TILES = TOPK_K / ckernel::TILE_C_DIM;
+
+// ============================================================================
+// UNPACK TRISC
+// ============================================================================
+
+#ifdef LLK_TRISC_UNPACK
+#include "llk_unpack_A.h"
+#include "llk_unpack_common.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+    const int NUM_VALUE_TILES = params.FULL_CT_DIM / NUM_STAGES;
+    const int NUM_STEPS       = ckernel::sfpu::_bitonic_topk_num_steps_<is_fp32_dest_acc_en>(NUM_VALUE_TILES, TOPK_K);
+
+    const std::uint32_t unpack_src_data_types[NUM_STAGES] = {formats.unpack_A_src, ckernel::to_underlying(DataFormat::UInt16)};
+    const std::uint32_t unpack_dst_data_types[NUM_STAGES] = {formats.unpack_A_dst, ckernel::to_underlying(DataFormat::UInt16)};
+
+    _llk_unpack_hw_configure_<is_fp32_dest_acc_en>(
+        unpack_src_data_types[0],
+        unpack_src_data_types[0],
+        unpack_dst_data_types[0],
+        unpack_dst_data_types[0],
+        FACE_R_DIM,
+        FACE_R_DIM,
+        4 /* num_faces */,
+        4 /* num_faces */);
+
+    for (int current_tile_row = 0; current_tile_row < params.FULL_RT_DIM; ++current_tile_row)
+    {
+        const int tile_row_offset = current_tile_row * params.FULL_CT_DIM;
+        int step                  = 0;
+
+        auto section = [&](const TopkTileOp op, const int first_tile, const int tile_stride, const int num_tiles, const bool)
+        {
+            for (Stage stage : {Stage::Values, Stage::Indices})
+            {
+                const int stage_index                 = static_cast<int>(stage);
+                const std::uint32_t unpack_src_format = unpack_src_data_types[stage_index];
+                const std::uint32_t unpack_dst_format = unpack_dst_data_types[stage_index];
+
+                _llk_unpack_reconfig_data_format_srca_impl_<is_fp32_dest_acc_en, false /* to_from_int8 */>(
+                    unpack_src_format, unpack_dst_format, 16 * 16 * 4 /* tile_size */);
+
+                // Only the first step reads the input, transpose it so that the rows of the matrix become dest columns.
+                const std::uint32_t transpose = (op == TopkTileOp::Sort) ? 1 : 0;
+                _llk_unpack_A_init_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+                    /* transpose_of_faces */ transpose,
+                    /* within_face_16x16_transpose */ transpose,
+                    /* face_r_dim     */ FACE_R_DIM,
+                    /* num_faces      */ 4,
+                    unpack_src_format,
+                    unpack_dst_format);
+
+                for (int tile = 0; tile < num_tiles; ++tile)
+                {
+                    const int tile_index = tile_row_offset + stage_index * NUM_VALUE_TILES + first_tile + tile * tile_stride;
+                    _llk_unpack_A_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+                        L1_ADDRESS(params.buffer_A[tile_index]), unpack_src_format, unpack_dst_format);
+                }
+            }
+        };
+
+        auto step_done = [&]()
+        {
+            // The next step reads the tiles this one packs back to L1.
+            const bool last_step = (current_tile_row == params.FULL_RT_DIM - 1) && (step == NUM_STEPS - 1);
+            if (!last_step)
+            {
+                t6_semaphore_wait_on_zero<p_stall::STALL_SYNC>(semaphore::PACK_DONE);
+                t6_semaphore_get<>(semaphore::PACK_DONE);
+            }
+            ++step;
+        };
+
+        ckernel::sfpu::_bitonic_topk_for_each_step_<is_fp32_dest_acc_en>(NUM_VALUE_TILES, TOPK_K, TOPK_SORT_DIRECTION, section, step_done);
+    }
+}
+#endif // LLK_TRISC_UNPACK
+
+// ============================================================================
+// MATH TRISC
+// ============================================================================
+
+#ifdef LLK_TRISC_MATH
+#include "ckernel_sfpu.h"
+#include "llk_math_common.h"
+#include "llk_math_eltwise_unary_datacopy.h"
+#include "llk_math_eltwise_unary_sfpu.h"
+
+using namespace ckernel;
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+    const int NUM_VALUE_TILES = params.FULL_CT_DIM / NUM_STAGES;
+
+    const std::uint32_t math_data_types[NUM_STAGES] = {formats.math, ckernel::to_underlying(DataFormat::UInt16)};
+
+    _llk_math_pack_sync_init_<dest_sync, is_fp32_dest_acc_en>();
+    _llk_math_hw_configure_<is_fp32_dest_acc_en>(math_data_types[0], math_data_types[0]);
+
+    _llk_math_eltwise_unary_sfpu_init_<SfpuType::topk_local_sort>();
+    ckernel::sfpu::_init_topk();
+
+    auto section = [&](const TopkTileOp op, const int, const int, const int num_tiles, const bool dir)
+    {
+        _llk_math_wait_for_dest_available_<dest_sync>();
+
+        for (Stage stage : {Stage::Values, Stage::Indices})
+        {
+            const int stage_index           = static_cast<int>(stage);
+            const std::uint32_t math_format = math_data_types[stage_index];
+
+            _llk_math_reconfig_data_format_srca_<is_fp32_dest_acc_en, false /* to_from_int8 */>(math_format);
+
+#ifdef ARCH_BLACKHOLE
+            _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false /* tilize */, false /* is_int_fpu_en */>(
+                /*num_rows_per_matrix=*/4, /*math_format=*/math_format);
+#else
+            _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false /* is_int_fpu_en */>(
+                /*num_rows_per_matrix=*/4, /*math_format=*/math_format);
+#endif
+
+            // Index tiles follow the value tiles in dest.
+            for (int tile = 0; tile < num_tiles; ++tile)
+            {
+                _llk_math_eltwise_unary_datacopy_<DataCopyType::A2D, DstSync::SyncHalf, is_fp32_dest_acc_en, BroadcastType::NONE, unpack_to_dest>(
+                    stage_index * num_tiles + tile, math_format, math_format);
+            }
+        }
+
+        _llk_math_eltwise_unary_sfpu_start_<DstSync::SyncHalf>(0);
+        switch (op)
+        {
+            case TopkTileOp::Sort:
+                ckernel::sfpu::_bitonic_topk_sort_tiles_<false, is_fp32_dest_acc_en, TOPK_STABLE_SORT>(num_tiles, dir);
+                break;
+            case TopkTileOp::Merge:
+                ckernel::sfpu::_bitonic_topk_merge_tiles_<false, is_fp32_dest_acc_en, TOPK_STABLE_SORT>(num_tiles, dir);
+                break;
+            case TopkTileOp::Exchange:
+                ckernel::sfpu::_bitonic_topk_exchange_tiles_<false, is_fp32_dest_acc_en, TOPK_STABLE_SORT>(dir);
+                break;
+        }
+        _llk_math_eltwise_unary_sfpu_done_();
+
+        _llk_math_dest_section_done_<dest_sync, is_fp32_dest_acc_en>();
+    };
+
+    for (int current_tile_row = 0; current_tile_row < params.FULL_RT_DIM; ++current_tile_row)
+    {
+        ckernel::sfpu::_bitonic_topk_for_each_step_<is_fp32_dest_acc_en>(NUM_VALUE_TILES, TOPK_K, TOPK_SORT_DIRECTION, section, []() {});
+    }
+}
+#endif // LLK_TRISC_MATH
+
+// ============================================================================
+// PACK TRISC
+// ============================================================================
+
+#ifdef LLK_TRISC_PACK
+#include "llk_pack.h"
+#include "llk_pack_common.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+    const int NUM_VALUE_TILES = params.FULL_CT_DIM / NUM_STAGES;
+    const int NUM_STEPS       = ckernel::sfpu::_bitonic_topk_num_steps_<is_fp32_dest_acc_en>(NUM_VALUE_TILES, TOPK_K);
+
+    const std::uint32_t pack_src_data_types[NUM_STAGES] = {formats.pack_src, ckernel::to_underlying(DataFormat::UInt16)};
+    const std::uint32_t pack_dst_data_types[NUM_STAGES] = {formats.pack_dst, ckernel::to_underlying(DataFormat::UInt16)};
+
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false /* untilize */, false /* tilize */>(pack_src_data_types[0], pack_dst_data_types[0], 16 * 16 * 4);
+    _llk_pack_dest_init_<dest_sync, is_fp32_dest_acc_en>();
+#else
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false /* untilize */>(pack_src_data_types[0], pack_dst_data_types[0], 16 * 16 * 4);
+    _llk_pack_dest_init_<dest_sync, false, false>();
+#endif
+
+    for (int current_tile_row = 0; current_tile_row < params.FULL_RT_DIM; ++current_tile_row)
+    {
+        const int tile_row_offset = current_tile_row * params.FULL_CT_DIM;
+        int step                  = 0;
+
+        auto section = [&](const TopkTileOp, const int first_tile, const int tile_stride, const int num_tiles, const bool)
+        {
+            // The last step sorts the run holding the result, which starts at the first tile of the row.
+            const bool last_step = (step == NUM_STEPS - 1);
+
+            _llk_packer_wait_for_math_done_();
+
+            for (Stage stage : {Stage::Values, Stage::Indices})
+            {
+                const int stage_index               = static_cast<int>(stage);
+                const std::uint32_t pack_src_format = pack_src_data_types[stage_index];
+                const std::uint32_t pack_dst_format = pack_dst_data_types[stage_index];
+
+#ifdef ARCH_BLACKHOLE
+                _llk_pack_reconfig_data_format_<is_fp32_dest_acc_en, false /* is_tile_dim_reconfig_en */>(
+                    pack_src_format,
+                    pack_dst_format,
+                    16 * 16 * 4,
+                    FACE_R_DIM,
+                    TILE_C_DIM,
+                    4 /* num_faces */,
+                    false /* partial_face */,
+                    false /* narrow_tile */,
+                    1 /* num_tiles */);
+#else
+                _llk_pack_reconfig_data_format_<is_fp32_dest_acc_en, false /* is_tile_dim_reconfig_en */>(
+                    pack_src_format, pack_dst_format, 16 * 16 * 4, FACE_R_DIM, 4 /* num_faces */, false /* partial_face */, false /* narrow_tile */);
+#endif
+
+                _llk_pack_init_<false, false>(pack_dst_format);
+
+                for (int tile = 0; tile < num_tiles; ++tile)
+                {
+                    const int row_tile = first_tile + tile * tile_stride;
+                    const std::uint32_t l1_address =
+                        last_step ? L1_ADDRESS(params.buffer_Res[(current_tile_row * NUM_STAGES + stage_index) * RUN_TILES + row_tile])
+                                  : L1_ADDRESS(params.buffer_A[tile_row_offset + stage_index * NUM_VALUE_TILES + row_tile]);
+                    _llk_pack_<dest_sync, is_fp32_dest_acc_en, false>(stage_index * num_tiles + tile, l1_address);
+                }
+            }
+            _llk_pack_dest_section_done_<dest_sync, is_fp32_dest_acc_en>();
+        };
+
+        auto step_done = [&]()
+        {
+            // Every packed tile has to be in L1 before the unpacker starts on the next step.
+            const bool last_step = (current_tile_row == params.FULL_RT_DIM - 1) && (step == NUM_STEPS - 1);
+            if (!last_step)
+            {
+                t6_semaphore_post<p_stall::PACK>(semaphore::PACK_DONE);
+            }
+            ++step;
+        };
+
+        ckernel::sfpu::_bitonic_topk_for_each_step_<is_fp32_dest_acc_en>(NUM_VALUE_TILES, TOPK_K, TOPK_SORT_DIRECTION, section, step_done);
+    }
+}
+#endif // LLK_TRISC_PACK
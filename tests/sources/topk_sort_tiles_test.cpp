@@ -0,0 +1,228 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Multi-tile TopK sort SFPU Test - full row argsort of a block of tiles in one dest section
+//
+// Every tile row holds NUM_VALUE_TILES value tiles followed by the same number of index tiles. All tiles of a tile row
+// are unpacked with transpose (column-wise format), the whole block is sorted in dest by _bitonic_topk_sort_tiles_ and
+// packed back in the same layout, so every row of the result holds its values sorted together with their indices.
+
+#include <cstdint>
+
+#include "ckernel.h"
+#include "llk_defs.h"
+#include "params.h"
+
+// Globals required by the test framework.
+std::uint32_t unp_cfg_context          = 0;
+std::uint32_t pack_sync_tile_dst_ptr   = 0;
+std::uint32_t math_sync_tile_dst_index = 0;
+
+enum class Stage : int
+{
+    Values  = 0, // Stage for processing value tiles.
+    Indices = 1  // Stage for processing index tiles.
+};
+
+constexpr int NUM_STAGES = 2;
+
+// ============================================================================
+// UNPACK TRISC
+// ============================================================================
+
+#ifdef LLK_TRISC_UNPACK
+#include "llk_unpack_A.h"
+#include "llk_unpack_common.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+    const int NUM_VALUE_TILES = params.FULL_CT_DIM / NUM_STAGES;
+
+    const std::uint32_t unpack_src_data_types[NUM_STAGES] = {formats.unpack_A_src, ckernel::to_underlying(DataFormat::UInt16)};
+    const std::uint32_t unpack_dst_data_types[NUM_STAGES] = {formats.unpack_A_dst, ckernel::to_underlying(DataFormat::UInt16)};
+
+    for (int current_tile_row = 0; current_tile_row < params.FULL_RT_DIM; ++current_tile_row)
+    {
+        for (Stage stage : {Stage::Values, Stage::Indices})
+        {
+            const int stage_index                 = static_cast<int>(stage);
+            const std::uint32_t unpack_src_format = unpack_src_data_types[stage_index];
+            const std::uint32_t unpack_dst_format = unpack_dst_data_types[stage_index];
+
+            if (current_tile_row == 0 && stage == Stage::Values)
+            {
+                _llk_unpack_hw_configure_<is_fp32_dest_acc_en>(
+                    unpack_src_format, unpack_src_format, unpack_dst_format, unpack_dst_format, FACE_R_DIM, FACE_R_DIM, 4 /* num_faces */, 4 /* num_faces */);
+            }
+            else
+            {
+                _llk_unpack_reconfig_data_format_srca_impl_<is_fp32_dest_acc_en, false /* to_from_int8 */>(
+                    unpack_src_format, unpack_dst_format, 16 * 16 * 4 /* tile_size */);
+            }
+
+            // Transpose every tile so that the rows of the matrix become dest columns.
+            _llk_unpack_A_init_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+                /* transpose_of_faces */ 1,
+                /* within_face_16x16_transpose */ 1,
+                /* face_r_dim     */ FACE_R_DIM,
+                /* num_faces      */ 4,
+                unpack_src_format,
+                unpack_dst_format);
+
+            const int first_tile_index = current_tile_row * params.FULL_CT_DIM + stage_index * NUM_VALUE_TILES;
+            for (int tile = 0; tile < NUM_VALUE_TILES; ++tile)
+            {
+                _llk_unpack_A_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+                    L1_ADDRESS(params.buffer_A[first_tile_index + tile]), unpack_src_format, unpack_dst_format);
+            }
+        }
+    }
+}
+#endif // LLK_TRISC_UNPACK
+
+// ============================================================================
+// MATH TRISC
+// ============================================================================
+
+#ifdef LLK_TRISC_MATH
+#include "ckernel_sfpu.h"
+#include "llk_math_common.h"
+#include "llk_math_eltwise_unary_datacopy.h"
+#include "llk_math_eltwise_unary_sfpu.h"
+
+using namespace ckernel;
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+    const int NUM_VALUE_TILES = params.FULL_CT_DIM / NUM_STAGES;
+
+    const std::uint32_t math_data_types[NUM_STAGES] = {formats.math, ckernel::to_underlying(DataFormat::UInt16)};
+
+    _llk_math_pack_sync_init_<dest_sync, is_fp32_dest_acc_en>();
+
+    _llk_math_eltwise_unary_sfpu_init_<SfpuType::topk_local_sort>();
+    ckernel::sfpu::_init_topk();
+
+    for (int current_tile_row = 0; current_tile_row < params.FULL_RT_DIM; ++current_tile_row)
+    {
+        _llk_math_wait_for_dest_available_<dest_sync>();
+
+        for (Stage stage : {Stage::Values, Stage::Indices})
+        {
+            const int stage_index           = static_cast<int>(stage);
+            const std::uint32_t math_format = math_data_types[stage_index];
+
+            if (current_tile_row == 0 && stage == Stage::Values)
+            {
+                _llk_math_hw_configure_<is_fp32_dest_acc_en>(math_format, math_format);
+            }
+            else
+            {
+                _llk_math_reconfig_data_format_srca_<is_fp32_dest_acc_en, false /* to_from_int8 */>(math_format);
+            }
+
+#ifdef ARCH_BLACKHOLE
+            _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false /* tilize */, false /* is_int_fpu_en */>(
+                /*num_rows_per_matrix=*/4, /*math_format=*/math_format);
+#else
+            _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false /* is_int_fpu_en */>(
+                /*num_rows_per_matrix=*/4, /*math_format=*/math_format);
+#endif
+
+            // Index tiles follow the value tiles in dest.
+            for (int tile = 0; tile < NUM_VALUE_TILES; ++tile)
+            {
+                _llk_math_eltwise_unary_datacopy_<DataCopyType::A2D, DstSync::SyncHalf, is_fp32_dest_acc_en, BroadcastType::NONE, unpack_to_dest>(
+                    stage_index * NUM_VALUE_TILES + tile, math_format, math_format);
+            }
+        }
+
+        _llk_math_eltwise_unary_sfpu_start_<DstSync::SyncHalf>(0);
+        ckernel::sfpu::_bitonic_topk_sort_tiles_<false, is_fp32_dest_acc_en, TOPK_STABLE_SORT>(NUM_VALUE_TILES, TOPK_SORT_DIRECTION);
+        _llk_math_eltwise_unary_sfpu_done_();
+
+        _llk_math_dest_section_done_<dest_sync, is_fp32_dest_acc_en>();
+    }
+}
+#endif // LLK_TRISC_MATH
+
+// ============================================================================
+// PACK TRISC
+// ============================================================================
+
+#ifdef LLK_TRISC_PACK
+#include "llk_pack.h"
+#include "llk_pack_common.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+    const int NUM_VALUE_TILES = params.FULL_CT_DIM / NUM_STAGES;
+
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_dest_init_<dest_sync, is_fp32_dest_acc_en>();
+#else
+    _llk_pack_dest_init_<dest_sync, false, false>();
+#endif
+
+    const std::uint32_t pack_src_data_types[NUM_STAGES] = {formats.pack_src, ckernel::to_underlying(DataFormat::UInt16)};
+    const std::uint32_t pack_dst_data_types[NUM_STAGES] = {formats.pack_dst, ckernel::to_underlying(DataFormat::UInt16)};
+
+    for (int current_tile_row = 0; current_tile_row < params.FULL_RT_DIM; ++current_tile_row)
+    {
+        _llk_packer_wait_for_math_done_();
+
+        for (Stage stage : {Stage::Values, Stage::Indices})
+        {
+            const int stage_index               = static_cast<int>(stage);
+            const std::uint32_t pack_src_format = pack_src_data_types[stage_index];
+            const std::uint32_t pack_dst_format = pack_dst_data_types[stage_index];
+
+            if (current_tile_row == 0 && stage == Stage::Values)
+            {
+#ifdef ARCH_BLACKHOLE
+                _llk_pack_hw_configure_<is_fp32_dest_acc_en, false /* untilize */, false /* tilize */>(pack_src_format, pack_dst_format, 16 * 16 * 4);
+#else
+                _llk_pack_hw_configure_<is_fp32_dest_acc_en, false /* untilize */>(pack_src_format, pack_dst_format, 16 * 16 * 4);
+#endif
+            }
+            else
+            {
+#ifdef ARCH_BLACKHOLE
+                _llk_pack_reconfig_data_format_<is_fp32_dest_acc_en, false /* is_tile_dim_reconfig_en */>(
+                    pack_src_format,
+                    pack_dst_format,
+                    16 * 16 * 4,
+                    FACE_R_DIM,
+                    TILE_C_DIM,
+                    4 /* num_faces */,
+                    false /* partial_face */,
+                    false /* narrow_tile */,
+                    1 /* num_tiles */);
+#else
+                _llk_pack_reconfig_data_format_<is_fp32_dest_acc_en, false /* is_tile_dim_reconfig_en */>(
+                    pack_src_format, pack_dst_format, 16 * 16 * 4, FACE_R_DIM, 4 /* num_faces */, false /* partial_face */, false /* narrow_tile */);
+#endif
+            }
+
+            _llk_pack_init_<false, false>(pack_dst_format);
+
+            const int first_tile_index = current_tile_row * params.FULL_CT_DIM + stage_index * NUM_VALUE_TILES;
+            for (int tile = 0; tile < NUM_VALUE_TILES; ++tile)
+            {
+                _llk_pack_<dest_sync, is_fp32_dest_acc_en, false>(
+                    stage_index * NUM_VALUE_TILES + tile, L1_ADDRESS(params.buffer_Res[first_tile_index + tile]));
+            }
+        }
+        _llk_pack_dest_section_done_<dest_sync, is_fp32_dest_acc_en>();
+    }
+}
+#endif // LLK_TRISC_PACK
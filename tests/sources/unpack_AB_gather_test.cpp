@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+#include <cstdio>
+
+#include "ckernel.h"
+#include "llk_defs.h"
+#include "tensor_shape.h"
+
+// Globals
+std::uint32_t unp_cfg_context          = 0;
+std::uint32_t pack_sync_tile_dst_ptr   = 0;
+std::uint32_t math_sync_tile_dst_index = 0;
+
+// Tile i of the result is A[num_tiles - 1 - i] op B[(i + 1) % num_tiles], so both operands are gathered out of order.
+// Every dest block is unpacked from one pair of address lists of NUM_TILES_IN_BLOCK entries.
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "llk_unpack_AB.h"
+#include "llk_unpack_common.h"
+#include "params.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+    _llk_unpack_hw_configure_<is_fp32_dest_acc_en>(
+        formats.unpack_A_src, formats.unpack_B_src, formats.unpack_A_dst, formats.unpack_B_dst, FACE_R_DIM, FACE_R_DIM, 4, 4);
+    _llk_unpack_AB_init_<>(DEFAULT_TENSOR_SHAPE);
+
+    LLK_ASSERT(params.NUM_TILES_IN_BLOCK <= DEST_NUM_TILES_FP16_HALF, "NUM_TILES_IN_BLOCK exceeds the address list size");
+
+    const std::uint32_t num_tiles = params.NUM_BLOCKS * params.NUM_TILES_IN_BLOCK;
+
+    std::uint32_t l1_addresses_a[DEST_NUM_TILES_FP16_HALF];
+    std::uint32_t l1_addresses_b[DEST_NUM_TILES_FP16_HALF];
+    for (std::uint32_t block_num = 0; block_num < params.NUM_BLOCKS; ++block_num)
+    {
+        for (std::uint32_t tile_num = 0; tile_num < params.NUM_TILES_IN_BLOCK; ++tile_num)
+        {
+            const std::uint32_t tile = block_num * params.NUM_TILES_IN_BLOCK + tile_num;
+            l1_addresses_a[tile_num] = L1_ADDRESS(params.buffer_A[num_tiles - 1 - tile]);
+            l1_addresses_b[tile_num] = L1_ADDRESS(params.buffer_B[(tile + 1) % num_tiles]);
+        }
+        _llk_unpack_AB_gather_(l1_addresses_a, l1_addresses_b, params.NUM_TILES_IN_BLOCK);
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+#include "llk_math_common.h"
+#include "llk_math_eltwise_binary.h"
+#include "params.h"
+
+using namespace ckernel;
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+    _llk_math_pack_sync_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    _llk_math_hw_configure_<is_fp32_dest_acc_en>(formats.math, formats.math);
+    _llk_math_eltwise_binary_init_<ELTWISE_BINARY_OP, BroadcastType::NONE, MathFidelity::LoFi>(DEFAULT_TENSOR_SHAPE, 0 /* acc_to_dest */);
+
+    for (std::uint32_t block_num = 0; block_num < params.NUM_BLOCKS; ++block_num)
+    {
+        _llk_math_wait_for_dest_available_<DstSync::SyncHalf>();
+        for (std::uint32_t tile_num = 0; tile_num < params.NUM_TILES_IN_BLOCK; ++tile_num)
+        {
+            LLK_ASSERT(
+                (tile_num < get_dest_max_tiles<DstSync::SyncHalf, is_fp32_dest_acc_en, DstTileShape::Tile32x32>()), "tile_num exceeds max dest tiles");
+            _llk_math_eltwise_binary_<ELTWISE_BINARY_OP, BroadcastType::NONE, DstSync::SyncHalf, is_fp32_dest_acc_en, MathFidelity::LoFi>(
+                DEFAULT_TENSOR_SHAPE, tile_num, false);
+        }
+        _llk_math_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+#include "llk_pack.h"
+#include "llk_pack_common.h"
+#include "params.h"
+
+void run_kernel(RUNTIME_PARAMETERS params)
+{
+#if defined(RUNTIME_FORMATS) && !defined(SPEED_OF_LIGHT)
+    const FormatConfig& formats = params.formats;
+#endif
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false, false>(formats.pack_src, formats.pack_dst, 16 * 16 * 4, FACE_R_DIM, TILE_C_DIM, 4);
+    _llk_pack_init_<false, false, false>(formats.pack_dst, FACE_R_DIM, TILE_C_DIM, 4);
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+#else
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false>(formats.pack_src, formats.pack_dst, 16 * 16 * 4, FACE_R_DIM, 4);
+    _llk_pack_init_<false, false>(formats.pack_dst, FACE_R_DIM, 4);
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en, false>();
+#endif
+
+    for (std::uint32_t block_num = 0; block_num < params.NUM_BLOCKS; ++block_num)
+    {
+        _llk_packer_wait_for_math_done_();
+        for (std::uint32_t tile_num = 0; tile_num < params.NUM_TILES_IN_BLOCK; ++tile_num)
+        {
+            _llk_pack_<DstSync::SyncHalf, is_fp32_dest_acc_en, false>(
+                tile_num, L1_ADDRESS(params.buffer_Res[block_num * params.NUM_TILES_IN_BLOCK + tile_num]));
+        }
+        _llk_pack_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    }
+}
+#endif
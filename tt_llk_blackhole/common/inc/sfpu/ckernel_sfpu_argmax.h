@@ -0,0 +1,217 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel_addrmod.h"
+#include "ckernel_instr_params.h"
+#include "ckernel_ops.h"
+#include "llk_defs.h"
+#include "sfpi.h"
+
+namespace ckernel
+{
+namespace sfpu
+{
+
+// ============================================================================
+// Row argmax / argmin
+// ============================================================================
+// Every SFPU vector covers 4 rows of a face with the even or odd columns of each row in 8 lanes, the same layout as
+// the fused row softmax. Every lane keeps a running (value, index) pair while the vectors of a row band are scanned in
+// increasing column order, the column indices are generated in registers so no index tile has to be unpacked. The 8
+// lanes of every row are combined with a rotate butterfly at the end.
+//
+// Rows longer than what fits in dest are processed in chunks: with accumulate set the running pair is seeded from the
+// results of the previous chunk and column_offset holds the column of the first datum of the chunk.
+
+// size of each tile in Dest is 64/SFP_DESTREG_STRIDE = 32 rows when using sfpi to load/store
+constexpr std::uint32_t ARGMAX_DST_TILE_SIZE_SFPI = 32;
+// Vectors of one 4-row slice within a tile: left face even/odd columns, right face even/odd columns
+constexpr std::uint32_t ARGMAX_SLICE_OFFSETS[4] = {0, 1, 8, 9};
+// Column of lane 0 of each of the vectors above
+constexpr std::uint32_t ARGMAX_SLICE_COLUMNS[4] = {0, 1, 16, 17};
+
+/**
+ * @brief Replaces (value, index) with (candidate, candidate_index) if the candidate is better,
+ * ties go to the smaller index like torch.argmax.
+ */
+template <PoolType pool_type>
+sfpi_inline void _argmax_combine_(sfpi::vFloat &value, sfpi::vInt &index, const sfpi::vFloat candidate, const sfpi::vInt candidate_index)
+{
+    if constexpr (pool_type == PoolType::MAX)
+    {
+        v_if ((candidate > value) || ((candidate == value) && (candidate_index < index)))
+        {
+            value = candidate;
+            index = candidate_index;
+        }
+        v_endif;
+    }
+    else
+    {
+        v_if ((candidate < value) || ((candidate == value) && (candidate_index < index)))
+        {
+            value = candidate;
+            index = candidate_index;
+        }
+        v_endif;
+    }
+}
+
+template <int rotation>
+sfpi_inline sfpi::vFloat _argmax_subvec_rotate_(sfpi::vFloat val)
+{
+#pragma GCC unroll 4
+    for (int i = 0; i < rotation; i++)
+    {
+        val = sfpi::subvec_shflror1(val);
+    }
+    return val;
+}
+
+template <PoolType pool_type, int rotation>
+sfpi_inline void _argmax_butterfly_step_(sfpi::vFloat &value, sfpi::vInt &index)
+{
+    sfpi::vFloat other_value = _argmax_subvec_rotate_<rotation>(value);
+    sfpi::vInt other_index   = sfpi::reinterpret<sfpi::vInt>(_argmax_subvec_rotate_<rotation>(sfpi::reinterpret<sfpi::vFloat>(index)));
+    _argmax_combine_<pool_type>(value, index, other_value, other_index);
+}
+
+// Indices are stored as int32 with fp32 dest and as uint16 otherwise, like the max pool indices.
+// The sfpi load/store intrinsics let the compiler pick the lreg, a fixed lreg could hold a live sfpi value.
+template <bool is_fp32_dest_acc_en>
+sfpi_inline sfpi::vInt _argmax_load_index_(const std::uint32_t index)
+{
+    constexpr std::uint8_t instr_mod_index = is_fp32_dest_acc_en ? InstrModLoadStore::INT32 : InstrModLoadStore::LO16;
+    return sfpi::vInt(__builtin_rvtt_sfpload(instr_mod_index, sfpi::SFPLOAD_ADDR_MODE_NOINC, 2 * index));
+}
+
+template <bool is_fp32_dest_acc_en>
+sfpi_inline void _argmax_store_index_(const sfpi::vInt value, const std::uint32_t index)
+{
+    constexpr std::uint8_t instr_mod_index = is_fp32_dest_acc_en ? InstrModLoadStore::INT32 : InstrModLoadStore::LO16;
+    __builtin_rvtt_sfpstore(value.get(), instr_mod_index, sfpi::SFPLOAD_ADDR_MODE_NOINC, 2 * index);
+}
+
+/**
+ * @brief Row argmax (or argmin) over a row band of tiles in dest.
+ *        Writes the max (min) of every row to column 0 of the values tile and its column index to column 0 of the
+ *        indices tile, all other datums of both tiles are zeroed. Ties resolve to the smallest index.
+ *        Tiles of the row band must be consecutive in dest, starting at the tile set by _llk_math_eltwise_unary_sfpu_start_.
+ *
+ * @tparam is_fp32_dest_acc_en Indices are int32 with fp32 dest, uint16 (up to 65535) otherwise
+ * @tparam pool_type PoolType::MAX for argmax, PoolType::MIN for argmin
+ * @param block_ct_dim Number of tiles along the row
+ * @param values_tile_idx Dest tile of the values result, relative to the first tile of the row band
+ * @param indices_tile_idx Dest tile of the indices result, relative to the first tile of the row band
+ * @param column_offset Column index of the first column of the row band
+ * @param accumulate The values and indices tiles hold the result of the previous chunk of the rows, which is merged in
+ *
+ * @note The values and indices tiles must not be part of the row band.
+ */
+template <bool is_fp32_dest_acc_en, PoolType pool_type = PoolType::MAX>
+inline void _calculate_argmax_row_(
+    const std::uint32_t block_ct_dim,
+    const std::uint32_t values_tile_idx,
+    const std::uint32_t indices_tile_idx,
+    const std::uint32_t column_offset = 0,
+    const bool accumulate             = false)
+{
+    static_assert(pool_type == PoolType::MAX || pool_type == PoolType::MIN, "Row argmax supports only PoolType::MAX and PoolType::MIN");
+
+    // LTILEID holds 2 * lane index, every 8 lanes form one row of the vector and cover the even (or odd) columns of a face
+    sfpi::vUInt tile_id       = sfpi::vConstTileId;
+    const sfpi::vInt lane_col = sfpi::reinterpret<sfpi::vInt>(tile_id & 0xE);
+
+    const std::uint32_t values_base  = values_tile_idx * ARGMAX_DST_TILE_SIZE_SFPI;
+    const std::uint32_t indices_base = indices_tile_idx * ARGMAX_DST_TILE_SIZE_SFPI;
+
+    // Upper face pair (faces 0/1) holds rows 0-15 of the tile, lower face pair (faces 2/3) rows 16-31
+    for (std::uint32_t face_pair = 0; face_pair < 2; face_pair++)
+    {
+        for (std::uint32_t slice = 0; slice < 4; slice++)
+        {
+            const std::uint32_t slice_base = face_pair * 16 + slice * 2;
+
+            // The first vector seeds the running pair
+            sfpi::vFloat value = sfpi::dst_reg[slice_base];
+            sfpi::vInt index   = lane_col + static_cast<int>(column_offset);
+
+            for (std::uint32_t ct = 0; ct < block_ct_dim; ct++)
+            {
+#pragma GCC unroll 4
+                for (std::uint32_t v = (ct == 0) ? 1 : 0; v < 4; v++)
+                {
+                    sfpi::vFloat in            = sfpi::dst_reg[slice_base + ct * ARGMAX_DST_TILE_SIZE_SFPI + ARGMAX_SLICE_OFFSETS[v]];
+                    const std::uint32_t column = column_offset + ct * 32 + ARGMAX_SLICE_COLUMNS[v];
+
+                    // Columns of a lane only increase, strict comparison keeps the first occurrence
+                    if constexpr (pool_type == PoolType::MAX)
+                    {
+                        v_if (in > value)
+                        {
+                            value = in;
+                            index = lane_col + static_cast<int>(column);
+                        }
+                        v_endif;
+                    }
+                    else
+                    {
+                        v_if (in < value)
+                        {
+                            value = in;
+                            index = lane_col + static_cast<int>(column);
+                        }
+                        v_endif;
+                    }
+                }
+            }
+
+            if (accumulate)
+            {
+                // Only column 0 of the previous result is valid
+                sfpi::vFloat previous_value = sfpi::dst_reg[values_base + slice_base];
+                sfpi::vInt previous_index   = _argmax_load_index_<is_fp32_dest_acc_en>(indices_base + slice_base);
+                v_if (lane_col == 0)
+                {
+                    _argmax_combine_<pool_type>(value, index, previous_value, previous_index);
+                }
+                v_endif;
+            }
+
+            // Butterfly over the 8 lanes of a row, leaves the result of the row in all of its lanes
+            _argmax_butterfly_step_<pool_type, 4>(value, index);
+            _argmax_butterfly_step_<pool_type, 2>(value, index);
+            _argmax_butterfly_step_<pool_type, 1>(value, index);
+
+            v_if (lane_col != 0)
+            {
+                value = 0.0f;
+                index = 0;
+            }
+            v_endif;
+
+            if constexpr (!is_fp32_dest_acc_en)
+            {
+                value = sfpi::reinterpret<sfpi::vFloat>(sfpi::float_to_fp16b(value, 0));
+            }
+            sfpi::dst_reg[values_base + slice_base] = value;
+            _argmax_store_index_<is_fp32_dest_acc_en>(index, indices_base + slice_base);
+
+            // Zero bits are zero in every format, also for the indices
+#pragma GCC unroll 3
+            for (std::uint32_t v = 1; v < 4; v++)
+            {
+                sfpi::dst_reg[values_base + slice_base + ARGMAX_SLICE_OFFSETS[v]]  = sfpi::vConst0;
+                sfpi::dst_reg[indices_base + slice_base + ARGMAX_SLICE_OFFSETS[v]] = sfpi::vConst0;
+            }
+        }
+    }
+}
+
+} // namespace sfpu
+} // namespace ckernel
@@ -0,0 +1,197 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+#include "ckernel_defs.h"
+#include "sfpi.h"
+
+namespace ckernel
+{
+namespace sfpu
+{
+
+// ============================================================================
+// Row-direction cumulative sum / product / max
+// ============================================================================
+// Every SFPU vector covers 4 rows of a face with the even or odd columns of each row in 8 lanes, so lane l of the even
+// and odd vectors of a face holds columns 2l and 2l + 1. The two columns of every lane are combined first, then the
+// pairs are scanned over the 8 lanes of each row with a Hillis-Steele scan (3 masked rotate steps). The carry of every
+// row is kept in a register while the faces and tiles of a row band are walked left to right, so a whole row band is
+// scanned in one pass over dest.
+//
+// Rows longer than what fits in dest are processed in chunks: the carry after every chunk is written to the carry tile
+// and with accumulate set the next chunk is seeded from it.
+
+// size of each tile in Dest is 64/SFP_DESTREG_STRIDE = 32 rows when using sfpi to load/store
+constexpr std::uint32_t CUMULATIVE_DST_TILE_SIZE_SFPI = 32;
+// Even column vector of the left and right face of a 4-row slice, the odd column vector follows each of them
+constexpr std::uint32_t CUMULATIVE_FACE_OFFSETS[2] = {0, 8};
+
+template <CumulativeOp op>
+sfpi_inline sfpi::vFloat _cumulative_identity_()
+{
+    if constexpr (op == CumulativeOp::Sum)
+    {
+        return sfpi::vConst0;
+    }
+    else if constexpr (op == CumulativeOp::Prod)
+    {
+        return sfpi::vConst1;
+    }
+    else
+    {
+        return -std::numeric_limits<float>::infinity();
+    }
+}
+
+template <CumulativeOp op>
+sfpi_inline sfpi::vFloat _cumulative_combine_(const sfpi::vFloat a, const sfpi::vFloat b)
+{
+    if constexpr (op == CumulativeOp::Sum)
+    {
+        return a + b;
+    }
+    else if constexpr (op == CumulativeOp::Prod)
+    {
+        return a * b;
+    }
+    else
+    {
+        // vec_min_max leaves the larger value in its second operand
+        sfpi::vFloat smaller = a;
+        sfpi::vFloat larger  = b;
+        sfpi::vec_min_max(smaller, larger);
+        return larger;
+    }
+}
+
+// Lane l of every row takes the value of lane l - rotation (mod 8)
+template <int rotation>
+sfpi_inline sfpi::vFloat _cumulative_subvec_rotate_(sfpi::vFloat val)
+{
+#pragma GCC unroll 4
+    for (int i = 0; i < rotation; i++)
+    {
+        val = sfpi::subvec_shflror1(val);
+    }
+    return val;
+}
+
+// One Hillis-Steele step, lanes that would wrap around keep their value
+template <CumulativeOp op, int distance>
+sfpi_inline void _cumulative_scan_step_(sfpi::vFloat &val, const sfpi::vInt lane_col)
+{
+    sfpi::vFloat other = _cumulative_subvec_rotate_<distance>(val);
+    v_if (lane_col >= 2 * distance)
+    {
+        val = _cumulative_combine_<op>(other, val);
+    }
+    v_endif;
+}
+
+/**
+ * @brief Inclusive scan of a row band of tiles along the rows (over the columns) in dest.
+ *        Every datum is replaced by the sum (CumulativeOp::Sum), product (CumulativeOp::Prod) or max (CumulativeOp::Max)
+ *        of itself and all datums to its left in the same row of the row band.
+ *        Tiles of the row band must be consecutive in dest, starting at the tile set by _llk_math_eltwise_unary_sfpu_start_.
+ *
+ * @tparam is_fp32_dest_acc_en Results are rounded to fp16_b when dest is 16 bit, the carry is kept in fp32 within a call
+ * @tparam op The scan operation
+ * @param block_ct_dim Number of tiles along the row
+ * @param carry_tile_idx Dest tile of the carry, relative to the first tile of the row band. After the call every datum
+ *        of row r of the carry tile holds the scan result of row r over the row band
+ * @param accumulate The carry tile holds the result of the previous chunk of the rows, which seeds the scan
+ *
+ * @note The carry tile must not be part of the row band.
+ */
+template <bool is_fp32_dest_acc_en, CumulativeOp op>
+inline void _calculate_cumulative_row_(const std::uint32_t block_ct_dim, const std::uint32_t carry_tile_idx, const bool accumulate = false)
+{
+    // LTILEID holds 2 * lane index, every 8 lanes form one row of the vector
+    sfpi::vUInt tile_id       = sfpi::vConstTileId;
+    const sfpi::vInt lane_col = sfpi::reinterpret<sfpi::vInt>(tile_id & 0xE);
+
+    const std::uint32_t carry_base = carry_tile_idx * CUMULATIVE_DST_TILE_SIZE_SFPI;
+
+    // Upper face pair (faces 0/1) holds rows 0-15 of the tile, lower face pair (faces 2/3) rows 16-31
+    for (std::uint32_t face_pair = 0; face_pair < 2; face_pair++)
+    {
+        for (std::uint32_t slice = 0; slice < 4; slice++)
+        {
+            const std::uint32_t slice_base = face_pair * 16 + slice * 2;
+
+            // All lanes of a row hold the carry of the row
+            sfpi::vFloat carry = _cumulative_identity_<op>();
+            if (accumulate)
+            {
+                carry = sfpi::dst_reg[carry_base + slice_base];
+            }
+
+            for (std::uint32_t ct = 0; ct < block_ct_dim; ct++)
+            {
+#pragma GCC unroll 2
+                for (std::uint32_t face = 0; face < 2; face++)
+                {
+                    const std::uint32_t even_index = slice_base + ct * CUMULATIVE_DST_TILE_SIZE_SFPI + CUMULATIVE_FACE_OFFSETS[face];
+
+                    sfpi::vFloat even = sfpi::dst_reg[even_index];
+                    sfpi::vFloat odd  = sfpi::dst_reg[even_index + 1];
+
+                    // Inclusive scan of the column pairs ends on the odd columns
+                    sfpi::vFloat inclusive = _cumulative_combine_<op>(even, odd);
+                    _cumulative_scan_step_<op, 1>(inclusive, lane_col);
+                    _cumulative_scan_step_<op, 2>(inclusive, lane_col);
+                    _cumulative_scan_step_<op, 4>(inclusive, lane_col);
+
+                    // Rotating by one lane gives the exclusive scan in lanes 1-7 and the total of the row in lane 0
+                    sfpi::vFloat exclusive = _cumulative_subvec_rotate_<1>(inclusive);
+                    sfpi::vFloat total     = exclusive;
+                    v_if (lane_col == 0)
+                    {
+                        exclusive = _cumulative_identity_<op>();
+                    }
+                    v_else
+                    {
+                        total = _cumulative_identity_<op>();
+                    }
+                    v_endif;
+
+                    even = _cumulative_combine_<op>(carry, _cumulative_combine_<op>(exclusive, even));
+                    odd  = _cumulative_combine_<op>(carry, inclusive);
+                    if constexpr (!is_fp32_dest_acc_en)
+                    {
+                        even = sfpi::reinterpret<sfpi::vFloat>(sfpi::float_to_fp16b(even, 0));
+                        odd  = sfpi::reinterpret<sfpi::vFloat>(sfpi::float_to_fp16b(odd, 0));
+                    }
+                    sfpi::dst_reg[even_index]     = even;
+                    sfpi::dst_reg[even_index + 1] = odd;
+
+                    // Broadcast the total from lane 0, combining with the identity keeps it exact
+                    total = _cumulative_combine_<op>(total, _cumulative_subvec_rotate_<4>(total));
+                    total = _cumulative_combine_<op>(total, _cumulative_subvec_rotate_<2>(total));
+                    total = _cumulative_combine_<op>(total, _cumulative_subvec_rotate_<1>(total));
+                    carry = _cumulative_combine_<op>(carry, total);
+                }
+            }
+
+            if constexpr (!is_fp32_dest_acc_en)
+            {
+                carry = sfpi::reinterpret<sfpi::vFloat>(sfpi::float_to_fp16b(carry, 0));
+            }
+#pragma GCC unroll 2
+            for (std::uint32_t face = 0; face < 2; face++)
+            {
+                sfpi::dst_reg[carry_base + slice_base + CUMULATIVE_FACE_OFFSETS[face]]     = carry;
+                sfpi::dst_reg[carry_base + slice_base + CUMULATIVE_FACE_OFFSETS[face] + 1] = carry;
+            }
+        }
+    }
+}
+
+} // namespace sfpu
+} // namespace ckernel
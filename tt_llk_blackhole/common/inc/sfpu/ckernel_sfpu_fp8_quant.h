@@ -0,0 +1,250 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel_defs.h"
+#include "ckernel_sfpu_recip.h"
+#include "sfpi.h"
+
+namespace ckernel
+{
+namespace sfpu
+{
+
+// ============================================================================
+// Block-wise FP8 quantize / dequantize
+// ============================================================================
+// Every row of a tile is one block of 32 datums with its own scale = absmax / FP8 max. Every SFPU vector covers 4 rows
+// of a face with the even or odd columns of each row in 8 lanes, so the 4 vectors of a 4-row slice (left/right face,
+// even/odd columns) hold 4 complete blocks and the absmax of every block is folded over its 8 lanes with a rotate
+// butterfly, the same scheme as the fused row softmax.
+//
+// Quantized datums are left in dest as the FP8 values they round to, which are exact in both fp32 and fp16_b, so the
+// packer can write them out as FP8 without another rounding step. The scale of every row goes to column 0 of the
+// scales tile, all other datums of the scales tile are zeroed.
+
+// size of each tile in Dest is 64/SFP_DESTREG_STRIDE = 32 rows when using sfpi to load/store
+constexpr std::uint32_t FP8_QUANT_DST_TILE_SIZE_SFPI = 32;
+// Vectors of one 4-row slice within a tile: left face even/odd columns, right face even/odd columns
+constexpr std::uint32_t FP8_QUANT_SLICE_OFFSETS[4] = {0, 1, 8, 9};
+
+template <Fp8Format format>
+struct Fp8FormatTraits;
+
+template <>
+struct Fp8FormatTraits<Fp8Format::E4M3>
+{
+    static constexpr std::uint32_t mantissa_bits = 3;
+    static constexpr float max_value             = 448.0f;
+    static constexpr float min_normal            = 0.015625f; // 2^-6
+};
+
+template <>
+struct Fp8FormatTraits<Fp8Format::E5M2>
+{
+    static constexpr std::uint32_t mantissa_bits = 2;
+    static constexpr float max_value             = 57344.0f;
+    static constexpr float min_normal            = 6.103515625e-05f; // 2^-14
+};
+
+template <int rotation>
+sfpi_inline sfpi::vFloat _fp8_subvec_rotate_(sfpi::vFloat val)
+{
+#pragma GCC unroll 4
+    for (int i = 0; i < rotation; i++)
+    {
+        val = sfpi::subvec_shflror1(val);
+    }
+    return val;
+}
+
+/**
+ * @brief Folds a non-negative per-lane value into the max of the 8 lanes of every row, the result is in all lanes.
+ */
+sfpi_inline sfpi::vFloat _fp8_row_max_(sfpi::vFloat row_max)
+{
+    // vec_min_max leaves the larger value in its second operand
+    sfpi::vFloat other = _fp8_subvec_rotate_<4>(row_max);
+    sfpi::vec_min_max(other, row_max);
+    other = _fp8_subvec_rotate_<2>(row_max);
+    sfpi::vec_min_max(other, row_max);
+    other = _fp8_subvec_rotate_<1>(row_max);
+    sfpi::vec_min_max(other, row_max);
+    return row_max;
+}
+
+/**
+ * @brief Rounds to the nearest FP8 value (ties to even) and saturates to the largest finite FP8 value.
+ *        Subnormals are rounded on a grid of the smallest subnormal step by lifting them into the binade of the smallest
+ *        normal value, where the kept mantissa bits have exactly that step.
+ */
+template <Fp8Format format>
+sfpi_inline sfpi::vFloat _fp8_round_saturate_(const sfpi::vFloat val)
+{
+    using traits                           = Fp8FormatTraits<format>;
+    constexpr std::uint32_t dropped_bits   = 23 - traits::mantissa_bits;
+    constexpr std::uint32_t half_ulp_minus = (1u << (dropped_bits - 1)) - 1;
+
+    sfpi::vFloat magnitude = sfpi::abs(val);
+
+    sfpi::vFloat subnormal_offset = 0.0f;
+    v_if (magnitude < traits::min_normal)
+    {
+        subnormal_offset = traits::min_normal;
+    }
+    v_endif;
+    magnitude = magnitude + subnormal_offset;
+
+    // Round to nearest even on the fp32 bits, a mantissa carry moves into the exponent
+    sfpi::vUInt bits = sfpi::reinterpret<sfpi::vUInt>(magnitude);
+    bits             = bits + ((bits >> dropped_bits) & 1) + sfpi::vUInt(half_ulp_minus);
+    bits             = (bits >> dropped_bits) << dropped_bits;
+    magnitude        = sfpi::reinterpret<sfpi::vFloat>(bits) - subnormal_offset;
+
+    v_if (magnitude > traits::max_value)
+    {
+        magnitude = traits::max_value;
+    }
+    v_endif;
+
+    return sfpi::setsgn(magnitude, val);
+}
+
+inline void _init_fp8_block_quant_()
+{
+    _init_sfpu_reciprocal_<false>();
+}
+
+/**
+ * @brief Quantizes consecutive tiles in dest to FP8 with one scale per 32-datum row.
+ *        Every datum becomes round_saturate(x / scale) with scale = absmax(row) / FP8 max, rows of zeros get scale 1.
+ *
+ * @tparam is_fp32_dest_acc_en The scale is rounded to fp16_b before use when dest is 16 bit, so dequantization with
+ *         the stored scale is consistent with the quantization
+ * @tparam format Fp8Format::E4M3 (max 448) or Fp8Format::E5M2 (max 57344)
+ * @param num_tiles Number of tiles to quantize in place, starting at the tile set by _llk_math_eltwise_unary_sfpu_start_
+ * @param scales_tile_idx Dest tile of the scales of the first tile, relative to the first tile, tile t uses
+ *        scales_tile_idx + t
+ *
+ * @note The scales tiles must not overlap the quantized tiles.
+ */
+template <bool is_fp32_dest_acc_en, Fp8Format format>
+inline void _calculate_fp8_block_quant_(const std::uint32_t num_tiles, const std::uint32_t scales_tile_idx)
+{
+    using traits = Fp8FormatTraits<format>;
+
+    sfpi::vUInt tile_id        = sfpi::vConstTileId;
+    const sfpi::vUInt lane_col = tile_id & 0xE;
+
+    for (std::uint32_t tile = 0; tile < num_tiles; tile++)
+    {
+        const std::uint32_t tile_base   = tile * FP8_QUANT_DST_TILE_SIZE_SFPI;
+        const std::uint32_t scales_base = (scales_tile_idx + tile) * FP8_QUANT_DST_TILE_SIZE_SFPI;
+
+        // Upper face pair (faces 0/1) holds rows 0-15 of the tile, lower face pair (faces 2/3) rows 16-31
+        for (std::uint32_t face_pair = 0; face_pair < 2; face_pair++)
+        {
+            for (std::uint32_t slice = 0; slice < 4; slice++)
+            {
+                const std::uint32_t slice_base = face_pair * 16 + slice * 2;
+
+                sfpi::vFloat absmax = sfpi::abs(sfpi::dst_reg[tile_base + slice_base]);
+#pragma GCC unroll 3
+                for (std::uint32_t v = 1; v < 4; v++)
+                {
+                    sfpi::vFloat in = sfpi::abs(sfpi::dst_reg[tile_base + slice_base + FP8_QUANT_SLICE_OFFSETS[v]]);
+                    sfpi::vec_min_max(in, absmax);
+                }
+                absmax = _fp8_row_max_(absmax);
+
+                sfpi::vFloat scale = absmax * (1.0f / traits::max_value);
+                v_if (absmax == 0.0f)
+                {
+                    scale = sfpi::vConst1;
+                }
+                v_endif;
+                if constexpr (!is_fp32_dest_acc_en)
+                {
+                    scale = sfpi::reinterpret<sfpi::vFloat>(sfpi::float_to_fp16b(scale, 0));
+                }
+                const sfpi::vFloat inv_scale = _sfpu_reciprocal_<2>(scale);
+
+#pragma GCC unroll 4
+                for (std::uint32_t v = 0; v < 4; v++)
+                {
+                    const std::uint32_t index = tile_base + slice_base + FP8_QUANT_SLICE_OFFSETS[v];
+                    sfpi::dst_reg[index]      = _fp8_round_saturate_<format>(sfpi::dst_reg[index] * inv_scale);
+                }
+
+                v_if (lane_col != 0)
+                {
+                    scale = 0.0f;
+                }
+                v_endif;
+                sfpi::dst_reg[scales_base + slice_base] = scale;
+#pragma GCC unroll 3
+                for (std::uint32_t v = 1; v < 4; v++)
+                {
+                    sfpi::dst_reg[scales_base + slice_base + FP8_QUANT_SLICE_OFFSETS[v]] = sfpi::vConst0;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Inverse of _calculate_fp8_block_quant_: multiplies every datum by the scale of its row.
+ *
+ * @tparam is_fp32_dest_acc_en Results are rounded to fp16_b when dest is 16 bit
+ * @param num_tiles Number of tiles to dequantize in place, starting at the tile set by _llk_math_eltwise_unary_sfpu_start_
+ * @param scales_tile_idx Dest tile of the scales of the first tile, relative to the first tile, tile t uses
+ *        scales_tile_idx + t. Only column 0 is read.
+ */
+template <bool is_fp32_dest_acc_en>
+inline void _calculate_fp8_block_dequant_(const std::uint32_t num_tiles, const std::uint32_t scales_tile_idx)
+{
+    sfpi::vUInt tile_id        = sfpi::vConstTileId;
+    const sfpi::vUInt lane_col = tile_id & 0xE;
+
+    for (std::uint32_t tile = 0; tile < num_tiles; tile++)
+    {
+        const std::uint32_t tile_base   = tile * FP8_QUANT_DST_TILE_SIZE_SFPI;
+        const std::uint32_t scales_base = (scales_tile_idx + tile) * FP8_QUANT_DST_TILE_SIZE_SFPI;
+
+        for (std::uint32_t face_pair = 0; face_pair < 2; face_pair++)
+        {
+            for (std::uint32_t slice = 0; slice < 4; slice++)
+            {
+                const std::uint32_t slice_base = face_pair * 16 + slice * 2;
+
+                // Scales are positive, the max over the row broadcasts column 0 to all lanes of the row
+                sfpi::vFloat scale = sfpi::dst_reg[scales_base + slice_base];
+                v_if (lane_col != 0)
+                {
+                    scale = 0.0f;
+                }
+                v_endif;
+                scale = _fp8_row_max_(scale);
+
+#pragma GCC unroll 4
+                for (std::uint32_t v = 0; v < 4; v++)
+                {
+                    const std::uint32_t index = tile_base + slice_base + FP8_QUANT_SLICE_OFFSETS[v];
+                    sfpi::vFloat result       = sfpi::dst_reg[index] * scale;
+                    if constexpr (!is_fp32_dest_acc_en)
+                    {
+                        result = sfpi::reinterpret<sfpi::vFloat>(sfpi::float_to_fp16b(result, 0));
+                    }
+                    sfpi::dst_reg[index] = result;
+                }
+            }
+        }
+    }
+}
+
+} // namespace sfpu
+} // namespace ckernel
@@ -0,0 +1,453 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "sfpi.h"
+
+namespace ckernel::sfpu
+{
+
+// ============================================================================
+// Compile-time piecewise polynomial activations
+// ============================================================================
+// An activation is described by a spec struct, for example:
+//
+//   struct SigmoidSpec
+//   {
+//       static constexpr double lower = -8.0;          // polynomial range [lower, upper)
+//       static constexpr double upper = 8.0;
+//       static constexpr std::uint32_t degree = 6;     // degree of every piece, at most 7
+//       static constexpr double target_ulp = 1.0;      // allowed error, in ULPs of the result
+//       static constexpr std::uint32_t mantissa_bits = 7; // ULP size: 7 for bfloat16, 23 for fp32
+//       static constexpr double ulp_floor = 1.0 / 256; // results smaller than this are measured in ULPs of ulp_floor
+//       // outside the range the activation continues as slope * x + intercept
+//       static constexpr double lower_tail_slope = 0.0, lower_tail_intercept = 0.0;
+//       static constexpr double upper_tail_slope = 0.0, upper_tail_intercept = 1.0;
+//       static constexpr double eval(double x) { return 1.0 / (1.0 + cmath::exp(-x)); }
+//   };
+//
+// At compile time the range is split into 1, 2 or 4 equal intervals, the smallest count that meets the target error is
+// chosen, and every interval gets a Chebyshev interpolant (within a small factor of the minimax polynomial) centered in
+// the interval. At runtime every lane computes the index of its interval with one multiply-add and a binary search on
+// the index predicates the Horner evaluation of each interval, so the cost is known from the spec alone.
+//
+// The SFPU has no per-lane table lookup, every lane executes the polynomial of every interval and only keeps its own.
+// Doubling the intervals doubles the whole evaluation while raising the degree by one adds a single multiply-add per
+// interval, so the interval count is capped at 4 and specs are expected to reach their target with the degree.
+
+// Compile-time math for the reference functions of the specs
+namespace cmath
+{
+constexpr double PI  = 3.14159265358979323846;
+constexpr double LN2 = 0.69314718055994530942;
+
+constexpr double abs(const double x)
+{
+    return x < 0.0 ? -x : x;
+}
+
+constexpr double expm1_series(const double x)
+{
+    double term = x;
+    double sum  = x;
+    for (int i = 2; i < 20; i++)
+    {
+        term *= x / i;
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr double exp(double x)
+{
+    // exp(x) = exp(x / 2^k)^(2^k) with |x / 2^k| <= 1/16
+    int k = 0;
+    while (abs(x) > 0.0625)
+    {
+        x *= 0.5;
+        k++;
+    }
+    double result = 1.0 + expm1_series(x);
+    for (; k > 0; k--)
+    {
+        result *= result;
+    }
+    return result;
+}
+
+constexpr double expm1(const double x)
+{
+    return abs(x) < 0.5 ? expm1_series(x) : exp(x) - 1.0;
+}
+
+constexpr double log(double x)
+{
+    // x = m * 2^e with m in [1, 2), ln(m) = 2 * atanh((m - 1) / (m + 1))
+    int e = 0;
+    while (x >= 2.0)
+    {
+        x *= 0.5;
+        e++;
+    }
+    while (x < 1.0)
+    {
+        x *= 2.0;
+        e--;
+    }
+    const double s  = (x - 1.0) / (x + 1.0);
+    const double s2 = s * s;
+    double term     = s;
+    double sum      = 0.0;
+    for (int i = 1; i < 40; i += 2)
+    {
+        sum += term / i;
+        term *= s2;
+    }
+    return 2.0 * sum + e * LN2;
+}
+
+constexpr double log1p(const double x)
+{
+    return abs(x) < 1e-4 ? x - 0.5 * x * x : log(1.0 + x);
+}
+
+constexpr double tanh(const double x)
+{
+    if (abs(x) > 20.0)
+    {
+        return x < 0.0 ? -1.0 : 1.0;
+    }
+    const double e = expm1(2.0 * x);
+    return e / (e + 2.0);
+}
+
+constexpr double erf(const double x)
+{
+    const double ax = abs(x);
+    double result   = 0.0;
+    if (ax < 3.0)
+    {
+        // erf(x) = 2 / sqrt(pi) * sum((-1)^n * x^(2n + 1) / (n! * (2n + 1)))
+        double term = ax;
+        for (int n = 0; n < 60; n++)
+        {
+            result += term / (2 * n + 1);
+            term *= -ax * ax / (n + 1);
+        }
+        result *= 1.12837916709551257390;
+    }
+    else if (ax < 6.0)
+    {
+        // Asymptotic expansion of erfc(x)
+        const double inv_x2 = 1.0 / (ax * ax);
+        const double series = 1.0 - 0.5 * inv_x2 * (1.0 - 1.5 * inv_x2 * (1.0 - 2.5 * inv_x2 * (1.0 - 3.5 * inv_x2)));
+        result              = 1.0 - exp(-ax * ax) / (ax * 1.77245385090551602730) * series;
+    }
+    else
+    {
+        result = 1.0;
+    }
+    return x < 0.0 ? -result : result;
+}
+
+constexpr double cos(double x)
+{
+    // Only used for the Chebyshev nodes, x in [0, pi]
+    x                 = x - PI * 0.5;
+    const double x2   = x * x;
+    double term       = x;
+    double sin_result = 0.0;
+    for (int i = 1; i < 40; i += 2)
+    {
+        sin_result += term;
+        term *= -x2 / ((i + 1) * (i + 2));
+    }
+    return -sin_result;
+}
+} // namespace cmath
+
+constexpr std::uint32_t PIECEWISE_POLY_MAX_INTERVALS = 4;
+constexpr std::uint32_t PIECEWISE_POLY_MAX_DEGREE    = 7;
+// Number of points per interval the error of a candidate is checked at
+constexpr std::uint32_t PIECEWISE_POLY_ERROR_SAMPLES = 32;
+
+template <std::uint32_t NUM_COEFFICIENTS>
+struct PiecewisePolyPiece
+{
+    float lower_bound;
+    float center;
+    std::array<float, NUM_COEFFICIENTS> coefficients; // ascending powers of (x - center)
+};
+
+/**
+ * @brief Compile-time fit of the piecewise polynomial described by Spec, see the top of this file.
+ */
+template <typename Spec>
+struct PiecewisePolyFit
+{
+    static_assert(Spec::upper > Spec::lower, "Empty polynomial range");
+    static_assert(Spec::degree >= 1 && Spec::degree <= PIECEWISE_POLY_MAX_DEGREE, "Degree must be between 1 and 7 to keep the fp32 fit well conditioned");
+
+    static constexpr std::uint32_t NUM_COEFFICIENTS = Spec::degree + 1;
+    using Piece                                     = PiecewisePolyPiece<NUM_COEFFICIENTS>;
+
+    static constexpr Piece fit_piece(const double lower, const double upper)
+    {
+        constexpr std::uint32_t n = NUM_COEFFICIENTS;
+        const double center       = 0.5 * (lower + upper);
+        const double half_width   = 0.5 * (upper - lower);
+
+        // Chebyshev coefficients from the function values at the Chebyshev nodes
+        std::array<double, n> values {};
+        for (std::uint32_t k = 0; k < n; k++)
+        {
+            values[k] = Spec::eval(center + half_width * cmath::cos(cmath::PI * (2 * k + 1) / (2 * n)));
+        }
+        std::array<double, n> chebyshev {};
+        for (std::uint32_t j = 0; j < n; j++)
+        {
+            double sum = 0.0;
+            for (std::uint32_t k = 0; k < n; k++)
+            {
+                sum += values[k] * cmath::cos(cmath::PI * j * (2 * k + 1) / (2 * n));
+            }
+            chebyshev[j] = (j == 0 ? 1.0 : 2.0) * sum / n;
+        }
+
+        // Chebyshev series to monomials in t = (x - center) / half_width, T_(j + 1) = 2t T_j - T_(j - 1)
+        std::array<double, n> monomial {};
+        std::array<double, n> t_prev {};
+        std::array<double, n> t_curr {};
+        t_prev[0] = 1.0;
+        if constexpr (n > 1)
+        {
+            t_curr[1] = 1.0;
+        }
+        for (std::uint32_t j = 0; j < n; j++)
+        {
+            const std::array<double, n>& t_j = (j == 0) ? t_prev : t_curr;
+            for (std::uint32_t i = 0; i < n; i++)
+            {
+                monomial[i] += chebyshev[j] * t_j[i];
+            }
+            if (j >= 1)
+            {
+                std::array<double, n> t_next {};
+                for (std::uint32_t i = 0; i < n; i++)
+                {
+                    t_next[i] = -t_prev[i] + ((i > 0) ? 2.0 * t_curr[i - 1] : 0.0);
+                }
+                t_prev = t_curr;
+                t_curr = t_next;
+            }
+        }
+
+        // Monomials in (x - center)
+        Piece piece {static_cast<float>(lower), static_cast<float>(center), {}};
+        double scale = 1.0;
+        for (std::uint32_t i = 0; i < n; i++)
+        {
+            piece.coefficients[i] = static_cast<float>(monomial[i] / scale);
+            scale *= half_width;
+        }
+        return piece;
+    }
+
+    static constexpr double eval_piece(const Piece& piece, const double x)
+    {
+        const double u = x - piece.center;
+        double result  = 0.0;
+        for (std::uint32_t i = NUM_COEFFICIENTS; i > 0; i--)
+        {
+            result = result * u + piece.coefficients[i - 1];
+        }
+        return result;
+    }
+
+    static constexpr double ulp(const double value)
+    {
+        double magnitude = cmath::abs(value) < Spec::ulp_floor ? Spec::ulp_floor : cmath::abs(value);
+        double ulp_size  = 1.0;
+        while (ulp_size > magnitude)
+        {
+            ulp_size *= 0.5;
+        }
+        while (ulp_size * 2.0 <= magnitude)
+        {
+            ulp_size *= 2.0;
+        }
+        for (std::uint32_t i = 0; i < Spec::mantissa_bits; i++)
+        {
+            ulp_size *= 0.5;
+        }
+        return ulp_size;
+    }
+
+    // Largest error, in ULPs, of the fit with num_intervals intervals
+    static constexpr double max_error_ulp(const std::uint32_t num_intervals)
+    {
+        const double width = (Spec::upper - Spec::lower) / num_intervals;
+        double max_error   = 0.0;
+        for (std::uint32_t interval = 0; interval < num_intervals; interval++)
+        {
+            const double lower = Spec::lower + interval * width;
+            const Piece piece  = fit_piece(lower, lower + width);
+            for (std::uint32_t s = 0; s <= PIECEWISE_POLY_ERROR_SAMPLES; s++)
+            {
+                const double x         = lower + width * s / PIECEWISE_POLY_ERROR_SAMPLES;
+                const double reference = Spec::eval(x);
+                const double error     = cmath::abs(eval_piece(piece, x) - reference) / ulp(reference);
+                max_error              = error > max_error ? error : max_error;
+            }
+        }
+        return max_error;
+    }
+
+    static constexpr std::uint32_t choose_num_intervals()
+    {
+        for (std::uint32_t num_intervals = 1; num_intervals <= PIECEWISE_POLY_MAX_INTERVALS; num_intervals *= 2)
+        {
+            if (max_error_ulp(num_intervals) <= Spec::target_ulp)
+            {
+                return num_intervals;
+            }
+        }
+        return 0;
+    }
+
+    template <std::uint32_t NUM_INTERVALS>
+    static constexpr std::array<Piece, NUM_INTERVALS> fit()
+    {
+        std::array<Piece, NUM_INTERVALS> pieces {};
+        const double width = (Spec::upper - Spec::lower) / NUM_INTERVALS;
+        for (std::uint32_t interval = 0; interval < NUM_INTERVALS; interval++)
+        {
+            pieces[interval] = fit_piece(Spec::lower + interval * width, Spec::lower + (interval + 1) * width);
+        }
+        return pieces;
+    }
+};
+
+/**
+ * @brief Evaluates the piecewise polynomial described by Spec, see the top of this file.
+ * The fit is computed at compile time, only when the activation is instantiated.
+ */
+template <typename Spec>
+struct PiecewisePolynomial
+{
+    using Fit = PiecewisePolyFit<Spec>;
+
+    static constexpr std::uint32_t NUM_COEFFICIENTS = Fit::NUM_COEFFICIENTS;
+    static constexpr std::uint32_t NUM_INTERVALS    = Fit::choose_num_intervals();
+    static_assert(NUM_INTERVALS != 0, "No interval count up to 4 meets target_ulp, raise the degree or narrow the range");
+
+    static constexpr std::array<typename Fit::Piece, NUM_INTERVALS> PIECES = Fit::template fit<NUM_INTERVALS>();
+
+    // Maps x to its interval index, the 0.5 makes the round to nearest conversion round down. Lanes on a boundary may
+    // land in either neighbouring interval, which is fine since every piece is fitted including both endpoints
+    static constexpr double INDEX_SCALE  = NUM_INTERVALS / (Spec::upper - Spec::lower);
+    static constexpr double INDEX_OFFSET = -Spec::lower * INDEX_SCALE - 0.5;
+
+    // Horner's method on the piece of interval INTERVAL, highest power first, the coefficients are immediates
+    template <std::uint32_t INTERVAL>
+    sfpi_inline static sfpi::vFloat eval_interval(const sfpi::vFloat x)
+    {
+        const sfpi::vFloat u = x - PIECES[INTERVAL].center;
+        sfpi::vFloat result  = PIECES[INTERVAL].coefficients[NUM_COEFFICIENTS - 1];
+#pragma GCC unroll 7
+        for (std::uint32_t i = NUM_COEFFICIENTS - 1; i > 0; i--)
+        {
+            result = result * u + PIECES[INTERVAL].coefficients[i - 1];
+        }
+        return result;
+    }
+
+    // Binary search over the COUNT intervals starting at FIRST, one integer compare per level. Only x, the index, u and
+    // the result are live, so the degree is not limited by the SFPU registers
+    template <std::uint32_t FIRST, std::uint32_t COUNT>
+    sfpi_inline static void select_interval(const sfpi::vFloat x, const sfpi::vInt index, sfpi::vFloat& result)
+    {
+        if constexpr (COUNT == 1)
+        {
+            result = eval_interval<FIRST>(x);
+        }
+        else
+        {
+            constexpr std::uint32_t HALF = COUNT / 2;
+            v_if (index >= static_cast<int>(FIRST + HALF))
+            {
+                select_interval<FIRST + HALF, HALF>(x, index, result);
+            }
+            v_else
+            {
+                select_interval<FIRST, HALF>(x, index, result);
+            }
+            v_endif;
+        }
+    }
+
+    /**
+     * @brief Evaluates the activation for every lane of x.
+     * Every lane runs all NUM_INTERVALS polynomials under predication, each one subtract, degree + 1 coefficient
+     * loads and degree multiply-adds. On top come one multiply-add for the interval index, NUM_INTERVALS - 1 integer
+     * compares, and a compare and a multiply-add for each tail.
+     */
+    sfpi_inline static sfpi::vFloat eval(const sfpi::vFloat x)
+    {
+        sfpi::vFloat result;
+        if constexpr (NUM_INTERVALS == 1)
+        {
+            result = eval_interval<0>(x);
+        }
+        else
+        {
+            const sfpi::vInt index = sfpi::float_to_int16(x * static_cast<float>(INDEX_SCALE) + static_cast<float>(INDEX_OFFSET), 0);
+            select_interval<0, NUM_INTERVALS>(x, index, result);
+        }
+
+        // Outside the range the activation continues as the tail lines
+        v_if (x < static_cast<float>(Spec::lower))
+        {
+            result = x * static_cast<float>(Spec::lower_tail_slope) + static_cast<float>(Spec::lower_tail_intercept);
+        }
+        v_endif;
+
+        v_if (x >= static_cast<float>(Spec::upper))
+        {
+            result = x * static_cast<float>(Spec::upper_tail_slope) + static_cast<float>(Spec::upper_tail_intercept);
+        }
+        v_endif;
+
+        return result;
+    }
+};
+
+/**
+ * @brief Applies the piecewise polynomial activation described by Spec to a tile in dst.
+ * No init is needed: the coefficients are compile-time constants and are loaded as immediates.
+ *
+ * @tparam Spec Activation spec, see the top of this file
+ * @tparam is_fp32_dest_acc_en Dest holds fp32 data, otherwise results are rounded to bfloat16
+ */
+template <typename Spec, bool is_fp32_dest_acc_en, int ITERATIONS = 8>
+inline void _calculate_piecewise_poly_(const int iterations = ITERATIONS)
+{
+#pragma GCC unroll 0
+    for (int d = 0; d < iterations; d++)
+    {
+        sfpi::vFloat result = PiecewisePolynomial<Spec>::eval(sfpi::dst_reg[0]);
+        if constexpr (!is_fp32_dest_acc_en)
+        {
+            result = sfpi::reinterpret<sfpi::vFloat>(sfpi::float_to_fp16b(result, 0));
+        }
+        sfpi::dst_reg[0] = result;
+        sfpi::dst_reg++;
+    }
+}
+
+} // namespace ckernel::sfpu
@@ -11,6 +11,7 @@
 #include "ckernel.h"
 #include "ckernel_defs.h"
 #include "ckernel_sfpu_isinf_isnan.h"
+#include "ckernel_sfpu_threefry.h"
 #include "sfpi.h"
 
 namespace ckernel
@@ -183,5 +184,44 @@ inline void _calculate_stochastic_round_()
     }
 }
 
+/**
+ * @brief Stochastic rounding of values in DST from fp32 to fp16b with reproducible random bits: every datum is rounded
+ *        away from zero with a probability equal to its discarded fraction, so the rounding is unbiased, and the result
+ *        is always one of the two fp16b values around it. The random bits are derived from
+ *        (seed, stream, tile_index, datum position) with Threefry-2x32, like _calculate_dropout_threefry_.
+ *
+ * @param iterations Number of dst rows to process, must be even
+ * @param seed First key word, shared by all tiles of the op
+ * @param tile_index Index of the tile within the op, the same on every core count and tile order
+ * @param datum_offset Datum counter of the first processed row. Every dst row advances the counter by 32, so a face
+ *        of 8 rows advances it by 256: 0 for a whole tile, f * 256 when face f is processed on its own
+ * @param stream Second key word, separates independent roundings drawn with the same seed
+ */
+template <bool APPROXIMATION_MODE, int ITERATIONS = 8, std::uint32_t ROUNDS = THREEFRY_DEFAULT_ROUNDS>
+inline void _calculate_stochastic_round_threefry_(
+    const int iterations, const std::uint32_t seed, const std::uint32_t tile_index, const std::uint32_t datum_offset = 0, const std::uint32_t stream = 0)
+{
+    const ThreefryKeySchedule schedule = _threefry_key_schedule_(seed, stream);
+
+#pragma GCC unroll 0
+    for (int d = 0; d < iterations; d += 2)
+    {
+        sfpi::vUInt bits[2];
+        _threefry_row_pair_bits_<ROUNDS>(datum_offset + static_cast<std::uint32_t>(d) * 32, tile_index, schedule, bits[0], bits[1]);
+
+#pragma GCC unroll 2
+        for (int row = 0; row < 2; row++)
+        {
+            // Adding 16 uniform bits below the fp16b mantissa and truncating rounds the magnitude up with a
+            // probability equal to the discarded fraction, a carry into the exponent is the correct rounding
+            sfpi::vUInt value  = sfpi::reinterpret<sfpi::vUInt>(sfpi::vFloat(sfpi::dst_reg[row]));
+            value              = (value + (bits[row] >> 16)) & 0xFFFF0000;
+            sfpi::dst_reg[row] = sfpi::reinterpret<sfpi::vFloat>(value);
+        }
+        sfpi::dst_reg++;
+        sfpi::dst_reg++;
+    }
+}
+
 } // namespace sfpu
 } // namespace ckernel
@@ -25,21 +25,27 @@ inline sfpi::vFloat _sigmoid_piecewise_linear_positive_(sfpi::vFloat val)
     return result;
 }
 
+// silu(x) = x * sigmoid(x)
+sfpi_inline sfpi::vFloat _calculate_silu_body_(sfpi::vFloat val)
+{
+    sfpi::vFloat result = sfpi::abs(val);
+    result              = _sigmoid_piecewise_linear_positive_(result);
+    v_if (val < 0.0f)
+    {
+        result = 1.0f - result;
+    }
+    v_endif;
+    return val * result;
+}
+
 template <bool APPROXIMATION_MODE, int ITERATIONS>
 inline void _calculate_silu_()
 {
     // SFPU microcode
     for (int d = 0; d < ITERATIONS; d++)
     {
-        sfpi::vFloat val    = sfpi::dst_reg[0];
-        sfpi::vFloat result = sfpi::abs(val);
-        result              = _sigmoid_piecewise_linear_positive_(result);
-        v_if (val < 0.0f)
-        {
-            result = 1.0f - result;
-        }
-        v_endif;
-        sfpi::dst_reg[0] = val * result;
+        sfpi::vFloat val = sfpi::dst_reg[0];
+        sfpi::dst_reg[0] = _calculate_silu_body_(val);
         sfpi::dst_reg++;
     }
 }
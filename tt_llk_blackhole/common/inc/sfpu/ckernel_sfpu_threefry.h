@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "sfpi.h"
+
+namespace ckernel
+{
+namespace sfpu
+{
+
+// ============================================================================
+// Counter-based random numbers (Threefry-2x32)
+// ============================================================================
+// Unlike the SFPMOV LFSR, which advances a hidden per-lane state, every random word is a pure function of
+// (key, counter): the key is (seed, stream) and the counter is (datum counter, tile index), with the datum counter
+// built from the lane and the dst row. The same inputs always regenerate the same bits, independently of how many
+// cores the op is split across or in which order the tiles are processed, so e.g. a dropout mask can be recomputed in
+// backward instead of being stored.
+//
+// Threefry only needs 32-bit add, rotate and xor, which map directly onto SFPIADD, SFPSHFT, SFPOR and SFPXOR; Philox
+// would need a 32x32 -> 64 bit multiply the SFPU does not have. One evaluation yields two words, used for two dst rows.
+
+constexpr std::uint32_t THREEFRY_DEFAULT_ROUNDS = 20;
+constexpr std::uint32_t THREEFRY_MAX_ROUNDS     = 20;
+constexpr std::uint32_t THREEFRY_PARITY         = 0x1BD11BDA;
+constexpr int THREEFRY_ROTATIONS[8]             = {13, 15, 26, 6, 17, 29, 16, 24};
+
+// Key words added to the two counter words before the first round and after every 4th round
+struct ThreefryKeySchedule
+{
+    std::uint32_t word0[THREEFRY_MAX_ROUNDS / 4 + 1];
+    std::uint32_t word1[THREEFRY_MAX_ROUNDS / 4 + 1];
+};
+
+/**
+ * @brief Expands the (seed, stream) key on the RISC-V core, once per call.
+ */
+inline ThreefryKeySchedule _threefry_key_schedule_(const std::uint32_t seed, const std::uint32_t stream)
+{
+    const std::uint32_t key[3] = {seed, stream, THREEFRY_PARITY ^ seed ^ stream};
+
+    ThreefryKeySchedule schedule {};
+    for (std::uint32_t i = 0; i <= THREEFRY_MAX_ROUNDS / 4; i++)
+    {
+        schedule.word0[i] = key[i % 3];
+        schedule.word1[i] = key[(i + 1) % 3] + i;
+    }
+    return schedule;
+}
+
+// rotation is a compile-time constant once the round loop is unrolled, both shifts take it as an immediate
+sfpi_inline sfpi::vUInt _threefry_rotl_(const sfpi::vUInt x, const int rotation)
+{
+    return (x << rotation) | (x >> (32 - rotation));
+}
+
+/**
+ * @brief Encrypts the counter (x0, x1) in place, leaving two independent uniformly distributed 32-bit words.
+ */
+template <std::uint32_t ROUNDS = THREEFRY_DEFAULT_ROUNDS>
+sfpi_inline void _threefry2x32_(sfpi::vUInt &x0, sfpi::vUInt &x1, const ThreefryKeySchedule &schedule)
+{
+    static_assert(ROUNDS >= 12 && ROUNDS <= THREEFRY_MAX_ROUNDS, "Threefry-2x32 needs at least 12 rounds to be statistically sound");
+
+    x0 = x0 + sfpi::vUInt(schedule.word0[0]);
+    x1 = x1 + sfpi::vUInt(schedule.word1[0]);
+
+#pragma GCC unroll 20
+    for (std::uint32_t round = 0; round < ROUNDS; round++)
+    {
+        x0 = x0 + x1;
+        x1 = _threefry_rotl_(x1, THREEFRY_ROTATIONS[round % 8]);
+        x1 = x1 ^ x0;
+
+        if (round % 4 == 3)
+        {
+            x0 = x0 + sfpi::vUInt(schedule.word0[round / 4 + 1]);
+            x1 = x1 + sfpi::vUInt(schedule.word1[round / 4 + 1]);
+        }
+    }
+}
+
+/**
+ * @brief Random words for the current dst row and the one after it.
+ *
+ * @param row_counter Datum counter of lane 0 of the current row, rows are 32 datums apart
+ * @param tile_index Caller's tile index, the second counter word
+ * @param bits0 Random word of the current row
+ * @param bits1 Random word of the next row
+ */
+template <std::uint32_t ROUNDS = THREEFRY_DEFAULT_ROUNDS>
+sfpi_inline void _threefry_row_pair_bits_(
+    const std::uint32_t row_counter, const std::uint32_t tile_index, const ThreefryKeySchedule &schedule, sfpi::vUInt &bits0, sfpi::vUInt &bits1)
+{
+    // LTILEID holds 2 * lane index
+    sfpi::vUInt tile_id = sfpi::vConstTileId;
+    bits0               = (tile_id >> 1) + sfpi::vUInt(row_counter);
+    bits1               = tile_index;
+    _threefry2x32_<ROUNDS>(bits0, bits1, schedule);
+}
+
+} // namespace sfpu
+} // namespace ckernel
@@ -895,6 +895,231 @@ inline void _bitonic_topk_rebuild(const bool idir, const int m_iter, const int k
     topk_replay_init = m_iter + 1;
 }
 
+// ============================================================================
+// Multi-tile bitonic sort and merge (large k TopK, full row argsort)
+// ============================================================================
+// The functions above work on 64 datums per column (value tiles at dest tiles 0-1, indices at tiles 2-3) and keep
+// k <= 32. The functions below work on a block of num_tiles value tiles at dest tiles [0, num_tiles), with the indices
+// at [num_tiles, 2 * num_tiles). As above tiles are transposed on unpack, so every column of the block is one sequence
+// of 32 * num_tiles datums. Compare-exchanges 16 or more datums apart are plain swaps between faces or tiles, the last
+// 4 steps of every 16 datums reuse the in-register phases above. Values and indices stay paired through the index
+// tracking mode set by _init_topk.
+//
+// Rows longer than a block and k > 32 are handled by streaming tiles through dest:
+//   1. Sort every block with _bitonic_topk_sort_tiles_, alternating the direction from block to block.
+//   2. Merge runs longer than a block by exchanging the tile pairs (i, i + d) of every run with
+//      _bitonic_topk_exchange_tiles_ for all tile distances d >= block, then _bitonic_topk_merge_tiles_ on every block.
+//      Repeat with doubled runs until the runs hold K = k / 32 tiles.
+//   3. Pair every run sorted in the requested direction with a run sorted in the opposite one, exchange the tile pairs
+//      (i, i + K) and keep only the first tile of each pair: the kept run holds the top-k of both runs and is bitonic,
+//      step 2 sorts it again. Repeat until one run is left.
+// A full row argsort skips step 3 and keeps merging until one run covers the whole row.
+// _bitonic_topk_for_each_step_ in ckernel_sfpu_topk_large_k.h walks this schedule on all three TRISCs.
+
+constexpr std::uint32_t TOPK_TILE_DEST_ROWS     = 64; // dest rows per tile
+constexpr std::uint32_t TOPK_COLUMN_OFFSETS[4]  = {0, 2, 16, 18};
+constexpr std::uint32_t TOPK_BLOCK_REPLAY_START = 16;
+
+// Dest row of a datum of a block sequence: 16 datums per face, upper and lower faces are 32 rows apart
+inline std::uint32_t topk_block_row_offset(const std::uint32_t position)
+{
+    return (position & 0xF) + (position >> 4) * 32;
+}
+
+template <bool is_fp32_dest_acc_en, bool STABLE_SORT>
+inline void bitonic_topk_block_exchange(const std::uint32_t offset0, const std::uint32_t offset1, const std::uint32_t index_offset, const bool dir)
+{
+    constexpr std::uint8_t instr_mod_index = is_fp32_dest_acc_en ? InstrModLoadStore::INT32 : InstrModLoadStore::LO16;
+
+    TT_SFPLOAD(p_sfpu::LREG0, 0, ADDR_MOD_7, offset0);
+    TT_SFPLOAD(p_sfpu::LREG1, 0, ADDR_MOD_7, offset1);
+    TT_SFPLOAD(p_sfpu::LREG4, instr_mod_index, ADDR_MOD_7, index_offset + offset0);
+    TT_SFPLOAD(p_sfpu::LREG5, instr_mod_index, ADDR_MOD_7, index_offset + offset1);
+
+    // Same operand order as bitonic_topk_step_N: the max goes to the first datum for ArgMax
+    const std::uint32_t first  = (dir == static_cast<bool>(SortDir::ArgMax)) ? p_sfpu::LREG0 : p_sfpu::LREG1;
+    const std::uint32_t second = (dir == static_cast<bool>(SortDir::ArgMax)) ? p_sfpu::LREG1 : p_sfpu::LREG0;
+    TT_SFPSWAP(0, first, second, p_sfpswap::ALL_ROWS_MAX);
+    if constexpr (STABLE_SORT)
+    {
+        // 1-cycle stall: second swap for index tracking on same LREGs
+        TT_SFPSWAP(0, first, second, p_sfpswap::ALL_ROWS_MAX);
+    }
+
+    TT_SFPSTORE(p_sfpu::LREG0, 0, ADDR_MOD_7, offset0);
+    TT_SFPSTORE(p_sfpu::LREG1, 0, ADDR_MOD_7, offset1);
+    TT_SFPSTORE(p_sfpu::LREG4, instr_mod_index, ADDR_MOD_7, index_offset + offset0);
+    TT_SFPSTORE(p_sfpu::LREG5, instr_mod_index, ADDR_MOD_7, index_offset + offset1);
+}
+
+template <bool is_fp32_dest_acc_en>
+inline void bitonic_topk_block_load16(const std::uint32_t offset, const std::uint32_t index_offset)
+{
+    constexpr std::uint8_t instr_mod_index = is_fp32_dest_acc_en ? InstrModLoadStore::INT32 : InstrModLoadStore::LO16;
+
+    TT_SFPLOAD(p_sfpu::LREG0, 0, ADDR_MOD_7, offset);
+    TT_SFPLOAD(p_sfpu::LREG1, 0, ADDR_MOD_7, offset + 4);
+    TT_SFPLOAD(p_sfpu::LREG2, 0, ADDR_MOD_7, offset + 8);
+    TT_SFPLOAD(p_sfpu::LREG3, 0, ADDR_MOD_7, offset + 12);
+
+    TT_SFPLOAD(p_sfpu::LREG4, instr_mod_index, ADDR_MOD_7, index_offset + offset);
+    TT_SFPLOAD(p_sfpu::LREG5, instr_mod_index, ADDR_MOD_7, index_offset + offset + 4);
+    TT_SFPLOAD(p_sfpu::LREG6, instr_mod_index, ADDR_MOD_7, index_offset + offset + 8);
+    TT_SFPLOAD(p_sfpu::LREG7, instr_mod_index, ADDR_MOD_7, index_offset + offset + 12);
+}
+
+template <bool is_fp32_dest_acc_en>
+inline void bitonic_topk_block_store16(const std::uint32_t offset, const std::uint32_t index_offset)
+{
+    constexpr std::uint8_t instr_mod_index = is_fp32_dest_acc_en ? InstrModLoadStore::INT32 : InstrModLoadStore::LO16;
+
+    TT_SFPSTORE(p_sfpu::LREG0, 0, ADDR_MOD_7, offset);
+    TT_SFPSTORE(p_sfpu::LREG1, 0, ADDR_MOD_7, offset + 4);
+    TT_SFPSTORE(p_sfpu::LREG2, 0, ADDR_MOD_7, offset + 8);
+    TT_SFPSTORE(p_sfpu::LREG3, 0, ADDR_MOD_7, offset + 12);
+
+    TT_SFPSTORE(p_sfpu::LREG4, instr_mod_index, ADDR_MOD_7, index_offset + offset);
+    TT_SFPSTORE(p_sfpu::LREG5, instr_mod_index, ADDR_MOD_7, index_offset + offset + 4);
+    TT_SFPSTORE(p_sfpu::LREG6, instr_mod_index, ADDR_MOD_7, index_offset + offset + 8);
+    TT_SFPSTORE(p_sfpu::LREG7, instr_mod_index, ADDR_MOD_7, index_offset + offset + 12);
+}
+
+/**
+ * @brief Bitonic merge of the runs of run_length datums of one column of the block, starting at compare distance
+ * first_dist. Only the first num_datums datums are compared and sorted, run r is sorted in idir, flipped for odd r.
+ */
+template <bool is_fp32_dest_acc_en, bool STABLE_SORT>
+inline void bitonic_topk_block_merge(
+    const std::uint32_t num_datums,
+    const std::uint32_t run_length,
+    const std::uint32_t first_dist,
+    const bool idir,
+    const std::uint32_t index_offset,
+    bool &init_replay)
+{
+    // Steps N to 5
+    for (std::uint32_t dist = first_dist; dist >= 16; dist >>= 1)
+    {
+        for (std::uint32_t position = 0; position < num_datums; position += 4)
+        {
+            if ((position & dist) == 0)
+            {
+                const bool dir = idir != static_cast<bool>((position / run_length) & 1);
+                bitonic_topk_block_exchange<is_fp32_dest_acc_en, STABLE_SORT>(
+                    topk_block_row_offset(position), topk_block_row_offset(position + dist), index_offset, dir);
+            }
+        }
+    }
+
+    // Steps 4 to 1
+    for (std::uint32_t position = 0; position < num_datums; position += 16)
+    {
+        const bool dir = idir != static_cast<bool>((position / run_length) & 1);
+        bitonic_topk_block_load16<is_fp32_dest_acc_en>(topk_block_row_offset(position), index_offset);
+        bitonic_topk_ph3_st4_to_1<STABLE_SORT>(dir, init_replay, TOPK_BLOCK_REPLAY_START);
+        bitonic_topk_block_store16<is_fp32_dest_acc_en>(topk_block_row_offset(position), index_offset);
+    }
+}
+
+inline void bitonic_topk_block_check(const int num_tiles, const bool is_fp32_dest_acc_en)
+{
+    LLK_ASSERT((num_tiles > 0) && ((num_tiles & (num_tiles - 1)) == 0), "Number of tiles in a TopK block must be a power of two");
+    LLK_ASSERT(num_tiles <= (is_fp32_dest_acc_en ? 2 : 4), "Values and indices of a TopK block must fit in half of dest");
+}
+
+/**
+ * @brief Sorts every column of a block of num_tiles value tiles together with its index tiles.
+ *
+ * @param num_tiles Number of value tiles, a power of two: up to 4, up to 2 with fp32 dest
+ * @param idir Sort direction, SortDir::ArgMax for descending
+ */
+template <bool APPROXIMATION_MODE, bool is_fp32_dest_acc_en, bool STABLE_SORT = false>
+inline void _bitonic_topk_sort_tiles_(const int num_tiles, const bool idir)
+{
+    bitonic_topk_block_check(num_tiles, is_fp32_dest_acc_en);
+
+    const std::uint32_t num_datums   = num_tiles * 32;
+    const std::uint32_t index_offset = num_tiles * TOPK_TILE_DEST_ROWS;
+    bool init_replay                 = true;
+
+    for (std::uint32_t column = 0; column < 4; column++)
+    {
+        set_dst_write_addr(TOPK_COLUMN_OFFSETS[column]);
+        TTI_SETRWC(p_setrwc::CLR_NONE, 0, 0, 0, 0, p_setrwc::SET_D);
+
+        // Phases 0 to 3: runs of 16 datums in alternating directions
+        for (std::uint32_t position = 0; position < num_datums; position += 16)
+        {
+            const bool dir = idir != static_cast<bool>((position / 16) & 1);
+            bitonic_topk_block_load16<is_fp32_dest_acc_en>(topk_block_row_offset(position), index_offset);
+            bitonic_topk_ph0_st1_to_1<STABLE_SORT>();
+            bitonic_topk_ph1_st2_to_1<STABLE_SORT>();
+            bitonic_topk_ph2_st3_to_1<STABLE_SORT>();
+            bitonic_topk_ph3_st4_to_1<STABLE_SORT>(dir, init_replay, TOPK_BLOCK_REPLAY_START);
+            bitonic_topk_block_store16<is_fp32_dest_acc_en>(topk_block_row_offset(position), index_offset);
+        }
+
+        // Phases 4 and up: merge pairs of runs until one run covers the column
+        for (std::uint32_t run_length = 32; run_length <= num_datums; run_length <<= 1)
+        {
+            bitonic_topk_block_merge<is_fp32_dest_acc_en, STABLE_SORT>(num_datums, run_length, run_length / 2, idir, index_offset, init_replay);
+        }
+    }
+    topk_replay_init = 0; // The replay buffer was overwritten, the functions above have to record it again
+}
+
+/**
+ * @brief Sorts every column of a block of num_tiles value tiles that is a bitonic sequence, e.g. two runs sorted in
+ * opposite directions.
+ *
+ * @param num_tiles Number of value tiles, a power of two: up to 4, up to 2 with fp32 dest
+ * @param idir Sort direction, SortDir::ArgMax for descending
+ * @param keep_first_half Only the first half of the block is sorted, it holds the best half of the datums (top-k step)
+ */
+template <bool APPROXIMATION_MODE, bool is_fp32_dest_acc_en, bool STABLE_SORT = false>
+inline void _bitonic_topk_merge_tiles_(const int num_tiles, const bool idir, const bool keep_first_half = false)
+{
+    bitonic_topk_block_check(num_tiles, is_fp32_dest_acc_en);
+
+    const std::uint32_t num_datums   = num_tiles * 32;
+    const std::uint32_t index_offset = num_tiles * TOPK_TILE_DEST_ROWS;
+    bool init_replay                 = true;
+
+    for (std::uint32_t column = 0; column < 4; column++)
+    {
+        set_dst_write_addr(TOPK_COLUMN_OFFSETS[column]);
+        TTI_SETRWC(p_setrwc::CLR_NONE, 0, 0, 0, 0, p_setrwc::SET_D);
+
+        bitonic_topk_block_merge<is_fp32_dest_acc_en, STABLE_SORT>(
+            keep_first_half ? num_datums / 2 : num_datums, num_datums, num_datums / 2, idir, index_offset, init_replay);
+    }
+    topk_replay_init = 0; // The replay buffer was overwritten, the functions above have to record it again
+}
+
+/**
+ * @brief Compare-exchange of dest tiles 0 and 1, indices at tiles 2 and 3: afterwards every datum of tile 0 is the
+ * better one of the datums at the same position. Used for the steps of a merge whose distance spans more than a block.
+ *
+ * @param idir Sort direction, SortDir::ArgMax moves the larger datums to tile 0
+ */
+template <bool APPROXIMATION_MODE, bool is_fp32_dest_acc_en, bool STABLE_SORT = false>
+inline void _bitonic_topk_exchange_tiles_(const bool idir)
+{
+    constexpr std::uint32_t index_offset = 2 * TOPK_TILE_DEST_ROWS;
+
+    for (std::uint32_t column = 0; column < 4; column++)
+    {
+        set_dst_write_addr(TOPK_COLUMN_OFFSETS[column]);
+        TTI_SETRWC(p_setrwc::CLR_NONE, 0, 0, 0, 0, p_setrwc::SET_D);
+
+        for (std::uint32_t position = 0; position < 32; position += 4)
+        {
+            bitonic_topk_block_exchange<is_fp32_dest_acc_en, STABLE_SORT>(
+                topk_block_row_offset(position), topk_block_row_offset(position + 32), index_offset, idir);
+        }
+    }
+}
+
 inline void _init_topk()
 {
     topk_replay_init = 0;
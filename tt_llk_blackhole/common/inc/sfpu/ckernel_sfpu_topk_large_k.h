@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+
+#include "ckernel_defs.h"
+
+namespace ckernel
+{
+namespace sfpu
+{
+
+// ============================================================================
+// Large k TopK and full row argsort schedule
+// ============================================================================
+// Drives the multi-tile bitonic sort and merge of ckernel_sfpu_topk.h (steps 1-3 at "Multi-tile bitonic sort and
+// merge") over a row of value tiles longer than dest. The schedule only depends on its arguments, so the unpacker,
+// math and packer walk it identically: each one issues its part of every dest section and synchronizes between steps.
+// Every step reads the tiles the previous step packed, so the packer has to signal the unpacker after every step.
+// Contains no SFPU code, so it can be included on every TRISC.
+
+enum class TopkTileOp : int
+{
+    Sort     = 0, // _bitonic_topk_sort_tiles_ on a block
+    Merge    = 1, // _bitonic_topk_merge_tiles_ on a bitonic block
+    Exchange = 2  // _bitonic_topk_exchange_tiles_ on a tile pair
+};
+
+// Value tiles sorted in one dest section, values and indices of a block have to fit in half of dest
+template <bool is_fp32_dest_acc_en>
+constexpr int _bitonic_topk_block_tiles_(const int k)
+{
+    return std::min(is_fp32_dest_acc_en ? 2 : 4, k / static_cast<int>(TILE_C_DIM));
+}
+
+/**
+ * @brief Walks the dest sections of the top k of one row of num_value_tiles value tiles.
+ * section(op, first_tile, tile_stride, num_tiles, dir) is called for every dest section, the tiles of the section are
+ * first_tile + i * tile_stride of the row for i < num_tiles, and op runs on them in direction dir. step_done() is called
+ * after every step. When the row holds exactly k datums the result is a full row argsort.
+ * Afterwards the first k / 32 tiles of the row hold the result.
+ *
+ * @param num_value_tiles Value tiles in the row, a power of two
+ * @param k Number of datums kept, a power of two between 32 and 32 * num_value_tiles
+ * @param idir Sort direction, SortDir::ArgMax for descending
+ */
+template <bool is_fp32_dest_acc_en, typename SectionFn, typename StepDoneFn>
+inline void _bitonic_topk_for_each_step_(const int num_value_tiles, const int k, const bool idir, SectionFn &&section, StepDoneFn &&step_done)
+{
+    const int run_tiles   = k / static_cast<int>(TILE_C_DIM);
+    const int block_tiles = _bitonic_topk_block_tiles_<is_fp32_dest_acc_en>(k);
+
+    // Sorts bitonic runs of num_tiles tiles, run r starts at tile r * run_stride and is sorted in idir, flipped for odd r
+    auto merge_runs = [&](const int num_runs, const int run_stride, const int num_tiles)
+    {
+        for (int distance = num_tiles / 2; distance >= block_tiles; distance >>= 1)
+        {
+            for (int run = 0; run < num_runs; ++run)
+            {
+                const bool dir = idir != static_cast<bool>(run & 1);
+                for (int tile = 0; tile < num_tiles; ++tile)
+                {
+                    if ((tile & distance) == 0)
+                    {
+                        section(TopkTileOp::Exchange, run * run_stride + tile, distance, 2, dir);
+                    }
+                }
+            }
+            step_done();
+        }
+        for (int run = 0; run < num_runs; ++run)
+        {
+            const bool dir = idir != static_cast<bool>(run & 1);
+            for (int block = 0; block < num_tiles; block += block_tiles)
+            {
+                section(TopkTileOp::Merge, run * run_stride + block, 1, block_tiles, dir);
+            }
+        }
+        step_done();
+    };
+
+    // Step 1: sorted blocks in alternating directions
+    for (int block = 0; block < num_value_tiles / block_tiles; ++block)
+    {
+        section(TopkTileOp::Sort, block * block_tiles, 1, block_tiles, idir != static_cast<bool>(block & 1));
+    }
+    step_done();
+
+    // Step 2: runs of k / 32 tiles in alternating directions
+    for (int num_tiles = 2 * block_tiles; num_tiles <= run_tiles; num_tiles <<= 1)
+    {
+        merge_runs(num_value_tiles / num_tiles, num_tiles, num_tiles);
+    }
+
+    // Step 3: halve the number of runs until one is left, the runs spread out as the discarded ones stay in place
+    for (int run_stride = run_tiles; run_stride < num_value_tiles; run_stride <<= 1)
+    {
+        const int num_runs = num_value_tiles / run_stride;
+        for (int run = 0; run < num_runs; run += 2)
+        {
+            for (int tile = 0; tile < run_tiles; ++tile)
+            {
+                section(TopkTileOp::Exchange, run * run_stride + tile, run_stride, 2, idir);
+            }
+        }
+        step_done();
+        merge_runs(num_runs / 2, 2 * run_stride, run_tiles);
+    }
+}
+
+// Number of step_done() calls of _bitonic_topk_for_each_step_
+template <bool is_fp32_dest_acc_en>
+inline int _bitonic_topk_num_steps_(const int num_value_tiles, const int k)
+{
+    int num_steps = 0;
+    _bitonic_topk_for_each_step_<is_fp32_dest_acc_en>(num_value_tiles, k, false, [](TopkTileOp, int, int, int, bool) {}, [&]() { ++num_steps; });
+    return num_steps;
+}
+
+} // namespace sfpu
+} // namespace ckernel
@@ -138,19 +138,22 @@ inline void reduce_max_row_configure_addrmod_reinit_minimal_runtime()
  * Configures MOP (Macro Operation) for block-based reduce_max_row operations.
  *
  * This function works with the following assumptions:
- * - Scaler values are 1.0 and are contained inside F0 of the scaler tile
+ * - Scaler values are 1.0 (1/N for AVG) and are contained inside F0 of the scaler tile
  * - The scaler doesn't change for the duration of the whole block operation
  * - Operand and scaler data format is bfloat16_b
  * - Operand tile size is 32x32
  * - Can work on both 16-bit or 32-bit DEST register modes based on is_fp32_dest_acc_en flag
- * - Does only MAX pool on ROW dimension
+ * - Does MAX pool on ROW dimension, or SUM/AVG pool with type. SUM/AVG run a single LoFi phase, so the scaler
+ *   (1.0 for SUM, 1/N for AVG) has to be exact in LoFi, which holds for powers of two
  *
  * This function should NOT be used as a substitute for native reduce LLK MOP configuration.
  * Use the standard reduce MOP configuration with _llk_math_reduce_init_ for general-purpose reduction.
  */
-template <bool is_fp32_dest_acc_en = false>
+template <bool is_fp32_dest_acc_en = false, PoolType type = PoolType::MAX>
 inline void _llk_math_reduce_block_max_row_mop_config_runtime_(std::uint32_t block_ct_dim)
 {
+    static_assert(type == PoolType::MAX || type == PoolType::SUM || type == PoolType::AVG, "Unsupported pool type");
+
     // Constraint on the outerloop and innerloop dim
     // static_assert(block_ct_dim < 128, "block_ct_dim must be less than 128");
 
@@ -158,9 +161,18 @@ inline void _llk_math_reduce_block_max_row_mop_config_runtime_(std::uint32_t blo
     // Put the following 15 instructions in a REPLAY buffer
     lltt::record(0, 15);
 
-    // Two GMPOOLs to pool F0 and F1 (or F2 and F3) together
-    TTI_GMPOOL(p_setrwc::CLR_NONE, p_gpool::DIM_16X16, ADDR_MOD_1, p_gpool::INDEX_DIS, 0);
-    TTI_GMPOOL(p_setrwc::CLR_NONE, p_gpool::DIM_16X16, ADDR_MOD_1, p_gpool::INDEX_DIS, 0);
+    if constexpr (type == PoolType::MAX)
+    {
+        // Two GMPOOLs to pool F0 and F1 (or F2 and F3) together
+        TTI_GMPOOL(p_setrwc::CLR_NONE, p_gpool::DIM_16X16, ADDR_MOD_1, p_gpool::INDEX_DIS, 0);
+        TTI_GMPOOL(p_setrwc::CLR_NONE, p_gpool::DIM_16X16, ADDR_MOD_1, p_gpool::INDEX_DIS, 0);
+    }
+    else
+    {
+        // Two GAPOOLs to sum F0 and F1 (or F2 and F3) together, in a single LoFi phase
+        TTI_GAPOOL(p_setrwc::CLR_NONE, p_gpool::DIM_16X16, ADDR_MOD_1, p_gpool::INDEX_DIS, 0);
+        TTI_GAPOOL(p_setrwc::CLR_NONE, p_gpool::DIM_16X16, ADDR_MOD_1, p_gpool::INDEX_DIS, 0);
+    }
 
     if constexpr (is_fp32_dest_acc_en)
     {
@@ -260,18 +272,18 @@ inline void _llk_math_reduce_block_max_row_mop_reprogram_only_runtime_(std::uint
  * Initializes block-based reduce_max_row operation for processing multiple tiles.
  *
  * This function works with the following assumptions:
- * - Scaler values are 1.0 and are contained inside F0 of the scaler tile
+ * - Scaler values are 1.0 (1/N for AVG) and are contained inside F0 of the scaler tile
  * - The scaler doesn't change for the duration of the whole block operation
  * - Operand and scaler data format is bfloat16_b
  * - Operand tile size is 32x32
  * - Can work on both 16-bit or 32-bit DEST register modes based on is_fp32_dest_acc_en flag
- * - Does only MAX pool on ROW dimension
+ * - Does MAX pool on ROW dimension, or SUM/AVG pool with type, see _llk_math_reduce_block_max_row_mop_config_runtime_
  *
  * This function should NOT be used as a substitute for the native _llk_math_reduce_init_ LLK.
  * Use the standard _llk_math_reduce_init_<PoolType::MAX, ReduceDim::REDUCE_ROW>() with multiple
  * _llk_math_reduce_() calls in a loop for general-purpose block reduction.
  */
-template <bool is_fp32_dest_acc_en = false>
+template <bool is_fp32_dest_acc_en = false, PoolType type = PoolType::MAX>
 inline void _llk_math_reduce_block_max_row_init_runtime_(std::uint32_t block_ct_dim)
 {
     if constexpr (is_fp32_dest_acc_en)
@@ -285,7 +297,7 @@ inline void _llk_math_reduce_block_max_row_init_runtime_(std::uint32_t block_ct_
 
     math::reset_counters(p_setrwc::SET_ABD_F);
 
-    _llk_math_reduce_block_max_row_mop_config_runtime_<is_fp32_dest_acc_en>(block_ct_dim);
+    _llk_math_reduce_block_max_row_mop_config_runtime_<is_fp32_dest_acc_en, type>(block_ct_dim);
 }
 
 inline void _llk_math_reduce_block_max_row_uninit_runtime_()
@@ -359,7 +371,7 @@ inline void _llk_math_reduce_block_max_row_reinit_runtime_()
 template <bool is_fp32_dest_acc_en = false>
 inline void _llk_math_reduce_block_max_row_reinit_short_runtime_(std::uint32_t block_ct_dim)
 {
-    reduce_max_row_configure_addrmod();
+    reduce_max_row_configure_addrmod_runtime();
     TTI_SETC16(CLR_DVALID_SrcA_Disable_ADDR32, 0);
     math::reset_counters(p_setrwc::SET_ABD_F);
     _llk_math_reduce_block_max_row_mop_reprogram_only_runtime_<is_fp32_dest_acc_en>(block_ct_dim);
@@ -524,6 +524,190 @@ inline void _llk_math_eltwise_binary_with_dest_reuse_(const ckernel::TensorShape
     math::clear_dst_reg_addr();
 }
 
+/*************************************************************************
+ * Eltwise Binary WITH Dest Reuse over a block of tiles
+ * The dest -> src face move is recorded into the replay buffer once, so ADD/SUB run a whole block of ct_dim
+ * consecutive tiles in a single MOP run. MUL has to clear every dest face before it is computed, so it keeps
+ * running one face per MOP, but still over the whole block in one call.
+ *************************************************************************/
+
+constexpr std::uint32_t REUSE_DEST_MOVE_REPLAY_LEN = 5; // STALLWAIT + 4 MOVD2A/MOVD2B
+
+/**
+ * @brief Configure MOP for eltwise ADD/SUB with dest reuse over a block of tiles
+ * MOP outer loop = ct_dim * num_faces faces, each starting with the replayed dest -> src move of the face
+ * @tparam eltwise_binary_type: Type of eltwise binary op, values = <ELWADD/ELWSUB>
+ * @tparam bcast_type: Broadcast type for source B, values = <NONE/ROW>
+ * @param acc_to_dest: Accumulate result to destination register
+ * @param tensor_shape: Tensor shape describing tile dimensions
+ * @param ct_dim: Number of tiles in the block
+ */
+template <EltwiseBinaryType eltwise_binary_type, BroadcastType bcast_type>
+inline void eltwise_binary_configure_mop_with_dest_reuse_block(
+    const std::uint32_t acc_to_dest, const ckernel::TensorShape &tensor_shape, const std::uint32_t ct_dim)
+{
+    constexpr std::uint8_t addr_mod = ADDR_MOD_0;
+    constexpr auto broadcast_type   = (bcast_type == BroadcastType::ROW) ? p_elwise::SRCB_BCAST_ROW : p_elwise::SRCB_NO_BCAST;
+
+    const std::uint8_t innerloop  = tensor_shape.face_r_dim > MAX_FPU_ROWS ? (tensor_shape.face_r_dim >> MAX_FPU_ROWS_LOG2) : 1;
+    const std::uint32_t outerloop = ct_dim * tensor_shape.total_num_faces();
+
+    ckernel_template tmp(outerloop, innerloop, eltwise_binary_func<eltwise_binary_type>(0, acc_to_dest, broadcast_type, addr_mod));
+    if (tensor_shape.face_r_dim <= MAX_FPU_ROWS)
+    {
+        // For partial faces, still increment by MAX_FPU_ROWS to maintain 16-row face spacing
+        tmp.set_loop_op1(TT_OP_INCRWC(0, MAX_FPU_ROWS, MAX_FPU_ROWS, MAX_FPU_ROWS));
+    }
+    tmp.set_start_op(lltt::replay_insn(ckernel::math::replay_buf_offset, REUSE_DEST_MOVE_REPLAY_LEN));
+    tmp.set_end_op(TT_OP_SETRWC(p_setrwc::CLR_AB, p_setrwc::CR_AB, 0, 0, 0, p_setrwc::SET_AB));
+    tmp.program();
+}
+
+/**
+ * @brief Initialize FPU for elementwise binary operations with dest reuse over a block of tiles
+ * @tparam eltwise_binary_type: Type of eltwise binary op, values = <ELWADD/ELWSUB/ELWMUL>
+ * @tparam src_b_bcast_type: Broadcast type for source B, values = <NONE/ROW>, srcB is released after every face
+ * @tparam math_fidelity: Math fidelity for controlling precision
+ * @tparam binary_reuse_dest: Reuse destination as source type, values = <DEST_TO_SRCA, DEST_TO_SRCB>
+ * @param tensor_shape: Tensor shape describing tile dimensions, tiles must have 4 faces
+ * @param ct_dim: Number of consecutive dest tiles processed by every _llk_math_eltwise_binary_with_dest_reuse_block_ call
+ * @param acc_to_dest: Accumulate result to destination register
+ */
+template <
+    EltwiseBinaryType eltwise_binary_type,
+    BroadcastType src_b_bcast_type,
+    MathFidelity math_fidelity                   = MathFidelity::LoFi,
+    EltwiseBinaryReuseDestType binary_reuse_dest = EltwiseBinaryReuseDestType::DEST_TO_SRCA>
+inline void _llk_math_eltwise_binary_with_dest_reuse_block_init_(
+    const ckernel::TensorShape &tensor_shape, const std::uint32_t ct_dim, const std::uint32_t acc_to_dest)
+{
+    static_assert(binary_reuse_dest != EltwiseBinaryReuseDestType::NONE, "Use _llk_math_eltwise_binary_standard_init_ for no dest reuse");
+    static_assert(
+        src_b_bcast_type == BroadcastType::NONE || src_b_bcast_type == BroadcastType::ROW,
+        "Block dest reuse supports NONE and ROW broadcast only, use _llk_math_eltwise_binary_with_dest_reuse_init_");
+    LLK_ASSERT(validate_tensor_shape_tile_dependent_ops_(tensor_shape), "Invalid tensor shape for tile-dependent op");
+    // With fewer faces the dest counter would not land on the next 32x32 tile slot after the last face of a tile
+    LLK_ASSERT(tensor_shape.total_num_faces() == 4, "Block dest reuse requires tiles with 4 faces");
+    LLK_ASSERT(ct_dim > 0, "ct_dim must be at least 1");
+    LLK_ASSERT(math_fidelity == MathFidelity::LoFi || eltwise_binary_type == ELWMUL, "Math fidelity larger than LoFi only works with Eltwise multiply");
+    LLK_ASSERT(
+        (eltwise_binary_type == ELWADD) || (eltwise_binary_type == ELWSUB) || (eltwise_binary_type == ELWMUL),
+        "eltwise_binary_type must be ELWADD, ELWSUB, or ELWMUL");
+
+    eltwise_binary_configure_addrmod<eltwise_binary_type, src_b_bcast_type, math_fidelity>();
+
+    if constexpr ((eltwise_binary_type == ELWADD) || (eltwise_binary_type == ELWSUB))
+    {
+        lltt::record<lltt::NoExec>(ckernel::math::replay_buf_offset, REUSE_DEST_MOVE_REPLAY_LEN);
+        eltwise_binary_reuse_dest_as_src<binary_reuse_dest>();
+
+        eltwise_binary_configure_mop_with_dest_reuse_block<eltwise_binary_type, src_b_bcast_type>(acc_to_dest, tensor_shape, ct_dim);
+    }
+    else
+    {
+        eltwise_binary_configure_mop_with_dest_reuse<eltwise_binary_type, src_b_bcast_type, math_fidelity>(acc_to_dest, tensor_shape);
+    }
+
+    TTI_SETC16(CLR_DVALID_SrcA_Disable_ADDR32, 0);
+
+    math::reset_counters(p_setrwc::SET_ABD_F);
+}
+
+/**
+ * @brief Perform elementwise binary operation with dest reuse over ct_dim consecutive dest tiles
+ * Output = SrcA [+, -, *] SrcB, where one src comes from dest register, e.g. x = (x + a) * b chained over a block
+ * @tparam eltwise_binary_type: Type of eltwise binary op
+ * @tparam src_b_bcast_type: Broadcast type for source B, values = <NONE/ROW>
+ * @tparam Dst: Destination sync mode
+ * @tparam is_fp32_dest_acc_en: Enable FP32 mode in destination register
+ * @tparam math_fidelity: Math fidelity for controlling precision
+ * @tparam binary_reuse_dest: Reuse destination as source type
+ * @param tensor_shape: Tensor shape describing tile dimensions, tiles must have 4 faces
+ * @param dst_index: Tile index into the destination register of the first tile of the block
+ * @param ct_dim: Number of tiles in the block, must match the ct_dim given to the init
+ * @param clear_fp32_dst_acc: Clears index in destination register when float32 mode is enabled
+ */
+template <
+    EltwiseBinaryType eltwise_binary_type,
+    BroadcastType src_b_bcast_type,
+    DstSync Dst,
+    bool is_fp32_dest_acc_en,
+    MathFidelity math_fidelity,
+    EltwiseBinaryReuseDestType binary_reuse_dest>
+inline void _llk_math_eltwise_binary_with_dest_reuse_block_(
+    const ckernel::TensorShape &tensor_shape, const std::uint32_t dst_index, const std::uint32_t ct_dim, const bool clear_fp32_dst_acc)
+{
+    static_assert(binary_reuse_dest != EltwiseBinaryReuseDestType::NONE, "Use _llk_math_eltwise_binary_standard_ for no dest reuse");
+    LLK_ASSERT(tensor_shape.total_num_faces() == 4, "Block dest reuse requires tiles with 4 faces");
+
+    // Faces of consecutive tiles are contiguous in dest, the dest counter walks the whole block from here
+    math::set_dst_write_addr<DstTileShape::Tile32x32, UnpackDestination::SrcRegs>(dst_index);
+
+    if constexpr ((eltwise_binary_type == ELWADD) || (eltwise_binary_type == ELWSUB))
+    {
+        ckernel_template::run();
+    }
+    else
+    {
+#pragma GCC unroll 0
+        for (std::uint32_t tile = 0; tile < ct_dim; tile++)
+        {
+            eltwise_binary_run_with_dest_reuse<is_fp32_dest_acc_en, binary_reuse_dest>(
+                tensor_shape.total_num_faces(), 0 /*face_offset*/, clear_fp32_dst_acc, dst_index + tile);
+        }
+    }
+    math::clear_dst_reg_addr();
+}
+
+/*************************************************************************
+ * Eltwise Binary Fused Multiply-Add
+ * Dest = SrcA * SrcB + Dest, where Dest is pre-loaded with the addend
+ *************************************************************************/
+
+/**
+ * @brief Initialize FPU to perform a fused multiply-add where Output = SrcA * SrcB + C
+ * ELWMUL always accumulates into dest, so the product is added to the C tile pre-loaded in dest in the same FPU pass,
+ * instead of an ELWMUL followed by an accumulate to dest ELWADD.
+ * @tparam src_b_bcast_type: Broadcast type for source B, values = <NONE/COL/ROW/SCALAR>
+ * @tparam math_fidelity: Math fidelity for controlling precision
+ * @param tensor_shape: Tensor shape describing tile dimensions
+ */
+template <BroadcastType src_b_bcast_type, MathFidelity math_fidelity = MathFidelity::LoFi>
+inline void _llk_math_eltwise_binary_fma_init_(const ckernel::TensorShape &tensor_shape)
+{
+    _llk_math_eltwise_binary_standard_init_<ELWMUL, src_b_bcast_type, math_fidelity>(tensor_shape, 0 /* acc_to_dest */);
+}
+
+/**
+ * @brief Perform a fused multiply-add where Output = SrcA * SrcB + C
+ * C has to be in dest at dst_index before the multiply. With unpack_to_dest and a 32-bit C the unpacker writes C
+ * straight into dest (_llk_unpack_A_ with unpack_to_dest) and this call waits for it, otherwise C has to be moved
+ * into dest beforehand, e.g. with _llk_math_eltwise_unary_datacopy_ (A2D) followed by _llk_math_eltwise_binary_fma_init_.
+ * @tparam src_b_bcast_type: Broadcast type for source B, values = <NONE/COL/ROW/SCALAR>
+ * @tparam Dst: Destination sync mode, values = <Half, Full>
+ * @tparam is_fp32_dest_acc_en: Enable FP32 mode in destination register
+ * @tparam math_fidelity: Math fidelity for controlling precision
+ * @tparam unpack_to_dest: C is unpacked straight into dest
+ * @param tensor_shape: Tensor shape describing tile dimensions
+ * @param dst_index: Tile index into the destination register, holds C and receives the result
+ * @param c_src_format: L1 data format of C, only used with unpack_to_dest
+ * @param c_dst_format: Dest data format of C, only used with unpack_to_dest
+ */
+template <BroadcastType src_b_bcast_type, DstSync Dst, bool is_fp32_dest_acc_en, MathFidelity math_fidelity = MathFidelity::LoFi, bool unpack_to_dest = false>
+inline void _llk_math_eltwise_binary_fma_(
+    const ckernel::TensorShape &tensor_shape, const std::uint32_t dst_index, const std::uint32_t c_src_format = 0, const std::uint32_t c_dst_format = 0)
+{
+    if (unpack_to_dest && is_32bit_input(c_src_format, c_dst_format))
+    {
+        // Hand the dest tile to the unpacker and wait until C has landed in it
+        math_unpack_to_dest_math_ready();
+        math::set_dst_write_addr<DstTileShape::Tile32x32, UnpackDestination::DestReg>(dst_index);
+        math::math_unpack_to_dest_tile_ready();
+    }
+
+    _llk_math_eltwise_binary_standard_<ELWMUL, src_b_bcast_type, Dst, is_fp32_dest_acc_en, math_fidelity>(tensor_shape, dst_index);
+}
+
 /*************************************************************************
  * Public API - Wrapper Functions (Backward Compatible)
  *************************************************************************/
@@ -23,10 +23,82 @@ inline void reduce_configure_addrmod();
 template <ReduceDim dim, MathFidelity math_fidelity>
 inline void reduce_configure_mop();
 
+// Datums stored in int32 dest cannot be moved to SrcB which is configured for int8 inputs
+// Cast int32 datums to int8 using SFPU instructions (load int32, store int8) before moving data to srcB
+// Besides SFPU instructions to do cast we also need to set chicken bit FP16A_FORCE_Enable to force dest
+// view to be fp16a as int8 datums are stored in src registers as fp16a, it has to be cleared after the MOVD2B
+// The cast saturates, so it is only used for MAX/MIN, whose pooled datums are int8 datums scaled by +-1
+template <std::uint32_t dest_row>
+inline void reduce_int_dest_row_to_srcb_format()
+{
+    TTI_STALLWAIT(p_stall::STALL_SFPU, p_stall::MATH);
+    TTI_SFPLOAD(p_sfpu::LREG0, InstrModLoadStore::INT32, ADDR_MOD_0, dest_row /*DEST offset*/);
+    TTI_SFPSTORE(p_sfpu::LREG0, InstrModLoadStore::INT8, ADDR_MOD_0, dest_row /*DEST offset*/);
+    TTI_SFPLOAD(p_sfpu::LREG0, InstrModLoadStore::INT32, ADDR_MOD_0, dest_row + 2 /*DEST offset*/);
+    TTI_SFPSTORE(p_sfpu::LREG0, InstrModLoadStore::INT8, ADDR_MOD_0, dest_row + 2 /*DEST offset*/);
+    TTI_STALLWAIT(p_stall::STALL_MATH, p_stall::WAIT_SFPU);
+    TTI_SETC16(FP16A_FORCE_Enable_ADDR32, 0x1);
+}
+
+// Integer SUM of the pooled row at dest_row into the first datum of the tile, exact in int32
+// The 16 datums are loaded as the even and odd column slices of the row, rows below it are zero. Rotating the slices
+// by 4, 2 and 1 and adding leaves the row total in every slice, subtracting the copy shifted by one slice keeps it in
+// slice 0 only, so the rows 0-3 the total is added to are left unchanged everywhere else.
+template <std::uint32_t dest_row>
+inline void reduce_int_dest_row_sum_to_first_datum()
+{
+    TTI_STALLWAIT(p_stall::STALL_SFPU, p_stall::MATH);
+    TTI_SFPLOAD(p_sfpu::LREG0, InstrModLoadStore::INT32_2S_COMP, ADDR_MOD_0, dest_row /*DEST offset*/);
+    TTI_SFPLOAD(p_sfpu::LREG1, InstrModLoadStore::INT32_2S_COMP, ADDR_MOD_0, dest_row + 2 /*DEST offset*/);
+    TTI_SFPIADD(0, p_sfpu::LREG1, p_sfpu::LREG0, 4); // LREG0 += LREG1
+
+#pragma GCC unroll 3
+    for (std::uint32_t rotate = 4; rotate > 0; rotate >>= 1)
+    {
+        TTI_SFPMOV(0, p_sfpu::LREG0, p_sfpu::LREG1, 0);
+        for (std::uint32_t i = 0; i < rotate; i++)
+        {
+            TTI_SFPSHFT2(0, p_sfpu::LREG1, p_sfpu::LREG1, 3); // rotate right by one column slice
+            TTI_SFPNOP;
+        }
+        TTI_SFPIADD(0, p_sfpu::LREG1, p_sfpu::LREG0, 4); // LREG0 += LREG1
+    }
+
+    TTI_SFPMOV(0, p_sfpu::LREG0, p_sfpu::LREG1, 0);
+    TTI_SFPSHFT2(0, p_sfpu::LREG1, p_sfpu::LREG1, 4); // shift right by one column slice
+    TTI_SFPNOP;
+    TTI_SFPIADD(0, p_sfpu::LREG0, p_sfpu::LREG1, 6); // LREG1 = LREG0 - LREG1
+
+    TTI_SFPLOAD(p_sfpu::LREG0, InstrModLoadStore::INT32_2S_COMP, ADDR_MOD_0, 0 /*DEST offset*/);
+    TTI_SFPIADD(0, p_sfpu::LREG1, p_sfpu::LREG0, 4); // LREG0 += LREG1
+    TTI_SFPSTORE(p_sfpu::LREG0, InstrModLoadStore::INT32_2S_COMP, ADDR_MOD_0, 0 /*DEST offset*/);
+    TTI_STALLWAIT(p_stall::STALL_MATH, p_stall::WAIT_SFPU);
+}
+
+// Integer MIN pools the datums scaled by -1 with GMPOOL, this negates num_rows pooled dest rows from dest_row back
+// to the minimum. Zero datums stay zero, so whole 4 row blocks can be negated.
+template <std::uint32_t dest_row, std::uint32_t num_rows>
+inline void reduce_int_negate_dest_rows()
+{
+    TTI_STALLWAIT(p_stall::STALL_SFPU, p_stall::MATH);
+#pragma GCC unroll 4
+    for (std::uint32_t row = dest_row; row < dest_row + num_rows; row += 4)
+    {
+        TT_SFPLOAD(p_sfpu::LREG0, InstrModLoadStore::INT32_2S_COMP, ADDR_MOD_0, row /*DEST offset*/);
+        TT_SFPLOAD(p_sfpu::LREG1, InstrModLoadStore::INT32_2S_COMP, ADDR_MOD_0, row + 2 /*DEST offset*/);
+        TTI_SFPIADD(0, p_sfpu::LCONST_0, p_sfpu::LREG0, 6); // LREG0 = 0 - LREG0
+        TTI_SFPIADD(0, p_sfpu::LCONST_0, p_sfpu::LREG1, 6); // LREG1 = 0 - LREG1
+        TT_SFPSTORE(p_sfpu::LREG0, InstrModLoadStore::INT32_2S_COMP, ADDR_MOD_0, row /*DEST offset*/);
+        TT_SFPSTORE(p_sfpu::LREG1, InstrModLoadStore::INT32_2S_COMP, ADDR_MOD_0, row + 2 /*DEST offset*/);
+    }
+    TTI_STALLWAIT(p_stall::STALL_MATH, p_stall::WAIT_SFPU);
+}
+
 template <bool enforce_fp32_accumulation, bool is_int_fpu_en>
 inline void reduce_row_perform_transpose()
 {
-    if (enforce_fp32_accumulation)
+    // Int32 dest datums go through srcB in two 16 bit halves too, so the pooled values are moved without an int8 cast
+    if (enforce_fp32_accumulation || is_int_fpu_en)
     {
         // needs to be disabled for MOVD2B/B2D on BH (Issue ##449)
         cfg_reg_rmw_tensix<ALU_ACC_CTRL_Fp32_enabled_RMW>(0);
@@ -62,21 +134,6 @@ inline void reduce_row_perform_transpose()
     }
     else
     {
-        // Datums stored in int32 dest cannot be moved to SrcB which is configured for int8 inputs
-        // Cast int32 datums to int8 using SFPU instructions (load int32, store int8) before moving data to srcB
-        // Besides SFPU instructions to do cast we also need to set chicken bit FP16A_FORCE_Enable to force dest
-        // view to be fp16a as int8 datums are stored in src registers as fp16a
-        if constexpr (is_int_fpu_en)
-        {
-            TTI_STALLWAIT(p_stall::STALL_SFPU, p_stall::MATH);
-            TTI_SFPLOAD(p_sfpu::LREG0, InstrModLoadStore::INT32, ADDR_MOD_0, 0 /*DEST offset*/);
-            TTI_SFPSTORE(p_sfpu::LREG0, InstrModLoadStore::INT8, ADDR_MOD_0, 0 /*DEST offset*/);
-            TTI_SFPLOAD(p_sfpu::LREG0, InstrModLoadStore::INT32, ADDR_MOD_0, 2 /*DEST offset*/);
-            TTI_SFPSTORE(p_sfpu::LREG0, InstrModLoadStore::INT8, ADDR_MOD_0, 2 /*DEST offset*/);
-            TTI_STALLWAIT(p_stall::STALL_MATH, p_stall::WAIT_SFPU);
-            TTI_SETC16(FP16A_FORCE_Enable_ADDR32, 0x1);
-        }
-
         // Move back to B and transpose
         // we avoid clobbering weights in src B by moving to rows 16 - 31
         TTI_SETRWC(p_setrwc::CLR_NONE, p_setrwc::CR_D, 0, 0, 0, p_setrwc::SET_AB);
@@ -94,10 +151,6 @@ inline void reduce_row_perform_transpose()
         // Note: transpose on src B on works on rows 16 - 31
         TTI_TRNSPSRCB;
         TTI_MOVD2B(0, p_movd2b::SRC_ROW16_OFFSET, ADDR_MOD_0, p_movd2b::MOV_1_ROW, 0);
-        if constexpr (is_int_fpu_en)
-        {
-            TTI_SETC16(FP16A_FORCE_Enable_ADDR32, 0x0);
-        }
 
         TTI_SETRWC(p_setrwc::CLR_NONE, p_setrwc::CR_B, 0, 8, 0, p_setrwc::SET_B);
         TTI_SETRWC(p_setrwc::CLR_NONE, p_setrwc::CR_B, 0, 8, 0, p_setrwc::SET_B);
@@ -111,7 +164,7 @@ template <PoolType type, bool high_fidelity, std::uint32_t clear_mode, std::uint
 inline void reduce_pool_op()
 {
     // Transpose for each face in src A done at unpacker, and pool
-    if constexpr (type == PoolType::MAX)
+    if constexpr (type == PoolType::MAX || type == PoolType::MIN)
     {
         TTI_GMPOOL(clear_mode, p_gpool::DIM_16X16, ADDR_MOD_0, p_gpool::INDEX_DIS, index);
     }
@@ -129,6 +182,20 @@ inline void reduce_pool_op()
     }
 }
 
+/**
+ * @brief Reduces one input tile into the dest tile at dst_index, accumulating with what is already there.
+ *
+ * @tparam is_int_fpu_en Int8 operands pooled into int32 dest, exact for every dim. REDUCE_ROW moves the pooled rows
+ *         through srcB in 16 bit halves for the transpose, REDUCE_SCALAR SUM adds up the pooled row with SFPU, and
+ *         REDUCE_SCALAR MAX/MIN transpose through int8 srcB, which holds any max or min of int8 datums. SUM needs a
+ *         scaler of 1 and MathFidelity::HiFi2 or higher so all bits of the int8 datums go through the multiplier. MIN
+ *         needs a scaler of -1: GMPOOL pools the negated datums and the pooled values are negated back with SFPU once
+ *         the tile is reduced, so with transpose_result = false the rows hold the negated minimum until the last tile.
+ *         AVG is not supported, its scaler has no int8 representation.
+ * @param transpose_result REDUCE_ROW only: when false the pooled rows are left in dest without the transpose to
+ *        column layout, so the next tile reduced into the same dst_index keeps accumulating them. Only the last tile of
+ *        a row reduction needs to set it, which does the transpose once for all tiles. Ignored for other dims.
+ */
 template <
     PoolType type,
     ReduceDim dim,
@@ -136,8 +203,11 @@ template <
     MathFidelity math_fidelity,
     bool is_int_fpu_en             = false,
     bool enforce_fp32_accumulation = false>
-inline void _llk_math_reduce_(const std::uint32_t dst_index, const ckernel::TensorShape& tensor_shape)
+inline void _llk_math_reduce_(const std::uint32_t dst_index, const ckernel::TensorShape& tensor_shape, const bool transpose_result = true)
 {
+    static_assert(!is_int_fpu_en || type != PoolType::AVG, "AVG pool is not supported for integer reduce");
+    static_assert(is_int_fpu_en || type != PoolType::MIN, "MIN pool is only supported for integer reduce");
+    static_assert(!(is_int_fpu_en && enforce_fp32_accumulation), "Integer reduce already moves the int32 dest datums in 16 bit halves");
     LLK_ASSERT(validate_tensor_shape_tile_dependent_ops_(tensor_shape), "Invalid tensor shape for tile-dependent op");
 
     // Supported narrow tiles per BH Tiny Tile Summary: [16]x16 (num_faces=1) and [32]x16 (num_faces=2) only
@@ -150,6 +220,32 @@ inline void _llk_math_reduce_(const std::uint32_t dst_index, const ckernel::Tens
 
     if constexpr (dim == ReduceDim::REDUCE_ROW)
     {
+        if (!transpose_result)
+        {
+            // Pool every face and release its src A/B, the rows stay in un-transposed layout until the last tile
+            for (std::uint32_t row_num = 0; row_num < tensor_shape.num_faces_r_dim; row_num++)
+            {
+                for (std::uint32_t col_num = 0; col_num < tensor_shape.num_faces_c_dim; col_num++)
+                {
+                    reduce_pool_op<type, high_fidelity, p_setrwc::CLR_AB, 0>();
+                }
+                if (row_num + 1 < tensor_shape.num_faces_r_dim)
+                {
+                    // Increment dest by 32 or 16 if narrow tile, same as the transposing sequence below
+                    if (!(tensor_shape.num_faces_c_dim < tensor_shape.num_faces_r_dim) /* narrow_tile */)
+                    {
+                        TTI_SETRWC(p_setrwc::CLR_NONE, p_setrwc::CR_D, 8, 0, 0, p_setrwc::SET_D);
+                        TTI_SETRWC(p_setrwc::CLR_NONE, p_setrwc::CR_D, 8, 0, 0, p_setrwc::SET_D);
+                    }
+                    TTI_SETRWC(p_setrwc::CLR_NONE, p_setrwc::CR_D, 8, 0, 0, p_setrwc::SET_D);
+                    TTI_SETRWC(p_setrwc::CLR_NONE, p_setrwc::CR_D, 8, 0, 0, p_setrwc::SET_D);
+                }
+            }
+            // Src valids were already released by the pools
+            TTI_SETRWC(p_setrwc::CLR_NONE, 0, 0, 0, 0, p_setrwc::SET_BD);
+            return;
+        }
+
         // Reduce all faces in a row and perform transpose
         for (std::uint32_t col_num = 0; col_num < static_cast<std::uint32_t>(tensor_shape.num_faces_c_dim - 1); col_num++)
         {
@@ -157,6 +253,10 @@ inline void _llk_math_reduce_(const std::uint32_t dst_index, const ckernel::Tens
         }
         reduce_pool_op<type, high_fidelity, p_setrwc::CLR_NONE, 0>();
         reduce_row_perform_transpose<enforce_fp32_accumulation, is_int_fpu_en>();
+        if constexpr (type == PoolType::MIN)
+        {
+            reduce_int_negate_dest_rows<0, FACE_R_DIM>();
+        }
 
         // If there is only 1 row of faces, then we are done
         if (tensor_shape.num_faces_r_dim > 1)
@@ -177,6 +277,10 @@ inline void _llk_math_reduce_(const std::uint32_t dst_index, const ckernel::Tens
             }
             reduce_pool_op<type, high_fidelity, p_setrwc::CLR_NONE, 0>();
             reduce_row_perform_transpose<enforce_fp32_accumulation, is_int_fpu_en>();
+            if constexpr (type == PoolType::MIN)
+            {
+                reduce_int_negate_dest_rows<0, FACE_R_DIM>();
+            }
         }
 
         TTI_SETRWC(p_setrwc::CLR_AB, 0, 0, 0, 0, p_setrwc::SET_BD);
@@ -197,6 +301,11 @@ inline void _llk_math_reduce_(const std::uint32_t dst_index, const ckernel::Tens
             // Reset Dest Counter
             TTI_SETRWC(p_setrwc::CLR_AB, 0, 0, 0, 0, p_setrwc::SET_AD);
         }
+        if constexpr (type == PoolType::MIN)
+        {
+            reduce_int_negate_dest_rows<0, 4>();
+            reduce_int_negate_dest_rows<FACE_R_DIM, 4>();
+        }
     }
     else if constexpr (dim == ReduceDim::REDUCE_SCALAR)
     {
@@ -208,12 +317,36 @@ inline void _llk_math_reduce_(const std::uint32_t dst_index, const ckernel::Tens
         // Wait and pool
         reduce_pool_op<type, high_fidelity, p_setrwc::CLR_NONE, 4>();
 
+        if constexpr (is_int_fpu_en && type == PoolType::SUM)
+        {
+            // The pooled row does not fit int8 srcB, add it up with SFPU instead of the transpose and second pool
+            reduce_int_dest_row_sum_to_first_datum<4>();
+            // zero out scratch in dest and release src A/B
+            TTI_ZEROACC(p_zeroacc::CLR_SPECIFIC, 0, 0, ADDR_MOD_0, 4);
+            TTI_SETRWC(p_setrwc::CLR_AB, 0, 0, 0, 0, p_setrwc::SET_AB);
+            return;
+        }
+
         // Need row in dest as column in src A
         TTI_SETRWC(p_setrwc::CLR_NONE, p_setrwc::CR_D, 0, 0, 0, p_setrwc::SET_AB);
 
+        if constexpr (type == PoolType::MIN)
+        {
+            // The second pool scales by -1 again, so it needs the column minima rather than their negation
+            reduce_int_negate_dest_rows<4, 4>();
+        }
+        if constexpr (is_int_fpu_en)
+        {
+            reduce_int_dest_row_to_srcb_format<4>();
+        }
+
         // copy over from dest to B and do transpose
         // use rows 16 - 31 in src B as scratch
         TTI_MOVD2B(0, p_movd2b::SRC_ROW16_OFFSET, ADDR_MOD_0, p_movd2b::MOV_1_ROW, 4);
+        if constexpr (is_int_fpu_en)
+        {
+            TTI_SETC16(FP16A_FORCE_Enable_ADDR32, 0x0);
+        }
         TTI_GATESRCRST(0b1, 0b1);
         TTI_TRNSPSRCB;
         // gate math instructions until src B has been updated
@@ -228,9 +361,13 @@ inline void _llk_math_reduce_(const std::uint32_t dst_index, const ckernel::Tens
         // zero out scratch in dest
         TTI_ZEROACC(p_zeroacc::CLR_SPECIFIC, 0, 0, ADDR_MOD_0, 4);
 
-        if constexpr (type == PoolType::MAX)
+        if constexpr (type == PoolType::MAX || type == PoolType::MIN)
         {
             TTI_GMPOOL(p_setrwc::CLR_AB, p_gpool::DIM_16X16, ADDR_MOD_0, p_gpool::INDEX_DIS, 0);
+            if constexpr (type == PoolType::MIN)
+            {
+                reduce_int_negate_dest_rows<0, 4>();
+            }
         }
         else
         {
@@ -326,3 +463,187 @@ inline void _llk_math_reduce_uninit_()
         // Note: BH doesn't need format restoration (init doesn't change it)
     }
 }
+
+// ============================================================================
+// Block reduce
+// ============================================================================
+// Reduces a row of block_ct_dim tiles into one dest tile. The pool results of all tiles but the last are accumulated
+// in dest by a single MOP launch, which pools every face with its own src A/B valid and does no transpose. The last
+// tile goes through the single tile sequence of _llk_math_reduce_, which also accumulates into the same dest rows and
+// then does the REDUCE_ROW transpose or the second REDUCE_SCALAR pool once for the whole block.
+//
+// High fidelity GAPOOL already runs its fidelity phases from the MOP, so SUM/AVG with high fidelity pools the
+// leading tiles from a loop instead.
+
+template <ReduceDim dim>
+inline void reduce_block_configure_addrmod()
+{
+    // REDUCE_ROW pools F0/F1 into dest face 0 and F2/F3 into dest face 2, REDUCE_COL pools F0/F2 into dest face 0 and
+    // F1/F3 into dest face 1
+    constexpr std::uint32_t next_face_rows = (dim == ReduceDim::REDUCE_ROW) ? 2 * FACE_R_DIM : FACE_R_DIM;
+
+    addr_mod_t {
+        .srca = {.incr = 0},
+        .srcb = {.incr = 0},
+        .dest = {.incr = next_face_rows},
+    }
+        .set(ADDR_MOD_4);
+
+    addr_mod_t {
+        .srca = {.incr = 0},
+        .srcb = {.incr = 0},
+        .dest = {.incr = 0, .clr = 1},
+    }
+        .set(ADDR_MOD_5);
+}
+
+template <PoolType type, std::uint32_t addr_mod, std::uint32_t index>
+constexpr std::uint32_t reduce_block_pool_instr()
+{
+    if constexpr (type == PoolType::MAX || type == PoolType::MIN)
+    {
+        return TT_OP_GMPOOL(p_setrwc::CLR_AB, p_gpool::DIM_16X16, addr_mod, p_gpool::INDEX_DIS, index);
+    }
+    else
+    {
+        return TT_OP_GAPOOL(p_setrwc::CLR_AB, p_gpool::DIM_16X16, addr_mod, p_gpool::INDEX_DIS, index);
+    }
+}
+
+template <PoolType type, ReduceDim dim>
+inline void reduce_block_configure_mop(const std::uint32_t num_tiles)
+{
+    // Outer loop over tiles, every pool consumes one face and releases its src A/B
+    if constexpr (dim == ReduceDim::REDUCE_ROW)
+    {
+        // Inner loop over the 2 face rows: pool both faces of the row, the second pool moves dest to face 2 and back
+        constexpr std::uint32_t pool_op      = reduce_block_pool_instr<type, ADDR_MOD_0, 0>();
+        constexpr std::uint32_t pool_next_op = reduce_block_pool_instr<type, ADDR_MOD_4, 0>();
+        constexpr std::uint32_t pool_last_op = reduce_block_pool_instr<type, ADDR_MOD_5, 0>();
+
+        ckernel_template tmp(num_tiles, 2, pool_op, pool_next_op);
+        tmp.set_last_inner_loop_instr(pool_last_op);
+        tmp.set_last_outer_loop_instr(pool_last_op);
+        tmp.program();
+    }
+    else if constexpr (dim == ReduceDim::REDUCE_COL)
+    {
+        // Inner loop over the 2 face rows: the left face pools into dest face 0, the right face into dest face 1
+        constexpr std::uint32_t pool_left_op  = reduce_block_pool_instr<type, ADDR_MOD_4, 0>();
+        constexpr std::uint32_t pool_right_op = reduce_block_pool_instr<type, ADDR_MOD_5, 0>();
+
+        ckernel_template tmp(num_tiles, 2, pool_left_op, pool_right_op);
+        tmp.set_last_inner_loop_instr(pool_right_op);
+        tmp.set_last_outer_loop_instr(pool_right_op);
+        tmp.program();
+    }
+    else
+    {
+        // All 4 faces pool into the same scratch row
+        constexpr std::uint32_t pool_op = reduce_block_pool_instr<type, ADDR_MOD_0, 4>();
+
+        ckernel_template tmp(num_tiles, 4, pool_op);
+        tmp.program();
+    }
+}
+
+// Loop equivalent of the block MOP for high fidelity GAPOOL
+template <PoolType type, ReduceDim dim, bool high_fidelity>
+inline void reduce_block_pool_tile()
+{
+    if constexpr (dim == ReduceDim::REDUCE_ROW)
+    {
+        reduce_pool_op<type, high_fidelity, p_setrwc::CLR_AB, 0>();
+        reduce_pool_op<type, high_fidelity, p_setrwc::CLR_AB, 0>();
+        TTI_SETRWC(p_setrwc::CLR_NONE, p_setrwc::CR_D, 8, 0, 0, p_setrwc::SET_D);
+        TTI_SETRWC(p_setrwc::CLR_NONE, p_setrwc::CR_D, 8, 0, 0, p_setrwc::SET_D);
+        TTI_SETRWC(p_setrwc::CLR_NONE, p_setrwc::CR_D, 8, 0, 0, p_setrwc::SET_D);
+        TTI_SETRWC(p_setrwc::CLR_NONE, p_setrwc::CR_D, 8, 0, 0, p_setrwc::SET_D);
+        reduce_pool_op<type, high_fidelity, p_setrwc::CLR_AB, 0>();
+        reduce_pool_op<type, high_fidelity, p_setrwc::CLR_AB, 0>();
+        TTI_SETRWC(p_setrwc::CLR_NONE, 0, 0, 0, 0, p_setrwc::SET_D);
+    }
+    else if constexpr (dim == ReduceDim::REDUCE_COL)
+    {
+        for (std::uint32_t row_num = 0; row_num < 2; row_num++)
+        {
+            reduce_pool_op<type, high_fidelity, p_setrwc::CLR_AB, 0>();
+            TTI_SETRWC(p_setrwc::CLR_NONE, p_setrwc::CR_D, 8, 0, 0, p_setrwc::SET_D);
+            TTI_SETRWC(p_setrwc::CLR_NONE, p_setrwc::CR_D, 8, 0, 0, p_setrwc::SET_D);
+            reduce_pool_op<type, high_fidelity, p_setrwc::CLR_AB, 0>();
+            TTI_SETRWC(p_setrwc::CLR_NONE, 0, 0, 0, 0, p_setrwc::SET_D);
+        }
+    }
+    else
+    {
+        for (std::uint32_t face_num = 0; face_num < 4; face_num++)
+        {
+            reduce_pool_op<type, high_fidelity, p_setrwc::CLR_AB, 4>();
+        }
+    }
+}
+
+/**
+ * @brief Initializes the block reduce of block_ct_dim tiles into one dest tile.
+ *
+ * Programs the same state as _llk_math_reduce_init_, plus the block MOP that pools the first block_ct_dim - 1 tiles.
+ * block_ct_dim must match the value passed to _llk_math_reduce_block_.
+ */
+template <PoolType type, ReduceDim dim, bool is_fp32_dest_acc_en, MathFidelity math_fidelity, bool enforce_fp32_accumulation = false>
+inline void _llk_math_reduce_block_init_(const std::uint32_t block_ct_dim)
+{
+    LLK_ASSERT(block_ct_dim >= 1 && block_ct_dim <= 128, "block_ct_dim must be in [1, 128]");
+
+    _llk_math_reduce_init_<type, dim, is_fp32_dest_acc_en, math_fidelity, enforce_fp32_accumulation>();
+
+    reduce_block_configure_addrmod<dim>();
+
+    constexpr bool use_block_mop = (type == PoolType::MAX) || (type == PoolType::MIN) || !is_high_fidelity(math_fidelity);
+    if constexpr (use_block_mop)
+    {
+        if (block_ct_dim > 1)
+        {
+            reduce_block_configure_mop<type, dim>(block_ct_dim - 1);
+        }
+    }
+}
+
+/**
+ * @brief Reduces block_ct_dim consecutive input tiles into the dest tile at dst_index.
+ *
+ * Equivalent to block_ct_dim calls of _llk_math_reduce_ with the same dst_index, for the same unpack sequence, but
+ * the leading tiles are pooled by one MOP launch and the REDUCE_ROW transpose is done once per block.
+ * Supports full 32x32 tiles only.
+ */
+template <
+    PoolType type,
+    ReduceDim dim,
+    bool is_fp32_dest_acc_en,
+    MathFidelity math_fidelity,
+    bool is_int_fpu_en             = false,
+    bool enforce_fp32_accumulation = false>
+inline void _llk_math_reduce_block_(const std::uint32_t dst_index, const std::uint32_t block_ct_dim, const ckernel::TensorShape& tensor_shape)
+{
+    LLK_ASSERT(tensor_shape.face_r_dim == FACE_R_DIM && tensor_shape.total_num_faces() == 4, "Block reduce supports full 32x32 tiles only");
+
+    constexpr bool high_fidelity = is_high_fidelity(math_fidelity);
+    constexpr bool use_block_mop = (type == PoolType::MAX) || (type == PoolType::MIN) || !high_fidelity;
+
+    if (block_ct_dim > 1)
+    {
+        math::set_dst_write_addr<DstTileShape::Tile32x32, UnpackDestination::SrcRegs>(dst_index);
+        if constexpr (use_block_mop)
+        {
+            ckernel_template::run();
+        }
+        else
+        {
+            for (std::uint32_t tile = 0; tile < block_ct_dim - 1; tile++)
+            {
+                reduce_block_pool_tile<type, dim, high_fidelity>();
+            }
+        }
+    }
+
+    _llk_math_reduce_<type, dim, is_fp32_dest_acc_en, math_fidelity, is_int_fpu_en, enforce_fp32_accumulation>(dst_index, tensor_shape);
+}
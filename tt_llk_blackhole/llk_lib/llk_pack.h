@@ -17,6 +17,32 @@
 using namespace ckernel;
 using namespace ckernel::packer;
 
+inline std::uint32_t _llk_pack_output_size_bytes_(const std::uint32_t pack_dst_format, const std::uint32_t datum_count)
+{
+    std::uint32_t packed_tile_size_bytes = SCALE_DATUM_SIZE(pack_dst_format, datum_count);
+
+    // SCALE_DATUM_SIZE keeps one-byte-per-datum compatibility for the sub-byte
+    // BFP payload formats. Pack address programming needs the real packed L1
+    // footprint instead: Bfp4 payload is 2 datums/byte, Bfp2 is 4 datums/byte,
+    // and all BFP formats also store one exponent byte per 16 datums
+    // alongside the mantissas.
+    if (pack_dst_format == to_underlying(DataFormat::Bfp4) || pack_dst_format == to_underlying(DataFormat::Bfp4_b))
+    {
+        packed_tile_size_bytes /= 2;
+    }
+    else if (pack_dst_format == to_underlying(DataFormat::Bfp2) || pack_dst_format == to_underlying(DataFormat::Bfp2_b))
+    {
+        packed_tile_size_bytes /= 4;
+    }
+
+    if (IS_BFP_FORMAT(pack_dst_format))
+    {
+        packed_tile_size_bytes += datum_count / 16;
+    }
+
+    return packed_tile_size_bytes;
+}
+
 template <bool untilize = false, bool tilize = false>
 inline void _llk_pack_configure_addrmod_()
 {
@@ -438,3 +464,287 @@ inline void _llk_pack_(const std::uint32_t tile_index, const std::uint32_t addre
 }
 
 #include "llk_pack_untilize.h"
+
+/*************************************************************************
+ * LLK PACK FAST TILIZE (Tilize single input using both unpackers and packer)
+ * unit_dim is the number of tiles processed in a single iteration, num_units is the number of units processed in a single call
+ * unit_dim and num_units must match the ones given to the unpacker and math (all unit_dim usage notes from the unpacker also apply here)
+ * tile_index is the index of the tile inside the destination register to read from
+ * address is the 16B address of where to start packing to (usually the start of the tile row)
+ * supports 4 16x16 faces per tile and 16x32 tiny tiles (num_faces == 2, packed in pairs as a single 32x32 region)
+ * supported output formats are: FP32, FP16_B, BFP8_B, BFP4_B
+ * both dest modes are supported (same usage notes from math apply here)
+ * only DstSync::SyncHalf is supported
+ * tiles are expected to be split into top and bottom faces in separate halves of the active dest bank
+ *
+ * unlike wormhole, blackhole has a single packer whose interfaces read consecutive dest rows,
+ * while rows of a face are interleaved with rows of the other faces of the unit (stride 2 * unit_dim)
+ * for unit_dim 1 every other row belongs to the same face, so every PACR packs two rows through interfaces 0 and 2,
+ * for unit_dim 2 and 3 the neighbouring rows belong to other faces and every PACR packs a single row
+ * the mop packs a whole tile, the moves between faces are done by the address mods of the last PACR of every face:
+ * Y counter walks the rows of the unit and its CR holds the first row of the current face,
+ * Z counter selects the top or bottom half of the active dest bank and W counter selects the unit (16 rows per step)
+ *************************************************************************/
+
+inline void _llk_pack_fast_tilize_addrmod_config_(const std::uint32_t unit_dim, const std::uint32_t num_faces)
+{
+    // moves to the next rows of the same face, rows of a face are 2 * unit_dim apart
+    // for unit_dim 1 a PACR packs two of them so the step is 4, and for unit_dims 2 and 3 it is 4 and 6
+    addr_mod_pack_t {
+        .y_src = {.incr = static_cast<std::uint8_t>(unit_dim == 1 ? 4 : 2 * unit_dim)},
+    }
+        .set(ADDR_MOD_0);
+
+    // follows the last row of the first face of a pair, the second face starts one row after it (Y = ++Y_CR)
+    addr_mod_pack_t {
+        .y_src = {.incr = 1, .cr = 1},
+    }
+        .set(ADDR_MOD_1);
+
+    if (num_faces == 4)
+    {
+        // follows the top faces, the bottom left face lies half a bank below the top left one
+        // Z stride is one row short of that, so going back to the first row of the top right face (Y = Y_CR) lands on it
+        addr_mod_pack_t {
+            .y_src = {.incr = 0, .cr = 1},
+            .z_src = {.incr = 1},
+        }
+            .set(ADDR_MOD_2);
+
+        // follows the bottom faces, Y_CR already points to the top left face of the next tile in the unit
+        addr_mod_pack_t {
+            .y_src = {.incr = 0, .cr = 1},
+            .z_src = {.incr = 0, .clr = 1},
+        }
+            .set(ADDR_MOD_3);
+    }
+    else
+    {
+        // tiny tiles only have top faces, the four faces of the 32x32 region start on consecutive rows
+        addr_mod_pack_t {
+            .y_src = {.incr = 1, .cr = 1},
+        }
+            .set(ADDR_MOD_2);
+
+        addr_mod_pack_t {
+            .y_src = {.incr = 1, .cr = 1},
+        }
+            .set(ADDR_MOD_3);
+    }
+}
+
+inline void _llk_pack_fast_tilize_mop_config_(const std::uint32_t unit_dim)
+{
+    // for unit_dim 1 interfaces 0 and 2 pack two rows of the same face, otherwise a single interface packs one row
+    const std::uint32_t PACK_INTF_SEL  = unit_dim == 1 ? 0b0101 : p_pacr::SINGLE_INTF_ACTIVE;
+    const std::uint32_t PACRS_PER_FACE = unit_dim == 1 ? FACE_R_DIM / 2 : FACE_R_DIM;
+    // the last PACR of a pair of faces differs between the pairs, so it is left out of the replay buffer
+    const std::uint32_t replay_buf_len = 2 * PACRS_PER_FACE - 1;
+
+    load_replay_buf(
+        0,
+        replay_buf_len,
+        [PACK_INTF_SEL, PACRS_PER_FACE]
+        {
+            for (std::uint32_t i = 0; i < PACRS_PER_FACE - 1; i++)
+            {
+                TT_PACR(
+                    p_pacr::CFG_CTXT_0,
+                    p_pacr::NO_ROW_PAD_ZERO,
+                    p_pacr::DST_ACCESS_NORMAL_MODE,
+                    ADDR_MOD_0,
+                    p_pacr::ADDR_CNT_CTXT_0,
+                    p_pacr::P_ZERO_OUTPUT_DISABLED,
+                    PACK_INTF_SEL,
+                    0,
+                    0,
+                    p_pacr::NO_CTXT_CTRL,
+                    0,
+                    0);
+            }
+            // move to the second face of the pair
+            TT_PACR(
+                p_pacr::CFG_CTXT_0,
+                p_pacr::NO_ROW_PAD_ZERO,
+                p_pacr::DST_ACCESS_NORMAL_MODE,
+                ADDR_MOD_1,
+                p_pacr::ADDR_CNT_CTXT_0,
+                p_pacr::P_ZERO_OUTPUT_DISABLED,
+                PACK_INTF_SEL,
+                0,
+                0,
+                p_pacr::NO_CTXT_CTRL,
+                0,
+                0);
+            for (std::uint32_t i = 0; i < PACRS_PER_FACE - 1; i++)
+            {
+                TT_PACR(
+                    p_pacr::CFG_CTXT_0,
+                    p_pacr::NO_ROW_PAD_ZERO,
+                    p_pacr::DST_ACCESS_NORMAL_MODE,
+                    ADDR_MOD_0,
+                    p_pacr::ADDR_CNT_CTXT_0,
+                    p_pacr::P_ZERO_OUTPUT_DISABLED,
+                    PACK_INTF_SEL,
+                    0,
+                    0,
+                    p_pacr::NO_CTXT_CTRL,
+                    0,
+                    0);
+            }
+        });
+
+    // outer loop walks the top and the bottom pair of faces, or the two tiles of a tiny tile pair
+    ckernel::ckernel_template tmp(
+        2,
+        1,
+        lltt::replay_insn(0, replay_buf_len),
+        TT_OP_PACR(
+            p_pacr::CFG_CTXT_0,
+            p_pacr::NO_ROW_PAD_ZERO,
+            p_pacr::DST_ACCESS_NORMAL_MODE,
+            ADDR_MOD_2,
+            p_pacr::ADDR_CNT_CTXT_0,
+            p_pacr::P_ZERO_OUTPUT_DISABLED,
+            PACK_INTF_SEL,
+            0,
+            0,
+            p_pacr::NO_CTXT_CTRL,
+            0,
+            0));
+
+    // close the tile only when it is actually done
+    tmp.set_last_outer_loop_instr(TT_OP_PACR(
+        p_pacr::CFG_CTXT_0,
+        p_pacr::NO_ROW_PAD_ZERO,
+        p_pacr::DST_ACCESS_NORMAL_MODE,
+        ADDR_MOD_3,
+        p_pacr::ADDR_CNT_CTXT_0,
+        p_pacr::P_ZERO_OUTPUT_DISABLED,
+        PACK_INTF_SEL,
+        0,
+        0,
+        p_pacr::NO_CTXT_CTRL,
+        0,
+        1));
+
+    tmp.program();
+}
+
+// Y stride is a single dest row and W stride is a single face, sized by what the packer actually reads from dest
+// Z stride reaches the bottom faces, which math places at half of the active dest bank (256 rows for 16bit and 128 rows for 32bit),
+// it is one row shorter since Y still points to the top right face when moving down to the bottom left one (see the address mods)
+inline void _llk_pack_fast_tilize_set_strides_(const std::uint32_t use_32bit_dest)
+{
+    const std::uint32_t y_stride = FACE_C_DIM * (use_32bit_dest ? 4 : 2);
+    const std::uint32_t z_stride = ((use_32bit_dest ? 0x80 : 0x100) - 1) * y_stride;
+    const std::uint32_t w_stride = FACE_R_DIM * y_stride;
+
+    TT_SETDMAREG(0, LOWER_HALFWORD((y_stride << PCK0_ADDR_CTRL_XY_REG_0_Ystride_SHAMT)), 0, LO_16(p_gpr_pack::TMP0));
+    TT_SETDMAREG(0, UPPER_HALFWORD((y_stride << PCK0_ADDR_CTRL_XY_REG_0_Ystride_SHAMT)), 0, HI_16(p_gpr_pack::TMP0));
+    TT_SETDMAREG(0, LOWER_HALFWORD((z_stride << PCK0_ADDR_CTRL_ZW_REG_0_Zstride_SHAMT)), 0, LO_16(p_gpr_pack::TMP1));
+    TT_SETDMAREG(0, UPPER_HALFWORD((w_stride << PCK0_ADDR_CTRL_ZW_REG_0_Wstride_SHAMT)), 0, HI_16(p_gpr_pack::TMP1));
+    TTI_STALLWAIT(p_stall::STALL_CFG, p_stall::THCON);
+    TTI_WRCFG(p_gpr_pack::TMP0, p_cfg::WRCFG_32b, PCK0_ADDR_CTRL_XY_REG_0_Xstride_ADDR32);
+    TTI_WRCFG(p_gpr_pack::TMP1, p_cfg::WRCFG_32b, PCK0_ADDR_CTRL_ZW_REG_0_Zstride_ADDR32);
+    TTI_NOP;
+    TTI_NOP;
+}
+
+template <DstSync Dst>
+inline void _llk_pack_fast_tilize_init_(
+    const std::uint32_t use_32bit_dest,
+    const std::uint32_t pack_dst_format,
+    const std::uint32_t unit_dim,
+    const std::uint32_t num_faces        = 4,
+    const std::uint32_t l1_tile_elements = TILE_C_DIM * TILE_R_DIM)
+{
+    static_assert(Dst == DstSync::SyncHalf, "fast tilize only supports DstSync::SyncHalf");
+    LLK_ASSERT(num_faces == 2 || num_faces == 4, "num_faces must be 2 or 4");
+    LLK_ASSERT(
+        pack_dst_format == to_underlying(DataFormat::Float16_b) || pack_dst_format == to_underlying(DataFormat::Float32) || num_faces == 4,
+        "16x32 tiny tiles are only supported with float16_b or float32 output formats");
+    // instead of using the actual is_fp32_dest_acc_en flag dest 32 bit mode is enabled if unpack_dst_format is TF32
+    // this is due to a hw quirk with MOVA2D and MOVB2D, so clear PCK_DEST_RD_CTRL_Read_32b_data unless unpack_dst_format is TF32
+    TTI_STALLWAIT(p_stall::STALL_CFG, p_stall::PACK);
+    if (!use_32bit_dest)
+    {
+        cfg_reg_rmw_tensix<PCK_DEST_RD_CTRL_Read_32b_data_RMW>(0);
+    }
+
+    _llk_pack_fast_tilize_set_strides_(use_32bit_dest);
+
+    // set the address offset to the size of the tile in 16B words
+    const std::uint32_t tile_size = _llk_pack_output_size_bytes_(pack_dst_format, l1_tile_elements) >> 4;
+    TT_SETDMAREG(0, LOWER_HALFWORD(tile_size), 0, LO_16(p_gpr_pack::OUTPUT_ADDR_OFFSET));
+
+    // each packer interface packs a single row of a face
+    TTI_SETADCXX(p_setadc::PAC, FACE_C_DIM - 1, 0x0);
+
+    _llk_pack_fast_tilize_addrmod_config_(unit_dim, num_faces);
+
+    _llk_pack_fast_tilize_mop_config_(unit_dim);
+}
+
+template <DstSync Dst, bool is_fp32_dest_acc_en>
+inline void _llk_pack_fast_tilize_uninit_(
+    const std::uint32_t pack_dst_format,
+    const std::uint32_t face_r_dim = FACE_R_DIM,
+    const std::uint32_t num_faces  = 4,
+    const bool partial_face        = false,
+    const bool narrow_tile         = false)
+{
+    TTI_STALLWAIT(p_stall::STALL_CFG, p_stall::PACK);
+    LLK_ASSERT(num_faces == 1 || num_faces == 2 || num_faces == 4, "num_faces must be 1, 2, or 4");
+    // restore PCK_DEST_RD_CTRL_Read_32b_data to the original value
+    cfg_reg_rmw_tensix<PCK_DEST_RD_CTRL_Read_32b_data_RMW>(is_fp32_dest_acc_en);
+
+    // reset counters
+    TTI_SETADCXY(p_setadc::PAC, 0, 0, 0, 0, 0b0011);
+    TTI_SETADCZW(p_setadc::PAC, 0, 0, 0, 0, 0b0101);
+
+    // short inits avoid the packer init, so restore the default address mods, mop and strides here
+    const std::uint32_t pack_src_format = to_underlying(is_fp32_dest_acc_en ? DataFormat::Float32 : DataFormat::Float16_b);
+    _llk_pack_init_<false, false, false>(pack_src_format, pack_dst_format, face_r_dim, TILE_C_DIM, num_faces, partial_face, narrow_tile);
+}
+
+inline void _llk_pack_fast_tilize_block_(
+    const std::uint32_t tile_index, const std::uint32_t address, const std::uint32_t unit_dim, const std::uint32_t num_units, const std::uint32_t num_faces = 4)
+{
+    LLK_ASSERT(unit_dim >= 1 && unit_dim <= 3, "unit_dim must be 1, 2, or 3");
+    LLK_ASSERT(num_faces == 2 || num_faces == 4, "num_faces must be 2 or 4");
+    LLK_ASSERT((unit_dim == 2 && num_faces == 2) || num_faces == 4, "16x32 tiny tiles are only supported with unit_dim 2 for fast_tilize");
+
+    program_packer_destination(address);
+
+    // tiny tiles are packed in pairs, each pair being a single 32x32 region in L1 made of the top faces of both tiles
+    const std::uint32_t l1_tiles_per_unit = num_faces == 2 ? 1 : unit_dim;
+
+    TTI_SETADCZW(p_setadc::PAC, 0, 0, 0, 0, 0b0101);
+
+    for (std::uint32_t i = 0; i < num_units; i++)
+    {
+        // every unit occupies 2 * unit_dim faces (32 rows per tile) in the top half of the active dest bank
+        // Y and its CR start at the top left face of the first tile, the mop leaves them at the next tile of the unit
+        TT_SETADC(p_setadc::PAC, p_setadc::CH_0, p_setadc::SET_W, (tile_index + i * unit_dim) << 1);
+        TTI_SETADCXY(p_setadc::PAC, 0, 0, 0, 0, 0b0011);
+        for (std::uint32_t j = 0; j < l1_tiles_per_unit; j++)
+        {
+            // inside mop:
+            // for (uint pair = 0; pair < 2; pair++)
+            // {
+            //     replay: PACR(ADDR_MOD_0) x 7 or 15, PACR(ADDR_MOD_1), PACR(ADDR_MOD_0) x 7 or 15
+            //     PACR(ADDR_MOD_2), or PACR(ADDR_MOD_3) closing the tile for the last pair
+            // }
+            ckernel::ckernel_template::run();
+            // move to the next tile in L1
+            TTI_ADDDMAREG(0, p_gpr_pack::OUTPUT_ADDR, p_gpr_pack::OUTPUT_ADDR, p_gpr_pack::OUTPUT_ADDR_OFFSET);
+            TTI_STALLWAIT(p_stall::STALL_CFG, p_stall::THCON);
+            TTI_WRCFG(p_gpr_pack::OUTPUT_ADDR, 0, THCON_SEC0_REG1_L1_Dest_addr_ADDR32);
+            TTI_NOP;
+        }
+    }
+
+    TTI_SETADCXY(p_setadc::PAC, 0, 0, 0, 0, 0b0011);
+    TTI_SETADCZW(p_setadc::PAC, 0, 0, 0, 0, 0b1111);
+}
@@ -28,23 +28,28 @@ inline void _llk_pack_untilize_configure_addrmod_()
 
 /*
 block_ct_dim represents the number of input tiles in a block.
-dense is used with num_faces == 2 and even block_ct_dim, where two 16x32 (or smaller) tiles are packed in a single 32x32 tile region in dest.
+dense is used with num_faces == 1 or 2, where 4 / num_faces tiles (16x16 or 16x32, or smaller) are packed in a single 32x32 tile region in dest,
+so block_ct_dim must be a multiple of 4 / num_faces. Dense works with both 16-bit and 32-bit dest, the x stride follows pack_src_format;
+with 32-bit dest only half as many 32x32 tile regions fit in a dest section.
+The runtime variant takes block_ct_dim as an argument so the MOP can be reprogrammed for a narrower tail block of a row band.
 */
-template <std::uint32_t block_ct_dim, bool narrow_row = false, bool dense = false>
-inline void _llk_pack_untilize_mop_config_(const std::uint32_t face_r_dim = FACE_R_DIM, const std::uint32_t num_faces = 4)
+template <bool narrow_row = false, bool dense = false>
+inline void _llk_pack_untilize_mop_config_runtime_(const std::uint32_t block_ct_dim, const std::uint32_t face_r_dim = FACE_R_DIM, const std::uint32_t num_faces = 4)
 {
-    static_assert(!dense || (block_ct_dim % 2 == 0), "block_ct_dim must be even when dense");
     static_assert(!dense || (!narrow_row), "narrow_row must be false when dense");
     LLK_ASSERT(num_faces == 1 || num_faces == 2 || num_faces == 4, "num_faces must be 1, 2, or 4");
-    LLK_ASSERT(!dense || (num_faces == 2), "num_faces must be 2 when dense");
+    LLK_ASSERT(!dense || (num_faces <= 2), "num_faces must be 1 or 2 when dense");
+    const std::uint32_t tiles_per_dest_tile = dense ? TILE_NUM_FACES / num_faces : 1;
+    LLK_ASSERT(block_ct_dim >= 1 && block_ct_dim <= 8 * tiles_per_dest_tile, "block_ct_dim must be in [1, 8] 32x32 tile regions of dest");
+    LLK_ASSERT(block_ct_dim % tiles_per_dest_tile == 0, "block_ct_dim must be a multiple of 4 / num_faces when dense");
     /*
     Outer loop iterates over the rows in the block, while the inner loop iterates
     over each tile in the block.
-    When dense, we use all 4 interfaces to pack out a row each from 4 faces (2 tiles) that end up contiguous in L1
-    because offsets align well and it improves perf, thus we halve the number of mop inner loops.
+    When dense, we use all 4 interfaces to pack out a row each from 4 faces (2 or 4 tiles) that end up contiguous in L1
+    because offsets align well and it improves perf, thus we divide the number of mop inner loops by the number of tiles per 32x32 region.
     */
-    constexpr std::uint32_t MOP_INNER_LOOP = dense ? block_ct_dim / 2 : block_ct_dim;
-    const std::uint32_t MOP_OUTER_LOOP     = face_r_dim;
+    const std::uint32_t MOP_INNER_LOOP = block_ct_dim / tiles_per_dest_tile;
+    const std::uint32_t MOP_OUTER_LOOP = face_r_dim;
 
     // For narrow row, the faces are stored in the first column of the tile, therefore requiring only one packer interface.
     const std::uint32_t PACK_INTF_SEL = (dense)                          ? p_pacr::ALL_INTF_ACTIVE
@@ -133,21 +138,33 @@ inline void _llk_pack_untilize_mop_config_(const std::uint32_t face_r_dim = FACE
     tmp.program();
 }
 
-template <
-    std::uint32_t block_ct_dim,
-    std::uint32_t full_ct_dim    = block_ct_dim,
-    bool narrow_row              = false,
-    std::uint32_t row_num_datums = TILE_C_DIM,
-    bool dense                   = false>
-inline void _llk_pack_untilize_init_(
-    const std::uint32_t pack_src_format, const std::uint32_t pack_dst_format, const std::uint32_t face_r_dim = FACE_R_DIM, const std::uint32_t num_faces = 4)
+template <std::uint32_t block_ct_dim, bool narrow_row = false, bool dense = false>
+inline void _llk_pack_untilize_mop_config_(const std::uint32_t face_r_dim = FACE_R_DIM, const std::uint32_t num_faces = 4)
 {
-    static_assert(block_ct_dim <= (dense ? 16 : 8), "block_ct_dim must be <= 8 when not dense, <= 16 when dense");
     static_assert(!dense || (block_ct_dim % 2 == 0), "block_ct_dim must be even when dense");
     static_assert(!dense || (!narrow_row), "narrow_row must be false when dense");
-    static_assert(full_ct_dim % block_ct_dim == 0, "full_ct_dim must be divisible by block_ct_dim");
+
+    _llk_pack_untilize_mop_config_runtime_<narrow_row, dense>(block_ct_dim, face_r_dim, num_faces);
+}
+
+/*
+Runtime-width variant of _llk_pack_untilize_init_.
+full_ct_dim is the width of the whole row band in tiles and only sets the L1 row stride, so it does not have to be a multiple of block_ct_dim.
+This lets a row band wider than dest be streamed into row-major L1 one dest section at a time, with a narrower tail block if needed.
+*/
+template <bool narrow_row = false, std::uint32_t row_num_datums = TILE_C_DIM, bool dense = false>
+inline void _llk_pack_untilize_init_runtime_(
+    const std::uint32_t pack_src_format,
+    const std::uint32_t pack_dst_format,
+    const std::uint32_t block_ct_dim,
+    const std::uint32_t full_ct_dim,
+    const std::uint32_t face_r_dim = FACE_R_DIM,
+    const std::uint32_t num_faces  = 4)
+{
+    static_assert(!dense || (!narrow_row), "narrow_row must be false when dense");
+    LLK_ASSERT(block_ct_dim <= full_ct_dim, "block_ct_dim must be <= full_ct_dim");
     LLK_ASSERT(num_faces == 1 || num_faces == 2 || num_faces == 4, "num_faces must be 1, 2, or 4");
-    LLK_ASSERT(!dense || (num_faces == 2), "num_faces must be 2 when dense");
+    LLK_ASSERT(!dense || (num_faces <= 2), "num_faces must be 1 or 2 when dense");
 
     if constexpr (narrow_row)
     {
@@ -157,7 +174,7 @@ inline void _llk_pack_untilize_init_(
 
     _llk_pack_untilize_configure_addrmod_();
 
-    _llk_pack_untilize_mop_config_<block_ct_dim, narrow_row, dense>(face_r_dim, num_faces);
+    _llk_pack_untilize_mop_config_runtime_<narrow_row, dense>(block_ct_dim, face_r_dim, num_faces);
 
     // Set CH0 Zstride = 2x16x16 faces, .z_src = {.incr = 1} jumps 2 faces
     std::uint32_t x_stride       = (pack_src_format & 0x3) == to_underlying(DataFormat::Float32)   ? 4
@@ -194,33 +211,34 @@ inline void _llk_pack_untilize_init_(
 
 template <
     std::uint32_t block_ct_dim,
-    std::uint32_t full_ct_dim        = block_ct_dim,
-    bool narrow_row                  = false,
-    std::uint32_t tile_dst_ct_offset = 0,
-    bool dense                       = false>
-inline void _llk_pack_untilize_(
-    const std::uint32_t address,
-    [[maybe_unused]] const std::uint32_t pack_dst_format,
-    [[maybe_unused]] const std::uint32_t face_r_dim = FACE_R_DIM,
-    const std::uint32_t num_faces                   = 4,
-    const std::uint32_t tile_dst_rt_offset          = 0)
+    std::uint32_t full_ct_dim    = block_ct_dim,
+    bool narrow_row              = false,
+    std::uint32_t row_num_datums = TILE_C_DIM,
+    bool dense                   = false>
+inline void _llk_pack_untilize_init_(
+    const std::uint32_t pack_src_format, const std::uint32_t pack_dst_format, const std::uint32_t face_r_dim = FACE_R_DIM, const std::uint32_t num_faces = 4)
 {
-    static_assert(block_ct_dim <= (dense ? 16 : 8), "block_ct_dim must be <= 8 when not dense, <= 16 when dense");
+    static_assert(block_ct_dim <= (dense ? 32 : 8), "block_ct_dim must be <= 8 when not dense, <= 32 when dense");
     static_assert(!dense || (block_ct_dim % 2 == 0), "block_ct_dim must be even when dense");
     static_assert(!dense || (!narrow_row), "narrow_row must be false when dense");
+    static_assert(full_ct_dim % block_ct_dim == 0, "full_ct_dim must be divisible by block_ct_dim");
+
+    _llk_pack_untilize_init_runtime_<narrow_row, row_num_datums, dense>(pack_src_format, pack_dst_format, block_ct_dim, full_ct_dim, face_r_dim, num_faces);
+}
+
+/*
+Runtime variant of _llk_pack_untilize_. Packs the block currently programmed into the MOP
+(see _llk_pack_untilize_init_runtime_ / _llk_pack_untilize_mop_config_runtime_) starting at dest tile tile_dst_offset.
+address points to the top-left datum of the block inside the row-major output, i.e. the row band base address
+advanced by the width of all previously packed blocks.
+*/
+inline void _llk_pack_untilize_runtime_(const std::uint32_t address, const std::uint32_t num_faces = 4, const std::uint32_t tile_dst_offset = 0)
+{
     LLK_ASSERT(num_faces == 1 || num_faces == 2 || num_faces == 4, "num_faces must be 1, 2, or 4");
-    LLK_ASSERT(!dense || (num_faces == 2), "num_faces must be 2 when dense");
 
-    /*
-    full_ct_dim represents the number of input tiles.
-    For input widths greater than 8 tiles, input is split into blocks of equal sizes,
-    each block the size of block_ct_dim. This function is called for each block.
-    */
-    // program_packer_untilized_destination<block_ct_dim, full_ct_dim, diagonal>(address, pack_dst_format);
     program_packer_destination(address);
     const std::uint32_t num_faces_per_rdim_tile = (num_faces > 2) ? 2 : 1;
 
-    const std::uint32_t tile_dst_offset = tile_dst_ct_offset + tile_dst_rt_offset;
     // Set W = (15 + tile_dst_offset) & 0xF, establishing the W_Cr shadow so that ADDRCRZW in the
     // MOP START_OP resets W to this value at the start of each outer loop iteration (row).
     // The first INCADCZW in the inner loop then advances W to tile_dst_offset for the first tile.
@@ -242,6 +260,32 @@ inline void _llk_pack_untilize_(
     set_dst_write_addr(tile_dst_offset);             // reset w counter
 }
 
+template <
+    std::uint32_t block_ct_dim,
+    std::uint32_t full_ct_dim        = block_ct_dim,
+    bool narrow_row                  = false,
+    std::uint32_t tile_dst_ct_offset = 0,
+    bool dense                       = false>
+inline void _llk_pack_untilize_(
+    const std::uint32_t address,
+    [[maybe_unused]] const std::uint32_t pack_dst_format,
+    [[maybe_unused]] const std::uint32_t face_r_dim = FACE_R_DIM,
+    const std::uint32_t num_faces                   = 4,
+    const std::uint32_t tile_dst_rt_offset          = 0)
+{
+    static_assert(block_ct_dim <= (dense ? 32 : 8), "block_ct_dim must be <= 8 when not dense, <= 32 when dense");
+    static_assert(!dense || (block_ct_dim % 2 == 0), "block_ct_dim must be even when dense");
+    static_assert(!dense || (!narrow_row), "narrow_row must be false when dense");
+    LLK_ASSERT(!dense || (num_faces <= 2), "num_faces must be 1 or 2 when dense");
+
+    /*
+    full_ct_dim represents the number of input tiles.
+    For input widths greater than 8 tiles, input is split into blocks of equal sizes,
+    each block the size of block_ct_dim. This function is called for each block.
+    */
+    _llk_pack_untilize_runtime_(address, num_faces, tile_dst_ct_offset + tile_dst_rt_offset);
+}
+
 inline void _llk_pack_untilize_uninit_(const std::uint32_t pack_src_format)
 {
     TTI_STALLWAIT(p_stall::STALL_CFG, p_stall::PACK);
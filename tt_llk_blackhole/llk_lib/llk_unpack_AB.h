@@ -221,3 +221,41 @@ inline void _llk_unpack_AB_(const std::uint32_t address_a, const std::uint32_t a
     // Switch unpacker config context
     switch_config_context(unp_cfg_context);
 }
+
+/**
+ * @brief Unpacks pairs of tiles from arbitrary L1 addresses into srcA and srcB back-to-back
+ *
+ * Gather counterpart of _llk_unpack_AB_: all pairs of the lists are unpacked within a single config context,
+ * with the base addresses of each pair issued through GPRs. Requires _llk_unpack_AB_init_ to have been called.
+ *
+ * @param l1_addresses_a List of num_tiles source A tile addresses
+ * @param l1_addresses_b List of num_tiles source B tile addresses
+ * @param num_tiles Number of tile pairs in the lists
+ */
+inline void _llk_unpack_AB_gather_(const std::uint32_t *l1_addresses_a, const std::uint32_t *l1_addresses_b, const std::uint32_t num_tiles)
+{
+    LLK_ASSERT(num_tiles > 0, "num_tiles must be greater than 0");
+
+    // Wait for free context
+    wait_for_next_context(2);
+
+    // Trisc::SEMPOST for context acquire
+    semaphore_post(semaphore::UNPACK_SYNC);
+
+    for (std::uint32_t tile = 0; tile < num_tiles; tile++)
+    {
+        TTI_SETADCZW(0b011, 0, 0, 0, 0, 0b1111); // reset counters
+
+        _llk_unpack_set_base_address_from_gpr_<p_setadc::UNP_A>(l1_addresses_a[tile]);
+        _llk_unpack_set_base_address_from_gpr_<p_setadc::UNP_B>(l1_addresses_b[tile]);
+
+        // Run MOP
+        ckernel::ckernel_template::run();
+    }
+
+    // T6::SEMGET for context release
+    t6_semaphore_get(semaphore::UNPACK_SYNC);
+
+    // Switch unpacker config context
+    switch_config_context(unp_cfg_context);
+}
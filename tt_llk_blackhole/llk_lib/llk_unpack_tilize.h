@@ -449,3 +449,229 @@ inline void _llk_unpack_tilizeA_B_uninit_(const std::uint32_t unpack_dst_format,
     TTI_WRCFG(p_gpr_unpack::FACE_DIM_16x16, 0, THCON_SEC0_REG5_Tile_x_dim_cntx0_ADDR32);
     TTI_NOP;
 }
+
+/*************************************************************************
+ * LLK UNPACK FAST TILIZE (Tilize single input using both unpackers and packer)
+ * full_dim is the tensor width in number of tiles
+ * unit_dim is the number of tiles processed in a single iteration, num_units is the number of units processed in a single call
+ * unit_dim is 1 (only if full_dim is 1) or 2 and 3 (for any other full_dim)
+ * each call can process unit_dim * num_units tiles but when unit_dim is 2 or 3 all tiles must be in a single row
+ * changing between unit_dim 1 and 2/3 requires reconfiguration while changing between 2 and 3 does not
+ * base_address is the 16B base address of the start of the tile row
+ * tile_index is the index of the tile inside that row
+ * supports 4 16x16 faces per tile and 16x32 tiny tiles (num_faces == 2) with unit_dim 2
+ * supported input formats are: FP32 (via FP16_B or TF32) or FP16_B
+ * unlike _llk_unpack_tilize_, rows are read as plain row major data, so the blackhole tilize workaround is not needed
+ *************************************************************************/
+
+inline void _llk_unpack_fast_tilize_mop_config_()
+{
+    // Y moves to the next tile, Z moves to the next row (both ch0 and ch1)
+    constexpr std::uint8_t ADDRMOD_CH1Y_0_CH1Z_2_CH0Y_0_CH0Z_1 = 0b00'10'00'01;
+    constexpr std::uint8_t ADDRMOD_CH1Y_0_CH1Z_3_CH0Y_0_CH0Z_1 = 0b00'11'00'01;
+
+    // UNPACR instructions are used with unit_dim 2 and SKIP instructions are used with unit_dim 3
+    ckernel_unpack_template tmp = ckernel_unpack_template(
+        true,
+        false,
+        TT_OP_UNPACR_COMMON(SrcA, ADDRMOD_CH1Y_0_CH1Z_2_CH0Y_0_CH0Z_1, 0),
+        TT_OP_NOP,
+        TT_OP_NOP,
+        TT_OP_NOP,
+        TT_OP_UNPACR_COMMON(SrcA, ADDRMOD_CH1Y_0_CH1Z_3_CH0Y_0_CH0Z_1, 0),
+        TT_OP_UNPACR_COMMON(SrcB, ADDRMOD_CH1Y_0_CH1Z_2_CH0Y_0_CH0Z_1, 0),
+        TT_OP_UNPACR_COMMON(SrcB, ADDRMOD_CH1Y_0_CH1Z_3_CH0Y_0_CH0Z_1, 0));
+
+    tmp.program();
+}
+
+inline void _llk_unpack_fast_tilize_init_(const std::uint32_t unpack_dst_format, const std::uint32_t full_dim)
+{
+    cfg_reg_rmw_tensix<THCON_SEC0_REG2_Haloize_mode_RMW>(0);
+
+    // save the following state that is going to be modified:
+    // tile x, y, and z dims for both unpackers
+    // CH1 Z stride for both unpackers
+    TTI_RDCFG(p_gpr_unpack::SR_UNPACK_UNTILIZER_STATE_0, UNP0_ADDR_CTRL_ZW_REG_1_Zstride_ADDR32);
+    TTI_RDCFG(p_gpr_unpack::SR_UNPACK_UNTILIZER_STATE_1, THCON_SEC0_REG5_Tile_x_dim_cntx0_ADDR32);
+    TTI_RDCFG(p_gpr_unpack::SR_UNPACK_UNTILIZER_STATE_2, THCON_SEC0_REG0_TileDescriptor_ADDR32 + 1);
+    TTI_RDCFG(p_gpr_unpack::SR_UNPACK_UNTILIZER_STATE_3, UNP1_ADDR_CTRL_ZW_REG_1_Zstride_ADDR32);
+    TTI_RDCFG(p_gpr_unpack::SR_UNPACK_TILIZER_STATE_0, THCON_SEC1_REG0_TileDescriptor_ADDR32);
+    TTI_RDCFG(p_gpr_unpack::SR_UNPACK_TILIZER_STATE_1, THCON_SEC1_REG0_TileDescriptor_ADDR32 + 1);
+
+    // set x dim to single tile width, moving across y counter moves to the next tile in row major
+    // set y dim to full dim, moving across z counter moves to the next row in row major
+    // set z dim to single face height, moving across w counter moves to the next face row in row major
+    TTI_SETDMAREG(0, TILE_C_DIM, 0, LO_16(p_gpr_unpack::TMP0));
+    TTI_SETDMAREG(0, TILE_C_DIM, 0, HI_16(p_gpr_unpack::TMP0));
+    TTI_STALLWAIT(p_stall::STALL_CFG, p_stall::THCON);
+    TTI_WRCFG(p_gpr_unpack::TMP0, p_cfg::WRCFG_32b, THCON_SEC0_REG5_Tile_x_dim_cntx0_ADDR32);
+    TT_SETDMAREG(0, full_dim, 0, LO_16(p_gpr_unpack::TMP0));
+    TTI_SETDMAREG(0, FACE_R_DIM, 0, HI_16(p_gpr_unpack::TMP0));
+    TTI_STALLWAIT(p_stall::STALL_CFG, p_stall::THCON);
+    TTI_WRCFG(p_gpr_unpack::TMP0, p_cfg::WRCFG_32b, THCON_SEC0_REG0_TileDescriptor_ADDR32 + 1);
+
+    TTI_RDCFG(p_gpr_unpack::TMP0, THCON_SEC1_REG0_TileDescriptor_ADDR32);
+    TTI_SETDMAREG(0, TILE_C_DIM, 0, HI_16(p_gpr_unpack::TMP0));
+    TTI_STALLWAIT(p_stall::STALL_CFG, p_stall::THCON);
+    TTI_WRCFG(p_gpr_unpack::TMP0, p_cfg::WRCFG_32b, THCON_SEC1_REG0_TileDescriptor_ADDR32);
+    TT_SETDMAREG(0, full_dim, 0, LO_16(p_gpr_unpack::TMP0));
+    TTI_SETDMAREG(0, FACE_R_DIM, 0, HI_16(p_gpr_unpack::TMP0));
+    TTI_STALLWAIT(p_stall::STALL_CFG, p_stall::THCON);
+    TTI_WRCFG(p_gpr_unpack::TMP0, p_cfg::WRCFG_32b, THCON_SEC1_REG0_TileDescriptor_ADDR32 + 1);
+
+    // for unit_dim 2 or 3 unpacker read sizes are multiples of 32 datums (64 or 96) so CH1 Z stride is set to 32 datums
+    // for unit_dim 1 unpacker reads whole tile per iteration so CH1 counter is not used
+    // CH1 strides are in bytes, SCALE_DATUM_SIZE doesn't have a case for TF32 so the datum size is computed here
+    const std::uint32_t ch1_x_stride = (unpack_dst_format & 0x3) == to_underlying(DataFormat::Float32) ? 4 : 2;
+    cfg_reg_rmw_tensix<UNP0_ADDR_CTRL_ZW_REG_1_Zstride_RMW>(TILE_C_DIM * ch1_x_stride);
+    cfg_reg_rmw_tensix<UNP1_ADDR_CTRL_ZW_REG_1_Zstride_RMW>(TILE_C_DIM * ch1_x_stride);
+
+    _llk_unpack_fast_tilize_mop_config_();
+}
+
+template <bool is_fp32_dest_acc_en>
+inline void _llk_unpack_fast_tilize_uninit_()
+{
+    TTI_STALLWAIT(p_stall::STALL_CFG, p_stall::UNPACK);
+    // restore saved state
+    TTI_WRCFG(p_gpr_unpack::SR_UNPACK_UNTILIZER_STATE_0, p_cfg::WRCFG_32b, UNP0_ADDR_CTRL_ZW_REG_1_Zstride_ADDR32);
+    TTI_WRCFG(p_gpr_unpack::SR_UNPACK_UNTILIZER_STATE_1, p_cfg::WRCFG_32b, THCON_SEC0_REG5_Tile_x_dim_cntx0_ADDR32);
+    TTI_WRCFG(p_gpr_unpack::SR_UNPACK_UNTILIZER_STATE_2, p_cfg::WRCFG_32b, THCON_SEC0_REG0_TileDescriptor_ADDR32 + 1);
+    TTI_WRCFG(p_gpr_unpack::SR_UNPACK_UNTILIZER_STATE_3, p_cfg::WRCFG_32b, UNP1_ADDR_CTRL_ZW_REG_1_Zstride_ADDR32);
+    TTI_WRCFG(p_gpr_unpack::SR_UNPACK_TILIZER_STATE_0, p_cfg::WRCFG_32b, THCON_SEC1_REG0_TileDescriptor_ADDR32);
+    TTI_WRCFG(p_gpr_unpack::SR_UNPACK_TILIZER_STATE_1, p_cfg::WRCFG_32b, THCON_SEC1_REG0_TileDescriptor_ADDR32 + 1);
+    TTI_NOP;
+
+    // reset all counters
+    TTI_SETADCXY(p_setadc::UNP_AB, 0, 0, 0, 0, 0b1111);
+    TTI_SETADCZW(p_setadc::UNP_AB, 0, 0, 0, 0, 0b1111);
+}
+
+inline void _llk_unpack_fast_tilize_block_(
+    const std::uint32_t base_address,
+    const std::uint32_t tile_index,
+    const std::uint32_t unpack_src_format,
+    const std::uint32_t unit_dim,
+    const std::uint32_t num_units,
+    const std::uint32_t full_dim,
+    const std::uint32_t num_faces = 4)
+{
+    LLK_ASSERT(unit_dim >= 1 && unit_dim <= 3, "unit_dim must be 1, 2, or 3");
+    LLK_ASSERT(num_faces == 2 || num_faces == 4, "num_faces must be 2 or 4");
+    LLK_ASSERT(
+        (unit_dim == 2 && num_faces == 2) || num_faces == 4, "16x32 tiny tiles are only supported for tensors with even-sized tile widths for fast_tilize");
+    volatile std::uint32_t tt_reg_ptr* cfg = get_cfg_pointer();
+
+    const std::uint32_t address = base_address + (SCALE_DATUM_SIZE(unpack_src_format, tile_index * TILE_C_DIM) >> 4); // move by tile width in 16B words
+    // for unit_dim 2 UNPA reads top faces and UNPB reads bottom faces
+    // for unit_dim 3 UNPA reads top 8 rows of top then bottom faces, UNPB reads bottom 8 rows of top then bottom faces
+    // tiny tiles will use same UNPB scheme as unit_dim 3, but only does top faces
+    const std::uint32_t unpB_row_offset = unit_dim == 2 && num_faces == 4 ? FACE_R_DIM : (FACE_R_DIM / 2);
+    const std::uint32_t unpB_address    = address + (SCALE_DATUM_SIZE(unpack_src_format, full_dim * TILE_C_DIM * unpB_row_offset) >> 4);
+
+    // reset all counters since X start and end are set after this
+    TTI_SETADCXY(p_setadc::UNP_AB, 0, 0, 0, 0, 0b1111);
+    TTI_SETADCZW(p_setadc::UNP_AB, 0, 0, 0, 0, 0b1111);
+
+    // unit_dim 1 reads the whole tile while unit_dim 2 and 3 read one row from 2 or 3 tiles
+    if (unit_dim == 1)
+    {
+        TTI_SETADCXX(p_setadc::UNP_AB, TILE_R_DIM * TILE_C_DIM - 1, 0x0);
+    }
+    else if (unit_dim == 2)
+    {
+        TTI_SETADCXX(p_setadc::UNP_AB, 2 * TILE_C_DIM - 1, 0x0);
+    }
+    else
+    {
+        TTI_SETADCXX(p_setadc::UNP_AB, 3 * TILE_C_DIM - 1, 0x0);
+    }
+
+    wait_for_next_context(2);
+
+    // Validate and configure addresses
+    _llk_unpack_configure_addresses_(address, unpB_address, cfg);
+
+    semaphore_post(semaphore::UNPACK_SYNC);
+
+    TTI_STALLWAIT(p_stall::STALL_UNPACK, p_stall::TRISC_CFG);
+
+    // Y moves to the next tile, Z moves to the next row (both ch0 and ch1)
+    constexpr std::uint8_t ADDRMOD_CH1Y_0_CH1Z_0_CH0Y_0_CH0Z_0 = 0b00'00'00'00;
+    constexpr std::uint8_t ADDRMOD_CH1Y_0_CH1Z_0_CH0Y_2_CH0Z_0 = 0b00'00'10'00;
+    constexpr std::uint8_t ADDRMOD_CH1Y_0_CH1Z_3_CH0Y_0_CH0Z_1 = 0b00'11'00'01;
+    constexpr std::uint8_t ADDRMOD_CH1Y_0_CH1Z_0_CH0Y_3_CH0Z_0 = 0b00'00'11'00;
+
+    for (std::uint32_t i = 0; i < num_units; i++)
+    {
+        if (unit_dim == 1)
+        {
+            // read whole tile contiguously then move two face rows down to the next tile
+            TTI_UNPACR_COMMON(SrcA, ADDRMOD_CH1Y_0_CH1Z_0_CH0Y_0_CH0Z_0, 1);
+            TTI_INCADCZW(p_setadc::UNP_A, 0, 0, 2, 0);
+        }
+        else if (unit_dim == 2 && num_faces == 4)
+        {
+            // read top(A)/bottom(B) faces of two tiles in a row (4 faces each), switch bank,
+            // then move to the next two tiles (CH0Y += 2) and back to the top of a tile (CH01Z = 0)
+            // inside mop:
+            // for (std::uint32_t j = 0; j < FACE_R_DIM - 1; j++)
+            // {
+            //     TTI_UNPACR_COMMON(SrcA, ADDRMOD_CH1Y_0_CH1Z_2_CH0Y_0_CH0Z_1, 0);
+            //     TTI_UNPACR_COMMON(SrcB, ADDRMOD_CH1Y_0_CH1Z_2_CH0Y_0_CH0Z_1, 0);
+            // }
+            TTI_MOP(p_mop::MASK_LOOP, (FACE_R_DIM - 1) - 1, 0x0);
+            TTI_UNPACR_COMMON(SrcA, ADDRMOD_CH1Y_0_CH1Z_0_CH0Y_2_CH0Z_0, 1);
+            TTI_UNPACR_COMMON(SrcB, ADDRMOD_CH1Y_0_CH1Z_0_CH0Y_2_CH0Z_0, 1);
+            TTI_SETADCZW(p_setadc::UNP_AB, 0, 0, 0, 0, 0b1111);
+        }
+        else if (unit_dim == 2 && num_faces == 2)
+        {
+            // read top 8(A)/bottom 8(B) rows of top faces of two tiles in a row (4 halves of a face each),
+            // then move to the next two tiles (CH0Y += 2) and back to the top of a tile (CH01Z = 0)
+            // inside mop:
+            // for (std::uint32_t j = 0; j < FACE_R_DIM / 2 - 1; j++)
+            // {
+            //     TTI_UNPACR_COMMON(SrcA, ADDRMOD_CH1Y_0_CH1Z_2_CH0Y_0_CH0Z_1, 0);
+            //     TTI_UNPACR_COMMON(SrcB, ADDRMOD_CH1Y_0_CH1Z_2_CH0Y_0_CH0Z_1, 0);
+            // }
+            TTI_MOP(p_mop::MASK_LOOP, (FACE_R_DIM / 2 - 1) - 1, 0x0);
+            TTI_UNPACR_COMMON(SrcA, ADDRMOD_CH1Y_0_CH1Z_0_CH0Y_2_CH0Z_0, 1);
+            TTI_UNPACR_COMMON(SrcB, ADDRMOD_CH1Y_0_CH1Z_0_CH0Y_2_CH0Z_0, 1);
+            TTI_SETADCZW(p_setadc::UNP_AB, 0, 0, 0, 0, 0b1111);
+        }
+        else
+        {
+            // read top 8(A)/bottom 8(B) rows of top faces of three tiles in a row (6 halves of a face each), switch bank,
+            // then move to the bottom faces (CH0W = 1) and back to the top of a face (CH01Z = 0)
+            // inside mop:
+            // for (std::uint32_t j = 0; j < (FACE_R_DIM / 2) - 1; j++)
+            // {
+            //     TTI_UNPACR_COMMON(SrcA, ADDRMOD_CH1Y_0_CH1Z_3_CH0Y_0_CH0Z_1, 0);
+            //     TTI_UNPACR_COMMON(SrcB, ADDRMOD_CH1Y_0_CH1Z_3_CH0Y_0_CH0Z_1, 0);
+            // }
+            TTI_MOP(p_mop::MASK_LOOP, ((FACE_R_DIM / 2) - 1) - 1, 0xFFFF);
+            TTI_UNPACR_COMMON(SrcA, ADDRMOD_CH1Y_0_CH1Z_3_CH0Y_0_CH0Z_1, 1);
+            TTI_UNPACR_COMMON(SrcB, ADDRMOD_CH1Y_0_CH1Z_3_CH0Y_0_CH0Z_1, 1);
+            TTI_SETADCZW(p_setadc::UNP_AB, 0, 0, 1, 0, 0b1111);
+
+            // read top 8(A)/bottom 8(B) rows of bottom faces of three tiles in a row (6 halves of a face each), switch bank,
+            // then move to the top faces of the next three tiles (CH0Y += 3) and back to top of a tile (CH01Z = 0, CH0W = 0)
+            // inside mop:
+            // for (std::uint32_t j = 0; j < (FACE_R_DIM / 2) - 1; j++)
+            // {
+            //     TTI_UNPACR_COMMON(SrcA, ADDRMOD_CH1Y_0_CH1Z_3_CH0Y_0_CH0Z_1, 0);
+            //     TTI_UNPACR_COMMON(SrcB, ADDRMOD_CH1Y_0_CH1Z_3_CH0Y_0_CH0Z_1, 0);
+            // }
+            TTI_MOP(p_mop::MASK_LOOP, ((FACE_R_DIM / 2) - 1) - 1, 0xFFFF);
+            TTI_UNPACR_COMMON(SrcA, ADDRMOD_CH1Y_0_CH1Z_0_CH0Y_3_CH0Z_0, 1);
+            TTI_UNPACR_COMMON(SrcB, ADDRMOD_CH1Y_0_CH1Z_0_CH0Y_3_CH0Z_0, 1);
+            TTI_SETADCZW(p_setadc::UNP_AB, 0, 0, 0, 0, 0b1111);
+        }
+    }
+
+    t6_semaphore_get(semaphore::UNPACK_SYNC);
+
+    switch_config_context(unp_cfg_context);
+}
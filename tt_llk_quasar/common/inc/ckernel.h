@@ -213,6 +213,19 @@ inline void cfg_rmw(std::uint32_t cfg_addr32, std::uint32_t cfg_shamt, std::uint
     }
 }
 
+// Seeds the PRNG used by the stochastic rounding modes of SFP_STOCH_RND and SFPCAST
+inline void init_prng_seed(const std::uint32_t seed)
+{
+    auto cfg                       = (std::uint32_t volatile *)TENSIX_CFG_BASE;
+    cfg[PRNG_SEED_Seed_Val_ADDR32] = seed;
+
+    // The new seed takes a while to reach the PRNG, keep the SFPU busy until it has
+    for (int i = 0; i < 600; i++)
+    {
+        TTI_SFPNOP(0, 0, 0);
+    }
+}
+
 // WTF is this?????
 // inline void cfg_rmw_gpr(uint32_t cfg_addr32, uint32_t cfg_shamt, uint32_t cfg_mask, uint32_t gpr_index){
 // 	 const uint32_t wrdata = regfile[gpr_index];
@@ -77,4 +77,42 @@ constexpr std::uint32_t DEST_NUM_TILES_FP16      = (DEST_REGISTER_FULL_SIZE * DE
 constexpr std::uint32_t DEST_NUM_TILES_FP16_HALF = DEST_NUM_TILES_FP16 / 2;
 static_assert((DEST_NUM_TILES_FP16 & (DEST_NUM_TILES_FP16 - 1)) == 0);
 
+// Number of datums sharing one E8M0 block exponent in MX (microscaling) formats
+constexpr std::uint32_t MX_BLOCK_SIZE = 32;
+
+// MX formats only exist in L1, the unpacker applies the block exponent when loading the source registers
+constexpr bool is_mx_format(const DataFormat format)
+{
+    switch (format)
+    {
+        case DataFormat::MxFp8R:
+        case DataFormat::MxFp8P:
+        case DataFormat::MxFp6R:
+        case DataFormat::MxFp6P:
+        case DataFormat::MxFp4:
+        case DataFormat::MxInt8:
+        case DataFormat::MxInt4:
+        case DataFormat::MxInt2:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// SFPU binary operations, same values as on Wormhole/Blackhole
+enum class BinaryOp : std::uint8_t
+{
+    ADD           = 0,
+    SUB           = 1,
+    MUL           = 2,
+    DIV           = 3,
+    RSUB          = 4,
+    POW           = 5,
+    XLOGY         = 6,
+    RSHFT         = 7,
+    LSHFT         = 8,
+    LOGICAL_RSHFT = 9,
+    ADD_TOP_ROW   = 10
+};
+
 } // namespace ckernel
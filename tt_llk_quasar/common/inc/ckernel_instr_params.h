@@ -323,13 +323,14 @@ struct p_sfpu
     {
         constexpr static std::uint32_t DEFAULT =
             0b0000; // format is determined by combination of SrcB exponent width of ALU_FORMAT_SPEC_REG and also ACC_CTRL_SFPU_Fp32
-        constexpr static std::uint32_t FP16A  = 0b0001; // stored data will be interpreted as fp16 (fp16_a) format
-        constexpr static std::uint32_t FP16B  = 0b0010; // stored data will be interpreted as bfloat (fp16_b) format
-        constexpr static std::uint32_t FP32   = 0b0011; // stored data will be interpreted as fp32 format
-        constexpr static std::uint32_t INT32  = 0b0100; // stored data will be interpreted as int32 (sign + magnitude) format
-        constexpr static std::uint32_t UINT8  = 0b0101; // stored data will be interpreted as unsigned int8 format
-        constexpr static std::uint32_t UINT16 = 0b0110; // stored data will be interpreted as unsigned int16 format
-                                                        // TODO - Luka: add the other formats
+        constexpr static std::uint32_t FP16A      = 0b0001; // stored data will be interpreted as fp16 (fp16_a) format
+        constexpr static std::uint32_t FP16B      = 0b0010; // stored data will be interpreted as bfloat (fp16_b) format
+        constexpr static std::uint32_t FP32       = 0b0011; // stored data will be interpreted as fp32 format
+        constexpr static std::uint32_t INT32      = 0b0100; // stored data will be interpreted as int32 (sign + magnitude) format
+        constexpr static std::uint32_t INT32_COMP = 0b1100; // int32 (sign + magnitude) in dest, two's complement in the lregs
+        constexpr static std::uint32_t UINT8      = 0b0101; // stored data will be interpreted as unsigned int8 format
+        constexpr static std::uint32_t UINT16     = 0b0110; // stored data will be interpreted as unsigned int16 format
+                                                            // TODO - Luka: add the other formats
     };
 
     struct mad_mode
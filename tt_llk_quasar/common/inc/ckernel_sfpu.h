@@ -9,11 +9,29 @@
 #include "ckernel.h"
 #include "ckernel_defs.h"
 #include "sfpi.h"
+#include "sfpu/ckernel_sfpu_abs.h"
+#include "sfpu/ckernel_sfpu_binary.h"
+#include "sfpu/ckernel_sfpu_binary_bitwise.h"
+#include "sfpu/ckernel_sfpu_comp.h"
+#include "sfpu/ckernel_sfpu_dropout.h"
 #include "sfpu/ckernel_sfpu_exp.h"
+#include "sfpu/ckernel_sfpu_fill.h"
+#include "sfpu/ckernel_sfpu_log.h"
 #include "sfpu/ckernel_sfpu_lrelu.h"
+#include "sfpu/ckernel_sfpu_negative.h"
+#include "sfpu/ckernel_sfpu_quant.h"
 #include "sfpu/ckernel_sfpu_recip.h"
 #include "sfpu/ckernel_sfpu_relu.h"
+#include "sfpu/ckernel_sfpu_shift.h"
 #include "sfpu/ckernel_sfpu_sqrt.h"
 #include "sfpu/ckernel_sfpu_tanh.h"
 #include "sfpu/ckernel_sfpu_typecast_fp16b_uint16.h"
+#include "sfpu/ckernel_sfpu_typecast_fp32_fp16b.h"
+#include "sfpu/ckernel_sfpu_typecast_fp32_int32.h"
+#include "sfpu/ckernel_sfpu_typecast_fp32_uint16.h"
+#include "sfpu/ckernel_sfpu_typecast_int32_fp16b.h"
 #include "sfpu/ckernel_sfpu_typecast_int32_fp32.h"
+#include "sfpu/ckernel_sfpu_typecast_int32_uint16.h"
+#include "sfpu/ckernel_sfpu_typecast_uint16_fp16b.h"
+#include "sfpu/ckernel_sfpu_typecast_uint16_fp32.h"
+#include "sfpu/ckernel_sfpu_where.h"
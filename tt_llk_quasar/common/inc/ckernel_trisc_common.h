@@ -210,6 +210,8 @@ inline void _update_dest_register_offset_()
 struct semaphore
 {
     constexpr static std::uint32_t MATH_PACK = 1; // math <-> pack sync on dest register
+    constexpr static std::uint32_t MATH_SFPU = 2; // math -> sfpu trisc handoff of a dest section
+    constexpr static std::uint32_t SFPU_PACK = 3; // sfpu trisc -> pack handoff of a dest section
 
     constexpr static std::uint16_t t6_sem(const std::uint8_t sem_index)
     {
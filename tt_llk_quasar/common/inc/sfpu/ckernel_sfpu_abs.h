@@ -0,0 +1,34 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "ckernel_ops.h"
+#include "ckernel_trisc_common.h"
+#include "cmath_common.h"
+
+namespace ckernel
+{
+namespace sfpu
+{
+// Calculates ABS for number of rows of output SFPU ops (Quasar = 2 rows)
+inline void _calculate_abs_sfp_rows_()
+{
+    TTI_SFPLOAD(p_sfpu::LREG0, p_sfpu::sfpmem::DEFAULT, ADDR_MOD_7, 0, 0);  // load from dest into lreg[0], uses ADDR_MOD_7 (set to all zeroes)
+    TTI_SFPABS(p_sfpu::LREG0, p_sfpu::LREG1, 1);                            // floating point abs, clears the sign bit
+    TTI_SFPSTORE(p_sfpu::LREG1, p_sfpu::sfpmem::DEFAULT, ADDR_MOD_7, 0, 0); // store from lreg[1] into dest register
+}
+
+inline void _calculate_abs_(const int iterations)
+{
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _calculate_abs_sfp_rows_();
+        ckernel::math::_incr_counters_<0x0, 0x0, ckernel::math::SFP_ROWS, 0x0>(); // does the dest_reg++ (increments by 2 rows)
+    }
+}
+
+} // namespace sfpu
+} // namespace ckernel
@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel_defs.h"
+#include "ckernel_ops.h"
+#include "ckernel_trisc_common.h"
+#include "cmath_common.h"
+
+namespace ckernel
+{
+namespace sfpu
+{
+// Calculates a floating point binary op between two tiles in dest for number of rows of output SFPU ops (Quasar = 2 rows)
+template <BinaryOp BINOP>
+inline void _calculate_sfpu_binary_sfp_rows_(const std::uint32_t dst_index_in0, const std::uint32_t dst_index_in1, const std::uint32_t dst_index_out)
+{
+    static_assert(
+        BINOP == BinaryOp::ADD || BINOP == BinaryOp::SUB || BINOP == BinaryOp::MUL || BINOP == BinaryOp::DIV || BINOP == BinaryOp::RSUB,
+        "Unsupported BinaryOp for _calculate_sfpu_binary_, only ADD, SUB, MUL, DIV and RSUB are allowed.");
+
+    // size of each tile in Dest is 64 rows
+    constexpr std::uint32_t dst_tile_size = 64;
+
+    TT_SFPLOAD(p_sfpu::LREG0, p_sfpu::sfpmem::DEFAULT, ADDR_MOD_7, 0, dst_index_in0 * dst_tile_size); // load in0 into lreg[0]
+    TT_SFPLOAD(p_sfpu::LREG1, p_sfpu::sfpmem::DEFAULT, ADDR_MOD_7, 0, dst_index_in1 * dst_tile_size); // load in1 into lreg[1]
+
+    if constexpr (BINOP == BinaryOp::ADD)
+    {
+        TTI_SFPADD(p_sfpu::LCONST_1, p_sfpu::LREG0, p_sfpu::LREG1, p_sfpu::LREG2, 0); // 1 * in0 + in1
+    }
+    else if constexpr (BINOP == BinaryOp::SUB)
+    {
+        TTI_SFPMAD(p_sfpu::LCONST_neg1, p_sfpu::LREG1, p_sfpu::LREG0, p_sfpu::LREG2, 0); // -1 * in1 + in0
+    }
+    else if constexpr (BINOP == BinaryOp::RSUB)
+    {
+        TTI_SFPMAD(p_sfpu::LCONST_neg1, p_sfpu::LREG0, p_sfpu::LREG1, p_sfpu::LREG2, 0); // -1 * in0 + in1
+    }
+    else if constexpr (BINOP == BinaryOp::MUL)
+    {
+        TTI_SFPMUL(p_sfpu::LREG0, p_sfpu::LREG1, p_sfpu::LCONST_0, p_sfpu::LREG2, 0); // in0 * in1
+    }
+    else if constexpr (BINOP == BinaryOp::DIV)
+    {
+        TTI_SFPNONLINEAR(p_sfpu::LREG1, p_sfpu::LREG2, p_sfpnonlinear::RECIP_MODE);   // approximate 1 / in1
+        TTI_SFPMUL(p_sfpu::LREG0, p_sfpu::LREG2, p_sfpu::LCONST_0, p_sfpu::LREG2, 0); // in0 * (1 / in1)
+    }
+
+    TT_SFPSTORE(p_sfpu::LREG2, p_sfpu::sfpmem::DEFAULT, ADDR_MOD_7, 0, dst_index_out * dst_tile_size); // store from lreg[2] into dest register
+}
+
+// Tile indices are relative to the tile selected by _llk_math_eltwise_unary_sfpu_start_
+template <BinaryOp BINOP>
+inline void _calculate_sfpu_binary_(
+    const int iterations, const std::uint32_t dst_index_in0, const std::uint32_t dst_index_in1, const std::uint32_t dst_index_out)
+{
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _calculate_sfpu_binary_sfp_rows_<BINOP>(dst_index_in0, dst_index_in1, dst_index_out);
+        ckernel::math::_incr_counters_<0x0, 0x0, ckernel::math::SFP_ROWS, 0x0>(); // does the dest_reg++ (increments by 2 rows)
+    }
+}
+
+} // namespace sfpu
+} // namespace ckernel
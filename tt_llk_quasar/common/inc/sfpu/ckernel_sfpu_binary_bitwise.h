@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel_ops.h"
+#include "ckernel_trisc_common.h"
+#include "cmath_common.h"
+
+namespace ckernel
+{
+namespace sfpu
+{
+enum class BinaryBitwiseOp : std::uint8_t
+{
+    AND = 0,
+    OR  = 1,
+    XOR = 2,
+};
+
+// Calculates a bitwise op between two tiles in dest for number of rows of output SFPU ops (Quasar = 2 rows)
+// SFPMEM_TYPE selects how the operands are loaded, p_sfpu::sfpmem::INT32_COMP gives two's complement bits for Int32 tiles
+// in dest, p_sfpu::sfpmem::UINT16 for UInt16 tiles
+template <BinaryBitwiseOp BITWISE_OP, std::uint32_t SFPMEM_TYPE>
+inline void _calculate_sfpu_binary_bitwise_sfp_rows_(const std::uint32_t dst_index_in0, const std::uint32_t dst_index_in1, const std::uint32_t dst_index_out)
+{
+    // size of each tile in Dest is 64 rows
+    constexpr std::uint32_t dst_tile_size = 64;
+
+    TT_SFPLOAD(p_sfpu::LREG0, SFPMEM_TYPE, ADDR_MOD_7, 0, dst_index_in0 * dst_tile_size); // load in0 into lreg[0]
+    TT_SFPLOAD(p_sfpu::LREG1, SFPMEM_TYPE, ADDR_MOD_7, 0, dst_index_in1 * dst_tile_size); // load in1 into lreg[1]
+
+    if constexpr (BITWISE_OP == BinaryBitwiseOp::AND)
+    {
+        TTI_SFPAND(p_sfpu::LREG1, p_sfpu::LREG0); // lreg[0] &= lreg[1]
+    }
+    else if constexpr (BITWISE_OP == BinaryBitwiseOp::OR)
+    {
+        TTI_SFPOR(p_sfpu::LREG1, p_sfpu::LREG0); // lreg[0] |= lreg[1]
+    }
+    else if constexpr (BITWISE_OP == BinaryBitwiseOp::XOR)
+    {
+        TTI_SFPXOR(p_sfpu::LREG1, p_sfpu::LREG0); // lreg[0] ^= lreg[1]
+    }
+
+    TT_SFPSTORE(p_sfpu::LREG0, SFPMEM_TYPE, ADDR_MOD_7, 0, dst_index_out * dst_tile_size); // store from lreg[0] into dest register
+}
+
+// Tile indices are relative to the tile selected by _llk_math_eltwise_unary_sfpu_start_
+template <BinaryBitwiseOp BITWISE_OP, std::uint32_t SFPMEM_TYPE = p_sfpu::sfpmem::INT32_COMP>
+inline void _calculate_sfpu_binary_bitwise_(
+    const int iterations, const std::uint32_t dst_index_in0, const std::uint32_t dst_index_in1, const std::uint32_t dst_index_out)
+{
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _calculate_sfpu_binary_bitwise_sfp_rows_<BITWISE_OP, SFPMEM_TYPE>(dst_index_in0, dst_index_in1, dst_index_out);
+        ckernel::math::_incr_counters_<0x0, 0x0, ckernel::math::SFP_ROWS, 0x0>(); // does the dest_reg++ (increments by 2 rows)
+    }
+}
+
+} // namespace sfpu
+} // namespace ckernel
@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "ckernel_ops.h"
+#include "ckernel_trisc_common.h"
+#include "cmath_common.h"
+#include "llk_defs.h"
+
+namespace ckernel
+{
+namespace sfpu
+{
+// Sets the cc result reg where the value in lreg[0] satisfies the comparison with zero
+template <SfpuType COMP_MODE>
+inline void _set_zero_comp_cc_()
+{
+    if constexpr (COMP_MODE == SfpuType::equal_zero)
+    {
+        TTI_SFPSETCC(0, p_sfpu::LREG0, 6);
+    }
+    else if constexpr (COMP_MODE == SfpuType::not_equal_zero)
+    {
+        TTI_SFPSETCC(0, p_sfpu::LREG0, 2);
+    }
+    else if constexpr (COMP_MODE == SfpuType::less_than_zero)
+    {
+        TTI_SFPSETCC(0, p_sfpu::LREG0, 0);
+    }
+    else if constexpr (COMP_MODE == SfpuType::greater_than_equal_zero)
+    {
+        TTI_SFPSETCC(0, p_sfpu::LREG0, 4);
+    }
+    else if constexpr (COMP_MODE == SfpuType::greater_than_zero)
+    {
+        TTI_SFPGT(0, p_sfpu::LCONST_0, p_sfpu::LREG0, 0x1 /*cc mode*/); // lreg[0] > 0
+    }
+    else if constexpr (COMP_MODE == SfpuType::less_than_equal_zero)
+    {
+        TTI_SFPLE(0, p_sfpu::LCONST_0, p_sfpu::LREG0, 0x1 /*cc mode*/); // lreg[0] <= 0
+    }
+    else
+    {
+        static_assert(COMP_MODE == SfpuType::equal_zero, "Unsupported comparison mode for _calculate_zero_comp_");
+    }
+}
+
+// Calculates comparison with zero for number of rows of output SFPU ops (Quasar = 2 rows), 1.0 where true, 0.0 otherwise
+template <SfpuType COMP_MODE>
+inline void _calculate_zero_comp_sfp_rows_()
+{
+    TTI_SFPLOAD(p_sfpu::LREG0, p_sfpu::sfpmem::DEFAULT, ADDR_MOD_7, 0, 0); // load from dest into lreg[0], uses ADDR_MOD_7 (set to all zeroes)
+
+    TTI_SFPLOADI(p_sfpu::LREG1, 0, 0x0000); // 0.0 in Float16_b
+    _set_zero_comp_cc_<COMP_MODE>();
+    TTI_SFPLOADI(p_sfpu::LREG1, 0, 0x3F80); // 1.0 in Float16_b where the comparison holds
+    TTI_SFPENCC(0, 0);                      // clear cc result reg
+
+    TTI_SFPSTORE(p_sfpu::LREG1, p_sfpu::sfpmem::DEFAULT, ADDR_MOD_7, 0, 0); // store from lreg[1] into dest register
+}
+
+template <SfpuType COMP_MODE>
+inline void _calculate_zero_comp_(const int iterations)
+{
+    TTI_SFPENCC(1, 2); // enable cc
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _calculate_zero_comp_sfp_rows_<COMP_MODE>();
+        ckernel::math::_incr_counters_<0x0, 0x0, ckernel::math::SFP_ROWS, 0x0>(); // does the dest_reg++ (increments by 2 rows)
+    }
+    TTI_SFPENCC(0, 2); // disable cc
+}
+
+} // namespace sfpu
+} // namespace ckernel
@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel.h"
+#include "ckernel_ops.h"
+#include "ckernel_trisc_common.h"
+#include "cmath_common.h"
+
+namespace ckernel
+{
+namespace sfpu
+{
+// Calculates Dropout for number of rows of output SFPU ops (Quasar = 2 rows)
+// lreg[1] holds the scale and lreg[2] the drop probability in [0, 1]. Stochastically rounding the probability to an
+// integer gives 1 with that probability and 0 otherwise, which is the drop decision of the datum
+inline void _calculate_dropout_sfp_rows_()
+{
+    TTI_SFPLOAD(p_sfpu::LREG0, p_sfpu::sfpmem::DEFAULT, ADDR_MOD_7, 0, 0);        // load from dest into lreg[0], uses ADDR_MOD_7 (set to all zeroes)
+    TTI_SFPMUL(p_sfpu::LREG0, p_sfpu::LREG1, p_sfpu::LCONST_0, p_sfpu::LREG0, 0); // lreg[0] = in * scale
+    // lreg[3] = 1 with the drop probability, 0 otherwise
+    TTI_SFP_STOCH_RND(p_sfpu::sfp_stochrnd_rnd_mod::Stochastic, 0, 0, p_sfpu::LREG2, p_sfpu::LREG3, (1 << 3) | p_sfpu::sfp_stochrnd_mod::FP32_TO_UINT8);
+    TTI_SFPSETCC(0, p_sfpu::LREG3, 2);                                      // where the probability rounded up to 1
+    TTI_SFPMOV(p_sfpu::LCONST_0, p_sfpu::LREG0, 0);                         // drop the datum
+    TTI_SFPENCC(0, 0);                                                      // clear cc result reg
+    TTI_SFPSTORE(p_sfpu::LREG0, p_sfpu::sfpmem::DEFAULT, ADDR_MOD_7, 0, 0); // store from lreg[0] into dest register
+}
+
+// probability should be between 0 - INT_MAX (signed)
+// scale should be binary representation of a float32
+inline void _calculate_dropout_(const int iterations, const std::uint32_t probability, const std::uint32_t scale)
+{
+    TT_SFPLOADI(p_sfpu::LREG1, 0x8, scale >> 16);                                 // upper 16 bits of the scale
+    TT_SFPLOADI(p_sfpu::LREG1, 0xA, scale & 0xFFFF);                              // lower 16 bits of the scale
+    TT_SFPLOADI(p_sfpu::LREG2, 0x8, probability >> 16);                           // upper 16 bits of the probability
+    TT_SFPLOADI(p_sfpu::LREG2, 0xA, probability & 0xFFFF);                        // lower 16 bits of the probability
+    TTI_SFPCAST(p_sfpu::LREG2, p_sfpu::LREG2, 0);                                 // probability is a positive int32, convert to fp32
+    TTI_SFPLOADI(p_sfpu::LREG3, 0, 0x3000);                                       // 2^-31 as fp16b
+    TTI_SFPMUL(p_sfpu::LREG2, p_sfpu::LREG3, p_sfpu::LCONST_0, p_sfpu::LREG2, 0); // lreg[2] = probability / 2^31
+
+    TTI_SFPENCC(1, 2); // enable cc
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _calculate_dropout_sfp_rows_();
+        ckernel::math::_incr_counters_<0x0, 0x0, ckernel::math::SFP_ROWS, 0x0>(); // does the dest_reg++ (increments by 2 rows)
+    }
+    TTI_SFPENCC(0, 2); // disable cc
+}
+
+inline void _init_dropout_(const std::uint32_t seed)
+{
+    init_prng_seed(seed);
+}
+
+} // namespace sfpu
+} // namespace ckernel
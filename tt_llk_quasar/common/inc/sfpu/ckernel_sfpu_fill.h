@@ -0,0 +1,33 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel_ops.h"
+#include "ckernel_trisc_common.h"
+#include "cmath_common.h"
+
+namespace ckernel
+{
+namespace sfpu
+{
+// Fills dest with a 32-bit value, value_bits is the raw bit pattern (fp32 or int32)
+// stored with the given sfpmem type (e.g. p_sfpu::sfpmem::FP32 or p_sfpu::sfpmem::INT32)
+template <std::uint32_t SFPMEM_TYPE>
+inline void _calculate_fill_(const int iterations, const std::uint32_t value_bits)
+{
+    TT_SFPLOADI(p_sfpu::LREG0, 0x8, (value_bits >> 16));    // upper 16 bits
+    TT_SFPLOADI(p_sfpu::LREG0, 0xA, (value_bits & 0xFFFF)); // lower 16 bits
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        TTI_SFPSTORE(p_sfpu::LREG0, SFPMEM_TYPE, ADDR_MOD_7, 0, 0);               // store from lreg[0] into dest register
+        ckernel::math::_incr_counters_<0x0, 0x0, ckernel::math::SFP_ROWS, 0x0>(); // does the dest_reg++ (increments by 2 rows)
+    }
+}
+
+} // namespace sfpu
+} // namespace ckernel
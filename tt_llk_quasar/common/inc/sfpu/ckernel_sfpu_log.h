@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "ckernel_ops.h"
+#include "ckernel_trisc_common.h"
+#include "cmath_common.h"
+
+namespace ckernel
+{
+namespace sfpu
+{
+// ln(x) = ln(mantissa) + exponent * ln(2), the mantissa in [1, 2) is approximated with a 3rd order polynomial
+// in Horner form, x * (x * (A * x + B) + C) + D, with the same coefficients as Wormhole/Blackhole.
+// LREG3 holds ln(2) and LREG4-LREG7 hold A, B, C and D, they are loaded by _init_log_.
+inline void _init_log_()
+{
+    TTI_SFPLOADI(p_sfpu::LREG3, 0x8, 0x3F31); // ln(2) = 0.693147
+    TTI_SFPLOADI(p_sfpu::LREG3, 0xA, 0x7218);
+    TTI_SFPLOADI(p_sfpu::LREG4, 0x8, 0x3DD8); // A = 0.1058
+    TTI_SFPLOADI(p_sfpu::LREG4, 0xA, 0xADAC);
+    TTI_SFPLOADI(p_sfpu::LREG5, 0x8, 0xBF37); // B = -0.7166
+    TTI_SFPLOADI(p_sfpu::LREG5, 0xA, 0x7319);
+    TTI_SFPLOADI(p_sfpu::LREG6, 0x8, 0x4005); // C = 2.0871
+    TTI_SFPLOADI(p_sfpu::LREG6, 0xA, 0x930C);
+    TTI_SFPLOADI(p_sfpu::LREG7, 0x8, 0xBFBC); // D = -1.4753
+    TTI_SFPLOADI(p_sfpu::LREG7, 0xA, 0xD6A1);
+}
+
+// Calculates LOG for number of rows of output SFPU ops (Quasar = 2 rows)
+inline void _calculate_log_sfp_rows_()
+{
+    TTI_SFPLOAD(p_sfpu::LREG0, p_sfpu::sfpmem::DEFAULT, ADDR_MOD_7, 0, 0); // load from dest into lreg[0], uses ADDR_MOD_7 (set to all zeroes)
+
+    // Normalize to [1, 2) by setting the exponent to the bias
+    TTI_SFPSETEXP(127, p_sfpu::LREG0, p_sfpu::LREG1, 1);
+
+    // Polynomial on the mantissa, result in lreg[2]
+    TTI_SFPMAD(p_sfpu::LREG1, p_sfpu::LREG4, p_sfpu::LREG5, p_sfpu::LREG2, 0); // A * x + B
+    TTI_SFPMAD(p_sfpu::LREG2, p_sfpu::LREG1, p_sfpu::LREG6, p_sfpu::LREG2, 0); // (A * x + B) * x + C
+    TTI_SFPMAD(p_sfpu::LREG2, p_sfpu::LREG1, p_sfpu::LREG7, p_sfpu::LREG2, 0); // ((A * x + B) * x + C) * x + D
+
+    // Unbiased exponent is 2's complement, SFPCAST expects sign + magnitude
+    TTI_SFPEXEXP(p_sfpu::LREG0, p_sfpu::LREG1, 0);
+    TTI_SFPSETCC(0, p_sfpu::LREG1, 0);                 // where the exponent is negative
+    TTI_SFPNOT(p_sfpu::LREG1, p_sfpu::LREG1);          // ~exp
+    TTI_SFPIADD(1, p_sfpu::LREG1, p_sfpu::LREG1, 5);   // ~exp + 1, no cc update
+    TTI_SFPSETSGN(1, p_sfpu::LREG1, p_sfpu::LREG1, 1); // set the sign bit
+    TTI_SFPENCC(0, 0);                                 // clear cc result reg
+    TTI_SFPCAST(p_sfpu::LREG1, p_sfpu::LREG1, 0);      // convert from int32 sign+mag to fp32 using rnd nearest even
+
+    TTI_SFPMAD(p_sfpu::LREG1, p_sfpu::LREG3, p_sfpu::LREG2, p_sfpu::LREG2, 0); // exp * ln(2) + ln(mantissa)
+
+    // ln(0) = -inf
+    TTI_SFPSETCC(0, p_sfpu::LREG0, 6);      // where the input is zero
+    TTI_SFPLOADI(p_sfpu::LREG2, 0, 0xFF80); // -inf in Float16_b
+    TTI_SFPENCC(0, 0);                      // clear cc result reg
+
+    TTI_SFPSTORE(p_sfpu::LREG2, p_sfpu::sfpmem::DEFAULT, ADDR_MOD_7, 0, 0); // store from lreg[2] into dest register
+}
+
+inline void _calculate_log_(const int iterations)
+{
+    TTI_SFPENCC(1, 2); // enable cc
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _calculate_log_sfp_rows_();
+        ckernel::math::_incr_counters_<0x0, 0x0, ckernel::math::SFP_ROWS, 0x0>(); // does the dest_reg++ (increments by 2 rows)
+    }
+    TTI_SFPENCC(0, 2); // disable cc
+}
+
+} // namespace sfpu
+} // namespace ckernel
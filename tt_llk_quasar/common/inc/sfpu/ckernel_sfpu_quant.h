@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel_ops.h"
+#include "ckernel_trisc_common.h"
+#include "cmath_common.h"
+
+namespace ckernel
+{
+namespace sfpu
+{
+// Quasar dest holds Int32 in sign-magnitude, the same as SFPCAST and SFP_STOCH_RND, so no 2's complement
+// conversion is needed around the loads and stores. lreg[2] holds the zero point, see _init_quant_zero_point_
+
+// Calculates quantization (out = int8(in0 * in1 + zero_point)) for number of rows of output SFPU ops (Quasar = 2 rows)
+inline void _quant_int32_sfp_rows_(const std::uint32_t dst_index_in0, const std::uint32_t dst_index_in1, const std::uint32_t dst_index_out)
+{
+    // size of each tile in Dest is 64 rows
+    constexpr std::uint32_t dst_tile_size = 64;
+
+    TT_SFPLOAD(p_sfpu::LREG0, p_sfpu::sfpmem::FP32, ADDR_MOD_7, 0, dst_index_in0 * dst_tile_size); // load the fp32 input into lreg[0]
+    TT_SFPLOAD(p_sfpu::LREG1, p_sfpu::sfpmem::FP32, ADDR_MOD_7, 0, dst_index_in1 * dst_tile_size); // load the fp32 scale into lreg[1]
+    TTI_SFPMAD(p_sfpu::LREG0, p_sfpu::LREG1, p_sfpu::LREG2, p_sfpu::LREG0, 0);                     // lreg[0] = in0 * scale + zero_point
+    // fp32 -> int8 with a descale of zero, saturates to [-127, 127]
+    TTI_SFP_STOCH_RND(p_sfpu::sfp_stochrnd_rnd_mod::NearEven, 0, 0, p_sfpu::LREG0, p_sfpu::LREG0, (1 << 3) | p_sfpu::sfp_stochrnd_mod::FP32_TO_INT8);
+    TT_SFPSTORE(p_sfpu::LREG0, p_sfpu::sfpmem::INT32, ADDR_MOD_7, 0, dst_index_out * dst_tile_size); // store from lreg[0] into dest as int32
+}
+
+// Calculates requantization (out = int8(in0 * in1 + zero_point) with an int32 in0) for number of rows of output SFPU ops
+inline void _requant_int32_sfp_rows_(const std::uint32_t dst_index_in0, const std::uint32_t dst_index_in1, const std::uint32_t dst_index_out)
+{
+    // size of each tile in Dest is 64 rows
+    constexpr std::uint32_t dst_tile_size = 64;
+
+    TT_SFPLOAD(p_sfpu::LREG0, p_sfpu::sfpmem::INT32, ADDR_MOD_7, 0, dst_index_in0 * dst_tile_size); // load the int32 input into lreg[0]
+    TT_SFPLOAD(p_sfpu::LREG1, p_sfpu::sfpmem::FP32, ADDR_MOD_7, 0, dst_index_in1 * dst_tile_size);  // load the fp32 scale into lreg[1]
+    TTI_SFPCAST(p_sfpu::LREG0, p_sfpu::LREG0, 0);                                                   // int32 sign+mag -> fp32, rnd nearest even
+    TTI_SFPMAD(p_sfpu::LREG0, p_sfpu::LREG1, p_sfpu::LREG2, p_sfpu::LREG0, 0);                      // lreg[0] = in0 * scale + zero_point
+    // fp32 -> int8 with a descale of zero, saturates to [-127, 127]
+    TTI_SFP_STOCH_RND(p_sfpu::sfp_stochrnd_rnd_mod::NearEven, 0, 0, p_sfpu::LREG0, p_sfpu::LREG0, (1 << 3) | p_sfpu::sfp_stochrnd_mod::FP32_TO_INT8);
+    TT_SFPSTORE(p_sfpu::LREG0, p_sfpu::sfpmem::INT32, ADDR_MOD_7, 0, dst_index_out * dst_tile_size); // store from lreg[0] into dest as int32
+}
+
+// Calculates dequantization (out = (in0 - zero_point) * in1 in fp32) for number of rows of output SFPU ops (Quasar = 2 rows)
+// lreg[2] holds the negated zero point
+inline void _dequant_int32_sfp_rows_(const std::uint32_t dst_index_in0, const std::uint32_t dst_index_in1, const std::uint32_t dst_index_out)
+{
+    // size of each tile in Dest is 64 rows
+    constexpr std::uint32_t dst_tile_size = 64;
+
+    TT_SFPLOAD(p_sfpu::LREG0, p_sfpu::sfpmem::INT32, ADDR_MOD_7, 0, dst_index_in0 * dst_tile_size); // load the int32 input into lreg[0]
+    TT_SFPLOAD(p_sfpu::LREG1, p_sfpu::sfpmem::FP32, ADDR_MOD_7, 0, dst_index_in1 * dst_tile_size);  // load the fp32 scale into lreg[1]
+    TTI_SFPCAST(p_sfpu::LREG0, p_sfpu::LREG0, 0);                                                   // int32 sign+mag -> fp32, rnd nearest even
+    TTI_SFPADD(p_sfpu::LREG0, p_sfpu::LCONST_1, p_sfpu::LREG2, p_sfpu::LREG0, 0);                   // lreg[0] = in0 * 1 + (-zero_point)
+    TTI_SFPMUL(p_sfpu::LREG0, p_sfpu::LREG1, p_sfpu::LCONST_0, p_sfpu::LREG0, 0);                   // lreg[0] = lreg[0] * scale + 0
+    TT_SFPSTORE(p_sfpu::LREG0, p_sfpu::sfpmem::FP32, ADDR_MOD_7, 0, dst_index_out * dst_tile_size); // store from lreg[0] into dest as fp32
+}
+
+// Tile indices are relative to the tile selected by _llk_math_eltwise_unary_sfpu_start_
+inline void _quant_int32_(const int iterations, const std::uint32_t dst_index_in0, const std::uint32_t dst_index_in1, const std::uint32_t dst_index_out)
+{
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _quant_int32_sfp_rows_(dst_index_in0, dst_index_in1, dst_index_out);
+        ckernel::math::_incr_counters_<0x0, 0x0, ckernel::math::SFP_ROWS, 0x0>(); // does the dest_reg++ (increments by 2 rows)
+    }
+}
+
+inline void _requant_int32_(const int iterations, const std::uint32_t dst_index_in0, const std::uint32_t dst_index_in1, const std::uint32_t dst_index_out)
+{
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _requant_int32_sfp_rows_(dst_index_in0, dst_index_in1, dst_index_out);
+        ckernel::math::_incr_counters_<0x0, 0x0, ckernel::math::SFP_ROWS, 0x0>(); // does the dest_reg++ (increments by 2 rows)
+    }
+}
+
+inline void _dequant_int32_(const int iterations, const std::uint32_t dst_index_in0, const std::uint32_t dst_index_in1, const std::uint32_t dst_index_out)
+{
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _dequant_int32_sfp_rows_(dst_index_in0, dst_index_in1, dst_index_out);
+        ckernel::math::_incr_counters_<0x0, 0x0, ckernel::math::SFP_ROWS, 0x0>(); // does the dest_reg++ (increments by 2 rows)
+    }
+}
+
+// zero_point is the binary representation of a float32, dequantization takes it negated
+inline void _init_quant_zero_point_(const std::uint32_t zero_point)
+{
+    TT_SFPLOADI(p_sfpu::LREG2, 0x8, zero_point >> 16);    // upper 16 bits of the zero point into lreg[2]
+    TT_SFPLOADI(p_sfpu::LREG2, 0xA, zero_point & 0xFFFF); // lower 16 bits of the zero point into lreg[2]
+}
+
+} // namespace sfpu
+} // namespace ckernel
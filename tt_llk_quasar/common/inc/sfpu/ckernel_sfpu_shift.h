@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel_defs.h"
+#include "ckernel_ops.h"
+#include "ckernel_trisc_common.h"
+#include "cmath_common.h"
+
+namespace ckernel
+{
+namespace sfpu
+{
+// Zeroes the value in lreg[0] where the shift amount in lreg[1] is outside of [0, 32), all bits are shifted out there
+inline void _zero_out_of_range_shift_()
+{
+    TTI_SFPSETCC(0, p_sfpu::LREG1, 4);                   // where shift_amount >= 0
+    TTI_SFPIADD(0xFE0, p_sfpu::LREG1, p_sfpu::LREG2, 1); // and shift_amount - 32 < 0 (0xFE0 = -32)
+    TTI_SFPCOMPC;                                        // invert, shift_amount < 0 or shift_amount >= 32
+    TTI_SFPMOV(p_sfpu::LCONST_0, p_sfpu::LREG0, 0);      // lreg[0] = 0
+    TTI_SFPENCC(0, 0);                                   // clear cc result reg
+}
+
+// Calculates a shift of the first tile by the amounts in the second tile for number of rows of output SFPU ops (Quasar = 2 rows)
+// SFPMEM_TYPE selects how the operands are loaded, p_sfpu::sfpmem::INT32_COMP for Int32 tiles in dest
+template <BinaryOp SHIFT_OP, std::uint32_t SFPMEM_TYPE>
+inline void _calculate_sfpu_binary_shift_sfp_rows_(const std::uint32_t dst_index_in0, const std::uint32_t dst_index_in1, const std::uint32_t dst_index_out)
+{
+    static_assert(
+        SHIFT_OP == BinaryOp::LSHFT || SHIFT_OP == BinaryOp::RSHFT || SHIFT_OP == BinaryOp::LOGICAL_RSHFT,
+        "Unsupported BinaryOp for _calculate_sfpu_binary_shift_, only LSHFT, RSHFT and LOGICAL_RSHFT are allowed.");
+
+    // size of each tile in Dest is 64 rows
+    constexpr std::uint32_t dst_tile_size = 64;
+
+    TT_SFPLOAD(p_sfpu::LREG0, SFPMEM_TYPE, ADDR_MOD_7, 0, dst_index_in0 * dst_tile_size); // load the values into lreg[0]
+    TT_SFPLOAD(p_sfpu::LREG1, SFPMEM_TYPE, ADDR_MOD_7, 0, dst_index_in1 * dst_tile_size); // load the shift amounts into lreg[1]
+
+    if constexpr (SHIFT_OP == BinaryOp::RSHFT)
+    {
+        // Arithmetic shift right is ~(~value >> shift_amount) for negative values, so shift non negative bits only
+        TTI_SFPMOV(p_sfpu::LREG0, p_sfpu::LREG3, 0); // keep the value for its sign in lreg[3]
+        TTI_SFPSETCC(0, p_sfpu::LREG0, 0);           // where value < 0
+        TTI_SFPNOT(p_sfpu::LREG0, p_sfpu::LREG0);    // lreg[0] = ~value
+        TTI_SFPENCC(0, 0);                           // clear cc result reg
+    }
+
+    _zero_out_of_range_shift_();
+
+    if constexpr (SHIFT_OP != BinaryOp::LSHFT)
+    {
+        TTI_SFPIADD(0, p_sfpu::LCONST_0, p_sfpu::LREG1, 6); // lreg[1] = -shift_amount, a negative amount shifts right
+    }
+    TTI_SFPSHFT(0, p_sfpu::LREG1, p_sfpu::LREG0, 0); // logical shift of lreg[0] by lreg[1]
+
+    if constexpr (SHIFT_OP == BinaryOp::RSHFT)
+    {
+        TTI_SFPSETCC(0, p_sfpu::LREG3, 0);        // where value < 0
+        TTI_SFPNOT(p_sfpu::LREG0, p_sfpu::LREG0); // shift in ones, out of range amounts give -1
+        TTI_SFPENCC(0, 0);                        // clear cc result reg
+    }
+
+    TT_SFPSTORE(p_sfpu::LREG0, SFPMEM_TYPE, ADDR_MOD_7, 0, dst_index_out * dst_tile_size); // store from lreg[0] into dest register
+}
+
+// Tile indices are relative to the tile selected by _llk_math_eltwise_unary_sfpu_start_
+template <BinaryOp SHIFT_OP, std::uint32_t SFPMEM_TYPE = p_sfpu::sfpmem::INT32_COMP>
+inline void _calculate_sfpu_binary_shift_(
+    const int iterations, const std::uint32_t dst_index_in0, const std::uint32_t dst_index_in1, const std::uint32_t dst_index_out)
+{
+    TTI_SFPENCC(1, 2); // enable cc
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _calculate_sfpu_binary_shift_sfp_rows_<SHIFT_OP, SFPMEM_TYPE>(dst_index_in0, dst_index_in1, dst_index_out);
+        ckernel::math::_incr_counters_<0x0, 0x0, ckernel::math::SFP_ROWS, 0x0>(); // does the dest_reg++ (increments by 2 rows)
+    }
+    TTI_SFPENCC(0, 2); // disable cc
+}
+
+} // namespace sfpu
+} // namespace ckernel
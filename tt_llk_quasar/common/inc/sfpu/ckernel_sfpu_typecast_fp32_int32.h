@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "ckernel_trisc_common.h"
+#include "cmath_common.h"
+
+namespace ckernel
+{
+namespace sfpu
+{
+// Calculates Typecast for number of rows of output SFPU ops (Quasar = 2 rows)
+// Truncates towards zero, values outside of the int32 range saturate to +-INT_MAX since sign+magnitude has no INT_MIN
+inline void _calculate_typecast_fp32_to_int32_rows()
+{
+    TTI_SFPLOAD(p_sfpu::LREG0, p_sfpu::sfpmem::FP32, ADDR_MOD_7, 0, 0); // load from dest into lreg[0], uses ADDR_MOD_7 (set to all zeroes)
+    TTI_SFPMOV(p_sfpu::LCONST_0, p_sfpu::LREG1, 0);                     // result = 0
+
+    TTI_SFPEXEXP(p_sfpu::LREG0, p_sfpu::LREG2, 0xA);           // exp = in.Exp, cc = exp >= 0 (set cc on the exponent sign, inverted)
+    TTI_SFPLOADI(p_sfpu::LREG1, 0x8, 0x7FFF);                  // result = INT_MAX, upper 16 bits
+    TTI_SFPLOADI(p_sfpu::LREG1, 0xA, 0xFFFF);                  // result = INT_MAX, lower 16 bits
+    TTI_SFPIADD(0xFE1, p_sfpu::LREG2, p_sfpu::LREG2, 1);       // exp -= 31 (0xFE1 = -31), cc = exp < 31
+    TTI_SFPIADD(8, p_sfpu::LREG2, p_sfpu::LREG2, 5);           // exp += 8, cc unchanged
+    TTI_SFPEXMAN(p_sfpu::LREG0, p_sfpu::LREG1, 0);             // result = mantissa with the hidden bit
+    TTI_SFPSHFT(0, p_sfpu::LREG2, p_sfpu::LREG1, 0);           // result <<= exp - 23
+    TTI_SFPENCC(0, 0);                                         // clear cc result reg
+
+    TTI_SFPSETCC(0, p_sfpu::LREG0, 0);                 // where the input is negative
+    TTI_SFPSETCC(0, p_sfpu::LREG1, 2);                 // and the result is not zero, -0 is not a valid int32
+    TTI_SFPSETSGN(1, p_sfpu::LREG1, p_sfpu::LREG1, 1); // set the sign bit
+    TTI_SFPENCC(0, 0);                                 // clear cc result reg
+
+    TTI_SFPSTORE(p_sfpu::LREG1, p_sfpu::sfpmem::INT32, ADDR_MOD_7, 0, 0); // Store from lreg[1] into dest register
+}
+
+inline void _calculate_typecast_fp32_to_int32_(const int iterations)
+{
+    TTI_SFPENCC(1, 2); // enable cc
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _calculate_typecast_fp32_to_int32_rows();
+        ckernel::math::_incr_counters_<0x0, 0x0, ckernel::math::SFP_ROWS, 0x0>(); // does the dest_reg++ (increments by 2 rows)
+    }
+    TTI_SFPENCC(0, 2); // disable cc
+}
+
+} // namespace sfpu
+} // namespace ckernel
@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "ckernel_trisc_common.h"
+#include "cmath_common.h"
+
+namespace ckernel
+{
+namespace sfpu
+{
+// Calculates Typecast for number of rows of output SFPU ops (Quasar = 2 rows)
+// Negative values clamp to 0 and values above 65535 saturate
+inline void _calculate_typecast_int32_to_uint16_rows()
+{
+    TTI_SFPLOAD(p_sfpu::LREG0, p_sfpu::sfpmem::INT32, ADDR_MOD_7, 0, 0); // load from dest into lreg[0], uses ADDR_MOD_7 (set to all zeroes)
+
+    TTI_SFPCAST(p_sfpu::LREG0, p_sfpu::LREG0, 0);   // convert from int32 sign+mag to fp32 using rnd nearest even
+    TTI_SFPSETCC(0, p_sfpu::LREG0, 0);              // where lreg[0] is negative
+    TTI_SFPMOV(p_sfpu::LCONST_0, p_sfpu::LREG0, 0); // lreg[0] = 0
+    TTI_SFPENCC(0, 0);                              // clear cc result reg
+
+    TTI_SFP_STOCH_RND(p_sfpu::sfp_stochrnd_rnd_mod::NearEven, 0, 0, p_sfpu::LREG0, p_sfpu::LREG1, (1 << 3) | ckernel::p_sfpu::sfp_stochrnd_mod::FP32_TO_UINT16);
+
+    TTI_SFPSTORE(p_sfpu::LREG1, p_sfpu::sfpmem::UINT16, ADDR_MOD_7, 0, 0); // Store from lreg[1] into dest register
+}
+
+inline void _calculate_typecast_int32_to_uint16_(const int iterations)
+{
+    TTI_SFPENCC(1, 2); // enable cc
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _calculate_typecast_int32_to_uint16_rows();
+        ckernel::math::_incr_counters_<0x0, 0x0, ckernel::math::SFP_ROWS, 0x0>(); // does the dest_reg++ (increments by 2 rows)
+    }
+    TTI_SFPENCC(0, 2); // disable cc
+}
+
+} // namespace sfpu
+} // namespace ckernel
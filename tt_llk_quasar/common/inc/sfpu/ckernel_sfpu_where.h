@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel_ops.h"
+#include "ckernel_trisc_common.h"
+#include "cmath_common.h"
+
+namespace ckernel
+{
+namespace sfpu
+{
+// Calculates WHERE (out = cond != 0 ? true_val : false_val) for number of rows of output SFPU ops (Quasar = 2 rows)
+// SFPMEM_TYPE selects how the operands are loaded, e.g. p_sfpu::sfpmem::FP32 or p_sfpu::sfpmem::INT32
+template <std::uint32_t SFPMEM_TYPE>
+inline void _calculate_where_sfp_rows_(
+    const std::uint32_t dst_index_cond, const std::uint32_t dst_index_true, const std::uint32_t dst_index_false, const std::uint32_t dst_index_out)
+{
+    // size of each tile in Dest is 64 rows
+    constexpr std::uint32_t dst_tile_size = 64;
+
+    TT_SFPLOAD(p_sfpu::LREG0, SFPMEM_TYPE, ADDR_MOD_7, 0, dst_index_cond * dst_tile_size);  // load the condition into lreg[0]
+    TT_SFPLOAD(p_sfpu::LREG1, SFPMEM_TYPE, ADDR_MOD_7, 0, dst_index_true * dst_tile_size);  // load the true values into lreg[1]
+    TTI_SFPSETCC(0, p_sfpu::LREG0, 6);                                                      // where the condition is zero
+    TT_SFPLOAD(p_sfpu::LREG1, SFPMEM_TYPE, ADDR_MOD_7, 0, dst_index_false * dst_tile_size); // overwrite with the false values
+    TTI_SFPENCC(0, 0);                                                                      // clear cc result reg
+    TT_SFPSTORE(p_sfpu::LREG1, SFPMEM_TYPE, ADDR_MOD_7, 0, dst_index_out * dst_tile_size);  // store from lreg[1] into dest register
+}
+
+// Tile indices are relative to the tile selected by _llk_math_eltwise_unary_sfpu_start_
+template <std::uint32_t SFPMEM_TYPE = p_sfpu::sfpmem::DEFAULT>
+inline void _calculate_where_(
+    const int iterations,
+    const std::uint32_t dst_index_cond,
+    const std::uint32_t dst_index_true,
+    const std::uint32_t dst_index_false,
+    const std::uint32_t dst_index_out)
+{
+    TTI_SFPENCC(1, 2); // enable cc
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _calculate_where_sfp_rows_<SFPMEM_TYPE>(dst_index_cond, dst_index_true, dst_index_false, dst_index_out);
+        ckernel::math::_incr_counters_<0x0, 0x0, ckernel::math::SFP_ROWS, 0x0>(); // does the dest_reg++ (increments by 2 rows)
+    }
+    TTI_SFPENCC(0, 2); // disable cc
+}
+
+} // namespace sfpu
+} // namespace ckernel
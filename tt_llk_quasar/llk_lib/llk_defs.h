@@ -69,7 +69,25 @@ enum class SfpuType : std::uint32_t
     add,
     square,
     sigmoid,
-    silu
+    silu,
+    log,
+    abs,
+    neg,
+    fill,
+    equal_zero,
+    not_equal_zero,
+    less_than_zero,
+    greater_than_equal_zero,
+    less_than_equal_zero,
+    greater_than_zero,
+    where,
+    bitwise_and,
+    bitwise_or,
+    bitwise_xor,
+    dropout,
+    quant_int32,
+    requant_int32,
+    dequant_int32
 };
 
 enum class DstSync : std::uint8_t
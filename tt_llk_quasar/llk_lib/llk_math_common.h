@@ -167,3 +167,40 @@ inline void _llk_math_dest_section_done_()
         _set_dest_section_base_<TRISC_ID>(base_addr);
     }
 }
+
+/**
+ * The following functions extend the Math <-> Pack semaphore synchronization with the SFPU trisc
+ * sitting between math and pack, so FPU work on one dest section overlaps SFPU work on the other:
+ *     math: _llk_math_wait_for_dest_available_ -> FPU ops -> _llk_math_dest_section_done_to_sfpu_
+ *     sfpu: _llk_math_sfpu_wait_for_dest_section_ -> SFPU ops -> _llk_math_sfpu_dest_section_done_
+ *     pack: _llk_packer_wait_for_sfpu_done_ -> pack -> _llk_pack_sfpu_dest_semaphore_section_done_
+ * MATH_PACK still counts the dest sections in flight, so math only waits on pack freeing a section.
+ */
+template <DstSync DST>
+inline void _llk_math_sfpu_pack_sync_init_()
+{
+    _llk_math_pack_sync_init_<DST>();
+
+    constexpr std::uint32_t num_sem = (DST == DstSync::SyncFull) ? 1 : 2;
+    TTI_SEMINIT(num_sem, 0, 0, semaphore::t6_sem(semaphore::MATH_SFPU));
+    TTI_SEMINIT(num_sem, 0, 0, semaphore::t6_sem(semaphore::SFPU_PACK));
+}
+
+/**
+ * @brief Hands the current dest section over to the SFPU trisc instead of pack, then moves math to the next section
+ * @tparam DST: Destination register buffering mode, values = [DstSync::SyncHalf, DstSync::SyncFull]
+ * @tparam EN_32BIT_DEST: flag to show if math destination register is set to 32bit mode
+ */
+template <DstSync DST, bool EN_32BIT_DEST>
+inline void _llk_math_dest_section_done_to_sfpu_()
+{
+    t6_semaphore_post<p_stall::MATH>(semaphore::MATH_PACK);
+    t6_semaphore_post(semaphore::MATH_SFPU);
+    if constexpr (DST == DstSync::SyncHalf)
+    {
+        _update_dest_register_offset_<EN_32BIT_DEST>();
+        std::uint32_t base_addr = _get_dest_buffer_base_();
+        TTI_STALLWAIT(p_stall::STALL_CFG, 0, 0, p_stall::MATH);
+        _set_dest_section_base_<TRISC_ID>(base_addr);
+    }
+}
@@ -100,6 +100,44 @@ inline void _llk_math_eltwise_unary_sfpu_params_(F&& sfpu_func, std::uint32_t ds
     _llk_math_eltwise_unary_sfpu_done_();
 }
 
+/**
+ * The following functions are used when SFPU ops run on the SFPU trisc between math and pack,
+ * see _llk_math_sfpu_pack_sync_init_ for the math side of the protocol
+ */
+
+/**
+ * @brief Starts the SFPU trisc on dest section 0, must be paired with _llk_math_sfpu_pack_sync_init_ on math
+ */
+inline void _llk_math_sfpu_sync_init_()
+{
+    ckernel::trisc::_reset_dest_register_offset_();
+}
+
+/**
+ * @brief Stalls SFPU instructions until math has handed over a dest section
+ */
+inline void _llk_math_sfpu_wait_for_dest_section_()
+{
+    TTI_SEMWAIT(p_stall::STALL_SFPU | p_stall::STALL_SYNC, p_stall::STALL_ON_ZERO, 0, ckernel::trisc::semaphore::t6_sem(ckernel::trisc::semaphore::MATH_SFPU));
+}
+
+/**
+ * @brief Hands the current dest section over to pack once the SFPU is done with it, then moves to the next section
+ * @tparam DST: Destination register buffering mode, values = [DstSync::SyncHalf, DstSync::SyncFull]
+ * @tparam EN_32BIT_DEST: flag to show if math destination register is set to 32bit mode
+ */
+template <DstSync DST, bool EN_32BIT_DEST>
+inline void _llk_math_sfpu_dest_section_done_()
+{
+    ckernel::trisc::t6_semaphore_get<p_stall::WAIT_SFPU>(ckernel::trisc::semaphore::MATH_SFPU);
+    ckernel::trisc::t6_semaphore_post<p_stall::WAIT_SFPU>(ckernel::trisc::semaphore::SFPU_PACK);
+    if constexpr (DST == DstSync::SyncHalf)
+    {
+        // Tile addresses are rebased on the section offset in _llk_math_eltwise_unary_sfpu_start_
+        ckernel::trisc::_update_dest_register_offset_<EN_32BIT_DEST>();
+    }
+}
+
 /**
  * @brief Determines the stochround conversion type based on source and cast data formats
  */
@@ -266,7 +266,10 @@ inline void _llk_math_matmul_di_mop_config_(std::uint8_t ct_dim, std::uint8_t rt
  * For DstSync::SyncFull: ct_dim * rt_dim <= 16 tiles in Float16b, ct_dim * rt_dim <= 8 tiles in Float32
  * @tparam MATH_FIDELITY: 0 = LoFi, 2 = HiFi2, 3 = HiFi3, 4 = HiFi4 - controls precision of multiplication when math is Float32 format
  * @tparam EN_DI: Enable direct indexing matrix multiplication
- * @tparam EN_X2: Enable matrix multiplication with MXFP_2X mode, double the performance
+ * MX operands: the unpacker expands MX data to Float16_b (or 2x-packed MxFp4 with EN_X2), configure math with
+ * implied math format so the ALU picks up the source register formats, and enable fp32 dest to accumulate over kt_dim
+ * @tparam EN_X2: Enable matrix multiplication with MXFP_2X mode, double the performance,
+ * both operands must be unpacked as MxFp4_2x_B, see _llk_unpack_matmul_src_reg_format_
  * @param ct_dim: number of tiles in the column dimension for a matrix multiply
  * @param rt_dim: number of tiles in the row dimension for a matrix multiply
  */
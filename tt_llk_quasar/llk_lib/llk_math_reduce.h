@@ -25,6 +25,93 @@ void tti_pool_instr_func()
     }
 }
 
+// Integer scalar reduce pools all faces into this dest row, and the SFPU pools its transposed copy in column 0 of
+// the dest rows starting at REDUCE_INT_SCALAR_COL_ROW
+constexpr std::uint32_t REDUCE_INT_SCALAR_POOL_ROW = 16;
+constexpr std::uint32_t REDUCE_INT_SCALAR_COL_ROW  = 32;
+
+/**
+ * @brief Moves one 16 bit half of the int32 dest row POOL_ROW through srcB and writes it transposed into column 0 of
+ * dest rows [DST_ROW, DST_ROW + 16). Int32 dest datums do not fit srcB, so each is moved as its hi and lo half.
+ * SrcB rows [32, 48) are used, the scaler in rows [0, 16) is kept.
+ * @tparam DEST_32B_LO: 0 moves the hi 16 bits of the datums, 1 the lo 16 bits
+ * @tparam KEEP_POOLED_ROW: Also moves the row untransposed into srcB row 32, so with DST_ROW == POOL_ROW the pooled
+ * row stays in place for accumulating more tiles
+ */
+template <std::uint32_t DEST_32B_LO, std::uint32_t POOL_ROW, std::uint32_t DST_ROW, bool KEEP_POOLED_ROW>
+inline void reduce_int_transpose_row_half()
+{
+    // Src B can only transpose rows [16-31], and output them at [32-47]
+    TTI_MOVD2B(DEST_32B_LO, p_movd2b::SRC_ROW32_OFFSET, ADDR_MOD_0, p_movd2b::MOV_1_ROW, 1, POOL_ROW);
+    if constexpr (KEEP_POOLED_ROW)
+    {
+        TTI_MOVD2B(DEST_32B_LO, p_movd2b::SRC_ROW32_OFFSET, ADDR_MOD_0, p_movd2b::MOV_1_ROW, 0, POOL_ROW);
+    }
+    TTI_MOVB2D(DEST_32B_LO, p_mov_src_to_dest::SRC_ROW32_OFFSET, ADDR_MOD_0, p_mov_src_to_dest::MOV_8_ROWS, 0, DST_ROW);
+    TTI_MOVB2D(DEST_32B_LO, p_mov_src_to_dest::SRC_ROW32_OFFSET + 8, ADDR_MOD_0, p_mov_src_to_dest::MOV_8_ROWS, 0, DST_ROW + 8);
+}
+
+/**
+ * @brief Pools lreg[1] into lreg[0] for the integer scalar reduce, both hold int32 in 2's complement
+ * @tparam POOL_TYPE: Type of reduce pool op, values = [MAX, SUM]
+ */
+template <PoolType POOL_TYPE>
+inline void reduce_int_pool_lregs()
+{
+    if constexpr (POOL_TYPE == PoolType::MAX)
+    {
+        TTI_SFPMOV(p_sfpu::LREG1, p_sfpu::LREG2, 0);     // lreg[2] = lreg[1]
+        TTI_SFPIADD(0, p_sfpu::LREG0, p_sfpu::LREG2, 2); // lreg[2] = lreg[0] - lreg[1], where lreg[0] < lreg[1]
+        TTI_SFPMOV(p_sfpu::LREG1, p_sfpu::LREG0, 0);     // lreg[0] = lreg[1]
+        TTI_SFPENCC(0, 0);                               // clear cc result reg
+    }
+    else
+    {
+        TTI_SFPIADD(0, p_sfpu::LREG1, p_sfpu::LREG0, 4); // lreg[0] += lreg[1]
+    }
+}
+
+/**
+ * @brief Second pool of the integer scalar reduce, done by SFPU in int32 since the pooled int32 datums can not be FPU
+ * operands. Pools column 0 of dest rows [REDUCE_INT_SCALAR_COL_ROW, + 16), the transposed pooled row, into datum 0 of
+ * the tile. SFPU lanes hold the same column of two adjacent dest rows, so the even and odd rows are pooled separately
+ * first, then the odd result is moved down one row through srcB and pooled with the even one.
+ * @tparam POOL_TYPE: Type of reduce pool op, values = [MAX, SUM]
+ */
+template <PoolType POOL_TYPE>
+inline void reduce_int_scalar_sfpu_pool()
+{
+    constexpr std::uint32_t col_row = REDUCE_INT_SCALAR_COL_ROW;
+
+    TTI_STALLWAIT(p_stall::STALL_SFPU, 0, 0, p_stall::MATH);
+    TTI_SFPENCC(1, 2); // enable cc
+    TTI_SFPLOAD(p_sfpu::LREG0, p_sfpu::sfpmem::INT32_COMP, ADDR_MOD_7, 0, col_row);
+#pragma GCC unroll 7
+    for (std::uint32_t row = col_row + SFP_ROWS; row < col_row + FACE_R_DIM; row += SFP_ROWS)
+    {
+        TT_SFPLOAD(p_sfpu::LREG1, p_sfpu::sfpmem::INT32_COMP, ADDR_MOD_7, 0, row);
+        reduce_int_pool_lregs<POOL_TYPE>();
+    }
+    // Even rows pooled into dest row col_row, odd rows into col_row + 1
+    TTI_SFPSTORE(p_sfpu::LREG0, p_sfpu::sfpmem::INT32_COMP, ADDR_MOD_7, 0, col_row);
+
+    TTI_STALLWAIT(p_stall::STALL_MATH, 0, 0, p_stall::WAIT_SFPU);
+    TTI_MOVD2B(0, p_movd2b::SRC_ROW32_OFFSET, ADDR_MOD_0, p_movd2b::MOV_1_ROW, 0, col_row + 1);
+    TTI_MOVB2D(0, p_mov_src_to_dest::SRC_ROW32_OFFSET, ADDR_MOD_0, p_mov_src_to_dest::MOV_1_ROW, 0, col_row + 2);
+    TTI_MOVD2B(1, p_movd2b::SRC_ROW32_OFFSET, ADDR_MOD_0, p_movd2b::MOV_1_ROW, 0, col_row + 1);
+    TTI_MOVB2D(1, p_mov_src_to_dest::SRC_ROW32_OFFSET, ADDR_MOD_0, p_mov_src_to_dest::MOV_1_ROW, 0, col_row + 2);
+
+    TTI_STALLWAIT(p_stall::STALL_SFPU, 0, 0, p_stall::MATH);
+    TTI_SFPLOAD(p_sfpu::LREG1, p_sfpu::sfpmem::INT32_COMP, ADDR_MOD_7, 0, col_row + 2);
+    reduce_int_pool_lregs<POOL_TYPE>();
+    // Pool into datum 0 so tiles reduced into the same dest tile accumulate, the same as the FPU pools
+    TTI_SFPLOAD(p_sfpu::LREG1, p_sfpu::sfpmem::INT32_COMP, ADDR_MOD_7, 0, 0);
+    reduce_int_pool_lregs<POOL_TYPE>();
+    TTI_SFPSTORE(p_sfpu::LREG0, p_sfpu::sfpmem::INT32_COMP, ADDR_MOD_7, 0, 0);
+    TTI_SFPENCC(0, 2); // disable cc
+    TTI_STALLWAIT(p_stall::STALL_MATH, 0, 0, p_stall::WAIT_SFPU);
+}
+
 /**
  * @brief Sets up mop config for reduce column operations
  *For reduce Col, in a 32 x 32 tile, faces layout would be the following:
@@ -97,15 +184,72 @@ inline void _llk_math_reduce_col_mop_config_(const TensorShape& tensor_shape)
  * @tparam POOL_TYPE: Type of reduce pool op, values = [MAX, SUM, AVG]
  * @tparam MATH_FIDELITY_TYPE: Only works for AVG/SUM pool types, shows how many loops
  * to use full precision with of Source register datums with multiplies, values = [LoFi, HiFi2, HiFi3, HiFi4]
+ * @tparam EN_INT32_MATH_FORMAT: Int32 dest, the pooled rows are moved through srcB in 16 bit halves for the transpose
  * @param tensor_shape: Contains all the information of the tile shape: num faces, face row/col dim, etc
  */
-template <PoolType POOL_TYPE, ckernel::MathFidelity MATH_FIDELITY_TYPE>
+template <PoolType POOL_TYPE, ckernel::MathFidelity MATH_FIDELITY_TYPE, bool EN_INT32_MATH_FORMAT>
 inline void _llk_math_reduce_row_mop_config_(const TensorShape& tensor_shape)
 {
     constexpr bool RUN_FID_LOOPS = (MATH_FIDELITY_TYPE != ckernel::MathFidelity::LoFi && (POOL_TYPE == PoolType::AVG || POOL_TYPE == PoolType::SUM));
     constexpr std::uint32_t NUM_FIDELITY_PHASES = MATH_FIDELITY_TYPE == ckernel::MathFidelity::LoFi ? 0 : to_underlying(MATH_FIDELITY_TYPE) - 1;
     constexpr std::uint32_t MOP_OUTER_LOOP      = 1;
     constexpr std::uint32_t MOP_INNER_LOOP      = 1;
+
+    if constexpr (EN_INT32_MATH_FORMAT)
+    {
+        // Moving the halves does not fit both face rows in the replay buf, so it holds one face row and the MOP runs it
+        // for each, with dest at 0 and then 32
+        constexpr std::uint32_t int_replay_buf_len = 12 + (RUN_FID_LOOPS ? (2 * NUM_FIDELITY_PHASES) : 0);
+
+        load_replay_buf(
+            0,
+            int_replay_buf_len,
+            false,
+            0,
+            0,
+            []
+            {
+                // Each face is transposed in the unpacker, and then the faces of the face row are pooled together
+                if constexpr (RUN_FID_LOOPS)
+                {
+                    for (std::uint32_t fid_phase_idx = 0; fid_phase_idx < NUM_FIDELITY_PHASES; fid_phase_idx++)
+                    {
+                        tti_pool_instr_func<POOL_TYPE, p_gpool::CLR_NONE, p_gpool::DIM_16X16, ADDR_MOD_2, p_gpool::INDEX_DIS, 0>();
+                    }
+                }
+                tti_pool_instr_func<POOL_TYPE, p_gpool::CLR_SRCA_VLD, p_gpool::DIM_16X16, ADDR_MOD_0, p_gpool::INDEX_DIS, 0>();
+
+                if constexpr (RUN_FID_LOOPS)
+                {
+                    for (std::uint32_t fid_phase_idx = 0; fid_phase_idx < NUM_FIDELITY_PHASES; fid_phase_idx++)
+                    {
+                        tti_pool_instr_func<POOL_TYPE, p_gpool::CLR_NONE, p_gpool::DIM_16X16, ADDR_MOD_2, p_gpool::INDEX_DIS, 0>();
+                    }
+                }
+                tti_pool_instr_func<POOL_TYPE, p_gpool::CLR_NONE, p_gpool::DIM_16X16, ADDR_MOD_0, p_gpool::INDEX_DIS, 0>();
+
+                // This will clear AB counters to 0
+                TTI_SETRWC(p_setrwc::CLR_NONE, p_setrwc::CR_D, 0, p_setrwc::SET_AB);
+
+                // Transpose the pooled row into dest rows [0 - 16], hi 16 bits first
+                reduce_int_transpose_row_half<0, 0, 0, true>();
+                reduce_int_transpose_row_half<1, 0, 0, true>();
+
+                TTI_SETRWC(p_setrwc::CLR_A, 0, 0, p_setrwc::SET_B);
+            });
+
+        ckernel_template temp(
+            MOP_OUTER_LOOP,
+            tensor_shape.num_faces_r_dim,
+            TT_OP_REPLAY(0, int_replay_buf_len, 0, 0, 0, 0),
+            TT_OP_SETRWC(p_setrwc::CLR_NONE, p_setrwc::CR_D, 32, p_setrwc::SET_D));
+        // Dest counter is reset by _llk_math_reduce_ after the last face row
+        temp.set_last_outer_loop_instr(TT_OP_NOP);
+
+        temp.program_bank0_sw_cntl(instrn_buffer);
+        return;
+    }
+
     // Replay buf max len is 32, NUM_FIDELITY_PHASES will be larger than 3, hypothetical limit of 19 + 12 = 31
     constexpr std::uint32_t replay_buf_len = 19 + (RUN_FID_LOOPS ? (4 * NUM_FIDELITY_PHASES) : 0);
 
@@ -212,15 +356,57 @@ inline void _llk_math_reduce_row_mop_config_(const TensorShape& tensor_shape)
  * @tparam POOL_TYPE: Type of reduce pool op, values = [MAX, SUM, AVG]
  * @tparam MATH_FIDELITY_TYPE: Only works for AVG/SUM pool types, shows how many loops
  * to use full precision with of Source register datums with multiplies, values = [LoFi, HiFi2, HiFi3, HiFi4]
+ * @tparam EN_INT32_MATH_FORMAT: Int32 dest, the pooled row is transposed in 16 bit halves and the second pool is done
+ * by reduce_int_scalar_sfpu_pool
  * @param tensor_shape: Contains all the information of the tile shape: num faces, face row/col dim, etc
  */
-template <PoolType POOL_TYPE, ckernel::MathFidelity MATH_FIDELITY_TYPE>
+template <PoolType POOL_TYPE, ckernel::MathFidelity MATH_FIDELITY_TYPE, bool EN_INT32_MATH_FORMAT>
 inline void _llk_math_reduce_scalar_mop_config_(const TensorShape& tensor_shape)
 {
     constexpr std::uint32_t MOP_OUTER_LOOP      = 1;
     constexpr std::uint32_t MOP_INNER_LOOP      = 1;
     constexpr std::uint32_t NUM_FIDELITY_PHASES = MATH_FIDELITY_TYPE == ckernel::MathFidelity::LoFi ? 0 : to_underlying(MATH_FIDELITY_TYPE) - 1;
     constexpr bool RUN_FID_LOOPS = (MATH_FIDELITY_TYPE != ckernel::MathFidelity::LoFi && (POOL_TYPE == PoolType::AVG || POOL_TYPE == PoolType::SUM));
+
+    if constexpr (EN_INT32_MATH_FORMAT)
+    {
+        const std::uint32_t int_replay_buf_len = 7 + tensor_shape.total_num_faces() * (1 + (RUN_FID_LOOPS ? NUM_FIDELITY_PHASES : 0));
+
+        load_replay_buf(
+            0,
+            int_replay_buf_len,
+            false,
+            0,
+            0,
+            [tensor_shape]
+            {
+                // Pool all faces together, this will generate 1x16 row of int32 results at dst index REDUCE_INT_SCALAR_POOL_ROW
+                // srcA is released after every face, the second pool does not go through it
+                for (std::uint32_t face = 0; face < static_cast<std::uint32_t>(tensor_shape.total_num_faces()); face++)
+                {
+                    if constexpr (RUN_FID_LOOPS)
+                    {
+                        for (std::uint32_t fid_phase_idx = 0; fid_phase_idx < NUM_FIDELITY_PHASES; fid_phase_idx++)
+                        {
+                            tti_pool_instr_func<POOL_TYPE, p_gpool::CLR_NONE, p_gpool::DIM_16X16, ADDR_MOD_2, p_gpool::INDEX_DIS, REDUCE_INT_SCALAR_POOL_ROW>();
+                        }
+                    }
+                    tti_pool_instr_func<POOL_TYPE, p_gpool::CLR_SRCA_VLD, p_gpool::DIM_16X16, ADDR_MOD_0, p_gpool::INDEX_DIS, REDUCE_INT_SCALAR_POOL_ROW>();
+                }
+
+                // Transpose the pooled row into column 0 of the dest rows the SFPU pools, hi 16 bits first
+                reduce_int_transpose_row_half<0, REDUCE_INT_SCALAR_POOL_ROW, REDUCE_INT_SCALAR_COL_ROW, false>();
+                reduce_int_transpose_row_half<1, REDUCE_INT_SCALAR_POOL_ROW, REDUCE_INT_SCALAR_COL_ROW, false>();
+
+                // zero out scratch in dest
+                TTI_ZEROACC(p_zeroacc::CLR_SPECIFIC, 0, 0, ADDR_MOD_0, REDUCE_INT_SCALAR_POOL_ROW);
+            });
+
+        ckernel_template temp(MOP_OUTER_LOOP, MOP_INNER_LOOP, TT_OP_REPLAY(0, int_replay_buf_len, 0, 0, 0, 0));
+
+        temp.program_bank0_sw_cntl(instrn_buffer);
+        return;
+    }
     const std::uint32_t replay_buf_len =
         6 + tensor_shape.total_num_faces() - 1 + (RUN_FID_LOOPS ? ((tensor_shape.total_num_faces() - 1) * NUM_FIDELITY_PHASES) + (2 * NUM_FIDELITY_PHASES) : 0);
 
@@ -293,8 +479,9 @@ inline void _llk_math_reduce_scalar_mop_config_(const TensorShape& tensor_shape)
  * @tparam REDUCE_DIMENSION: Sets the reduce dimension, values = [REDUCE_ROW, REDUCE_COL, REDUCE_SCALAR]
  * @tparam MATH_FIDELITY_TYPE: Only works for AVG/SUM pool types, shows how many loops
  * to use full precision with of Source register datums with multiplies, values = [LoFi, HiFi2, HiFi3, HiFi4]
+ * @tparam EN_INT32_MATH_FORMAT: Integer scalar reduce also needs the SFPU addrmod
  */
-template <ReduceDim REDUCE_DIMENSION, ckernel::MathFidelity MATH_FIDELITY_TYPE>
+template <ReduceDim REDUCE_DIMENSION, ckernel::MathFidelity MATH_FIDELITY_TYPE, bool EN_INT32_MATH_FORMAT>
 inline void _llk_math_reduce_addrmod_()
 {
     constexpr bool high_fidelity               = MATH_FIDELITY_TYPE != ckernel::MathFidelity::LoFi;
@@ -319,6 +506,17 @@ inline void _llk_math_reduce_addrmod_()
         }
             .set(ADDR_MOD_1);
     }
+
+    if constexpr (EN_INT32_MATH_FORMAT && REDUCE_DIMENSION == ReduceDim::REDUCE_SCALAR)
+    {
+        // SFPU loads and stores of reduce_int_scalar_sfpu_pool address dest rows directly
+        addr_mod_t {
+            .srca = {.incr = 0},
+            .srcb = {.incr = 0},
+            .dest = {.incr = 0},
+        }
+            .set(ADDR_MOD_7, csr_read<CSR::TRISC_ID>());
+    }
 }
 
 /**
@@ -327,13 +525,17 @@ inline void _llk_math_reduce_addrmod_()
  * @tparam REDUCE_DIMENSION: Sets the reduce dimension, values = [REDUCE_ROW, REDUCE_COL, REDUCE_SCALAR]
  * @tparam MATH_FIDELITY_TYPE: Only works for AVG/SUM pool types, shows how many loops
  * to use full precision with of Source register datums with multiplies, values = [LoFi, HiFi2, HiFi3, HiFi4]
+ * @tparam EN_INT32_MATH_FORMAT: Int8 operands pooled into Int32 dest, has to match _llk_math_srcAB_hw_configure_.
+ * SUM and MAX are exact in int32 for every dim. SUM needs a scaler of 1 and MathFidelity::HiFi2 or higher so all bits
+ * of the int8 datums go through the multiplier. AVG is not supported, its scaler has no int8 representation.
  * @param tensor_shape: Contains all the information of the tile shape: num faces, face row/col dim, etc
  */
-template <PoolType POOL_TYPE, ReduceDim REDUCE_DIMENSION, ckernel::MathFidelity MATH_FIDELITY_TYPE>
+template <PoolType POOL_TYPE, ReduceDim REDUCE_DIMENSION, ckernel::MathFidelity MATH_FIDELITY_TYPE, bool EN_INT32_MATH_FORMAT = false>
 inline void _llk_math_reduce_init_(const TensorShape& tensor_shape)
 {
+    static_assert(!EN_INT32_MATH_FORMAT || POOL_TYPE != PoolType::AVG, "AVG pool is not supported for integer reduce");
     LLK_ASSERT(validate_tensor_shape_tile_dependent_ops_(tensor_shape), "Invalid tensor shape for tile-dependent op");
-    _llk_math_reduce_addrmod_<REDUCE_DIMENSION, MATH_FIDELITY_TYPE>();
+    _llk_math_reduce_addrmod_<REDUCE_DIMENSION, MATH_FIDELITY_TYPE, EN_INT32_MATH_FORMAT>();
 
     if constexpr (REDUCE_DIMENSION == ReduceDim::REDUCE_COL)
     {
@@ -341,11 +543,11 @@ inline void _llk_math_reduce_init_(const TensorShape& tensor_shape)
     }
     else if constexpr (REDUCE_DIMENSION == ReduceDim::REDUCE_ROW)
     {
-        _llk_math_reduce_row_mop_config_<POOL_TYPE, MATH_FIDELITY_TYPE>(tensor_shape);
+        _llk_math_reduce_row_mop_config_<POOL_TYPE, MATH_FIDELITY_TYPE, EN_INT32_MATH_FORMAT>(tensor_shape);
     }
     else if constexpr (REDUCE_DIMENSION == ReduceDim::REDUCE_SCALAR)
     {
-        _llk_math_reduce_scalar_mop_config_<POOL_TYPE, MATH_FIDELITY_TYPE>(tensor_shape);
+        _llk_math_reduce_scalar_mop_config_<POOL_TYPE, MATH_FIDELITY_TYPE, EN_INT32_MATH_FORMAT>(tensor_shape);
     }
 
     // Reset all counters
@@ -354,16 +556,23 @@ inline void _llk_math_reduce_init_(const TensorShape& tensor_shape)
 
 /**
  * @brief Perform a reduce operation
+ * @tparam POOL_TYPE, REDUCE_DIMENSION, EN_INT32_MATH_FORMAT: Same as passed to _llk_math_reduce_init_
  * @param tile_idx: Tile index into the destination register.
  * If dest reg in float16 mode -> values = [0 - 8] in double buffering mode, values = [0 - 16] in full mode
  * If dest reg in float32 mode -> values = [0 - 4] in double buffering mode, values = [0 - 8] in full mode
  */
+template <PoolType POOL_TYPE, ReduceDim REDUCE_DIMENSION, bool EN_INT32_MATH_FORMAT = false>
 inline void _llk_math_reduce_(const std::uint32_t tile_idx)
 {
     _set_dst_write_addr_<DstTileShape::Tile32x32>(tile_idx);
     // Run MOP
     ckernel::ckernel_template::run_bank0_sw_cntl(instrn_buffer);
 
+    if constexpr (EN_INT32_MATH_FORMAT && REDUCE_DIMENSION == ReduceDim::REDUCE_SCALAR)
+    {
+        reduce_int_scalar_sfpu_pool<POOL_TYPE>();
+    }
+
     // Since only 1 face of srcB is used for constant values,
     // can clear data valid after all operations are done
     TTI_SETRWC(p_setrwc::CLR_B, 0, 0, p_setrwc::SET_ABD_F);
@@ -279,3 +279,27 @@ inline void _llk_pack_dest_semaphore_section_done_()
         _set_packer_dest_registers_<PACK_SEL, DST>();
     }
 }
+
+/**
+ * The following functions are used instead of _llk_packer_wait_for_math_done_ and _llk_pack_dest_semaphore_section_done_
+ * when the SFPU trisc sits between math and pack, see _llk_math_sfpu_pack_sync_init_ for the whole protocol
+ */
+
+// wait until the SFPU trisc is done and has handed over something to pack
+inline void _llk_packer_wait_for_sfpu_done_()
+{
+    TTI_SEMWAIT(p_stall::STALL_TDMA, p_stall::STALL_ON_ZERO, 0, semaphore::t6_sem(semaphore::SFPU_PACK));
+}
+
+/**
+ * @brief Clear dest section after packer is done reading, signal to the SFPU trisc and math dest section is ready to use
+ * @tparam PACK_SEL: Sets which packer to configure. values = p_pacr::PACK0/PACK1
+ * @tparam DST: Destination register buffering mode, values = [DstSync::SyncHalf, DstSync::SyncFull]
+ * @tparam EN_32BIT_DEST: flag to show if math destination register is set to 32bit mode
+ */
+template <std::uint32_t PACK_SEL, DstSync DST, bool EN_32BIT_DEST>
+inline void _llk_pack_sfpu_dest_semaphore_section_done_()
+{
+    t6_semaphore_get<p_stall::PACK>(semaphore::SFPU_PACK);
+    _llk_pack_dest_semaphore_section_done_<PACK_SEL, DST, EN_32BIT_DEST>();
+}
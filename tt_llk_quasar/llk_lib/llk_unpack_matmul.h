@@ -10,6 +10,27 @@
 #include "llk_unpack_common.h"
 using namespace ckernel;
 
+/**
+ * @brief Returns the source register format a matrix multiply operand should be unpacked into
+ * MX operands (MxFp8R/P, MxFp6R/P, MxFp4, MxInt8/4/2) are stored in L1 with one E8M0 block exponent per 32 datums,
+ * the unpacker applies the block exponent and expands every datum to Float16_b.
+ * With EN_X2, MxFp4 operands are instead kept 2x-packed in the source registers (MxFp4_2x_B, 8-bit exponent)
+ * so the FPU processes two datums per lane, this must match EN_X2 of _llk_math_matmul_init_
+ * and both operands of the matmul need to be MxFp4.
+ * @tparam EN_X2: Keep MxFp4 operands 2x-packed in the source registers
+ * @param l1_format: Data format of the operand in L1
+ * @param reg_format: Source register format used for operands that are not MX
+ */
+template <bool EN_X2 = false>
+constexpr DataFormat _llk_unpack_matmul_src_reg_format_(const DataFormat l1_format, const DataFormat reg_format)
+{
+    if (!is_mx_format(l1_format))
+    {
+        return reg_format;
+    }
+    return (EN_X2 && l1_format == DataFormat::MxFp4) ? DataFormat::MxFp4_2x_B : DataFormat::Float16_b;
+}
+
 /**
  * @brief Initializes unpacker to unpack operand 0 (buf_desc_id_0) into SrcB
  * and unpacks operand 1 (buf_desc_id_1) into SrcA. Matrix multiply FPU operation does SrcB * SrcA.
@@ -256,4 +256,29 @@ enum class BinaryOp : std::uint8_t
     ADD_TOP_ROW   = 10
 };
 
+enum class NormType : std::uint8_t
+{
+    LayerNorm = 0,
+    RMSNorm   = 1,
+};
+
+enum class GatedActivation : std::uint8_t
+{
+    SwiGLU = 0,
+    GeGLU  = 1,
+};
+
+enum class Fp8Format : std::uint8_t
+{
+    E4M3 = 0,
+    E5M2 = 1,
+};
+
+enum class CumulativeOp : std::uint8_t
+{
+    Sum  = 0,
+    Prod = 1,
+    Max  = 2,
+};
+
 } // namespace ckernel
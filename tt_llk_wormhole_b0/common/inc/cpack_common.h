@@ -806,8 +806,9 @@ inline void program_packer_destination(std::uint32_t addr, bool restore = true)
     }
 }
 
-template <std::uint32_t block_ct_dim, std::uint32_t full_ct_dim, bool diagonal = false, std::uint32_t row_num_datums = TILE_C_DIM>
-inline void program_packer_untilized_destination(const std::uint32_t addr, const std::uint32_t pack_dst_format)
+// full_ct_dim is passed at runtime so the per-packer L1 row offsets can follow a row band of arbitrary width
+template <bool diagonal = false, std::uint32_t row_num_datums = TILE_C_DIM>
+inline void program_packer_untilized_destination_runtime(const std::uint32_t addr, const std::uint32_t pack_dst_format, const std::uint32_t full_ct_dim)
 {
     LLK_ASSERT(is_valid_L1_address(addr), "L1 address must be in valid L1 memory region");
 
@@ -862,6 +863,43 @@ inline void program_packer_untilized_destination(const std::uint32_t addr, const
     }
 }
 
+// Dense untilize splits the face_r_dim rows of the dense tiles evenly across the active packers
+// Each packer packs face_r_dim / num_packers rows of full_ct_dim * num_faces * FACE_C_DIM datums
+inline void program_packer_dense_untilized_destination(
+    const std::uint32_t addr, const std::uint32_t pack_dst_format, const std::uint32_t full_ct_dim, const std::uint32_t face_r_dim, const std::uint32_t num_faces)
+{
+    LLK_ASSERT(is_valid_L1_address(addr), "L1 address must be in valid L1 memory region");
+
+    const std::uint32_t num_packers = (face_r_dim < NUM_PACKERS) ? face_r_dim : NUM_PACKERS;
+    const std::uint32_t block_size  = SCALE_DATUM_SIZE(pack_dst_format, full_ct_dim * num_faces * FACE_C_DIM * (face_r_dim / num_packers));
+    constexpr std::uint32_t offset0 = 0;
+    const std::uint32_t offset1     = (1 * block_size) / 16;
+    const std::uint32_t offset2     = (2 * block_size) / 16;
+    const std::uint32_t offset3     = (3 * block_size) / 16;
+
+    TT_SETDMAREG(0, LOWER_HALFWORD(addr + offset0), 0, LO_16(p_gpr_pack::OUTPUT_ADDR + 0));
+    TT_SETDMAREG(0, UPPER_HALFWORD(addr + offset0), 0, HI_16(p_gpr_pack::OUTPUT_ADDR + 0));
+    TT_SETDMAREG(0, LOWER_HALFWORD(addr + offset1), 0, LO_16(p_gpr_pack::OUTPUT_ADDR + 1));
+    TT_SETDMAREG(0, UPPER_HALFWORD(addr + offset1), 0, HI_16(p_gpr_pack::OUTPUT_ADDR + 1));
+    TT_SETDMAREG(0, LOWER_HALFWORD(addr + offset2), 0, LO_16(p_gpr_pack::OUTPUT_ADDR + 2));
+    TT_SETDMAREG(0, UPPER_HALFWORD(addr + offset2), 0, HI_16(p_gpr_pack::OUTPUT_ADDR + 2));
+    TT_SETDMAREG(0, LOWER_HALFWORD(addr + offset3), 0, LO_16(p_gpr_pack::OUTPUT_ADDR + 3));
+    TT_SETDMAREG(0, UPPER_HALFWORD(addr + offset3), 0, HI_16(p_gpr_pack::OUTPUT_ADDR + 3));
+
+    TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC0_REG1_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR);
+    TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC0_REG8_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR + 1);
+    TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC1_REG1_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR + 2);
+    TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC1_REG8_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR + 3);
+
+    TTI_PACR(ADDR_MOD_2, 0, 0xf, 0, 0, 1, 0); // pack flush
+}
+
+template <std::uint32_t block_ct_dim, std::uint32_t full_ct_dim, bool diagonal = false, std::uint32_t row_num_datums = TILE_C_DIM>
+inline void program_packer_untilized_destination(const std::uint32_t addr, const std::uint32_t pack_dst_format)
+{
+    program_packer_untilized_destination_runtime<diagonal, row_num_datums>(addr, pack_dst_format, full_ct_dim);
+}
+
 inline void program_packer_dest_offset_registers(std::uint32_t dest_tile_offset)
 {
     TT_SETDMAREG(0, LOWER_HALFWORD(dest_tile_offset), 0, LO_16(p_gpr_pack::TEMP_TILE_OFFSET));
@@ -7,6 +7,8 @@
 #include <cstdint>
 
 #include "ckernel_ops.h"
+#include "ckernel_sfpu_converter.h"
+#include "ckernel_sfpu_threefry.h"
 #include "sfpi.h"
 
 namespace ckernel
@@ -58,6 +60,58 @@ inline void _calculate_dropout_(const int iterations, std::uint32_t probability,
     }
 }
 
+/**
+ * @brief Dropout with a reproducible mask: the keep/drop decision of every datum is derived from
+ *        (seed, stream, tile_index, datum position) with Threefry-2x32 instead of the SFPMOV LFSR, so backward can
+ *        regenerate the mask from the same arguments instead of reading it back from L1. No init is needed.
+ *
+ * @param iterations Number of dst rows to process, must be even
+ * @param probability Drop probability scaled to 0 - INT_MAX
+ * @param scale Binary representation of the float32 scale applied to kept samples
+ * @param seed First key word, shared by all tiles of the op
+ * @param tile_index Index of the tile within the op, the same on every core count and tile order
+ * @param datum_offset Datum counter of the first processed row, 0 for a whole tile; face f processed on its own
+ *        uses f * 256
+ * @param stream Second key word, separates independent masks drawn with the same seed
+ */
+template <bool APPROXIMATION_MODE, int ITERATIONS, std::uint32_t ROUNDS = THREEFRY_DEFAULT_ROUNDS>
+inline void _calculate_dropout_threefry_(
+    const int iterations,
+    const std::uint32_t probability,
+    const std::uint32_t scale,
+    const std::uint32_t seed,
+    const std::uint32_t tile_index,
+    const std::uint32_t datum_offset = 0,
+    const std::uint32_t stream       = 0)
+{
+    const ThreefryKeySchedule schedule = _threefry_key_schedule_(seed, stream);
+    const sfpi::vFloat scale_val       = Converter::as_float(scale);
+    const sfpi::vInt probability_val   = static_cast<int>(probability);
+
+#pragma GCC unroll 0
+    for (int d = 0; d < iterations; d += 2)
+    {
+        sfpi::vUInt bits[2];
+        _threefry_row_pair_bits_<ROUNDS>(datum_offset + static_cast<std::uint32_t>(d) * 32, tile_index, schedule, bits[0], bits[1]);
+
+#pragma GCC unroll 2
+        for (int row = 0; row < 2; row++)
+        {
+            // Clear the sign bit for a signed comparison with probability
+            sfpi::vInt rand    = sfpi::reinterpret<sfpi::vInt>(bits[row] >> 1);
+            sfpi::vFloat value = sfpi::dst_reg[row] * scale_val;
+            v_if (rand < probability_val)
+            {
+                value = sfpi::vConst0;
+            }
+            v_endif;
+            sfpi::dst_reg[row] = value;
+        }
+        sfpi::dst_reg++;
+        sfpi::dst_reg++;
+    }
+}
+
 inline void _init_dropout_(const std::uint32_t seed)
 {
     init_prng_seed(seed);
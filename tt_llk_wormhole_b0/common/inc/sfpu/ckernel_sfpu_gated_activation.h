@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel_defs.h"
+#include "ckernel_sfpu_gelu.h"
+#include "ckernel_sfpu_silu.h"
+#include "sfpi.h"
+
+namespace ckernel
+{
+namespace sfpu
+{
+
+// ============================================================================
+// Gated activations (SwiGLU, GeGLU)
+// ============================================================================
+// out = act(gate) * up, with act = silu for SwiGLU and gelu for GeGLU. Both halves are read from dest and the
+// activation stays in registers, so only the product is stored: the unfused unary activation followed by the
+// binary multiply stores the activation and loads it back for every datum.
+
+/**
+ * @brief Fused gated activation, out = act(gate) * up.
+ *
+ * @tparam APPROXIMATION_MODE GeGLU uses the gelu LUT programmed by _init_gated_activation_, otherwise the CDF
+ * approximation. Unused for SwiGLU.
+ * @param dst_index_gate Dest tile index of the gate operand, relative to the tile set by the SFPU start call
+ * @param dst_index_up Dest tile index of the up operand
+ * @param dst_index_out Dest tile index of the result, may be either operand
+ */
+template <bool APPROXIMATION_MODE, GatedActivation ACTIVATION, int ITERATIONS = 8>
+inline void _calculate_gated_activation_(const std::uint32_t dst_index_gate, const std::uint32_t dst_index_up, const std::uint32_t dst_index_out)
+{
+    // size of each tile in Dest is 64/SFP_DESTREG_STRIDE = 32 rows when using sfpi to load/store
+    constexpr std::uint32_t dst_tile_size_sfpi = 32;
+
+    if constexpr (ACTIVATION == GatedActivation::GeGLU && APPROXIMATION_MODE)
+    {
+        sfpi::vUInt l0 = sfpi::l_reg[sfpi::LRegs::LReg0];
+        sfpi::vUInt l1 = sfpi::l_reg[sfpi::LRegs::LReg1];
+        sfpi::vUInt l2 = sfpi::l_reg[sfpi::LRegs::LReg2];
+        sfpi::vUInt l4 = sfpi::l_reg[sfpi::LRegs::LReg4];
+        sfpi::vUInt l5 = sfpi::l_reg[sfpi::LRegs::LReg5];
+        sfpi::vUInt l6 = sfpi::l_reg[sfpi::LRegs::LReg6];
+
+#pragma GCC unroll 8
+        for (int d = 0; d < ITERATIONS; d++)
+        {
+            sfpi::vFloat gate = sfpi::dst_reg[dst_index_gate * dst_tile_size_sfpi];
+            sfpi::vFloat up   = sfpi::dst_reg[dst_index_up * dst_tile_size_sfpi];
+
+            // Same as _calculate_gelu_appx_
+            sfpi::vFloat half_gate = gate * sfpi::vConstFloatPrgm0;
+            sfpi::vFloat act       = half_gate + lut2_sign(gate, l0, l1, l2, l4, l5, l6);
+
+            sfpi::dst_reg[dst_index_out * dst_tile_size_sfpi] = act * up;
+            sfpi::dst_reg++;
+        }
+
+        sfpi::l_reg[sfpi::LRegs::LReg0] = l0;
+        sfpi::l_reg[sfpi::LRegs::LReg1] = l1;
+        sfpi::l_reg[sfpi::LRegs::LReg2] = l2;
+        sfpi::l_reg[sfpi::LRegs::LReg4] = l4;
+        sfpi::l_reg[sfpi::LRegs::LReg5] = l5;
+        sfpi::l_reg[sfpi::LRegs::LReg6] = l6;
+    }
+    else
+    {
+#pragma GCC unroll 8
+        for (int d = 0; d < ITERATIONS; d++)
+        {
+            sfpi::vFloat gate = sfpi::dst_reg[dst_index_gate * dst_tile_size_sfpi];
+            sfpi::vFloat up   = sfpi::dst_reg[dst_index_up * dst_tile_size_sfpi];
+
+            sfpi::vFloat act;
+            if constexpr (ACTIVATION == GatedActivation::SwiGLU)
+            {
+                act = _calculate_silu_body_(gate);
+            }
+            else
+            {
+                // Same as _calculate_gelu_accurate_
+                act = _calculate_cdf_appx_(gate, true);
+            }
+
+            sfpi::dst_reg[dst_index_out * dst_tile_size_sfpi] = act * up;
+            sfpi::dst_reg++;
+        }
+    }
+}
+
+template <bool APPROXIMATION_MODE, GatedActivation ACTIVATION>
+inline void _init_gated_activation_()
+{
+    if constexpr (ACTIVATION == GatedActivation::GeGLU)
+    {
+        _init_gelu_<APPROXIMATION_MODE>();
+    }
+}
+
+} // namespace sfpu
+} // namespace ckernel
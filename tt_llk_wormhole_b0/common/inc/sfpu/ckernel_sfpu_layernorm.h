@@ -0,0 +1,237 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "ckernel.h"
+#include "ckernel_defs.h"
+#include "ckernel_sfpu_sqrt.h"
+#include "ckernel_sfpu_welfords.h"
+#include "sfpi.h"
+
+namespace ckernel
+{
+namespace sfpu
+{
+
+// ============================================================================
+// Fused LayerNorm / RMSNorm
+// ============================================================================
+// Like the Welford's kernel, the normalization runs along the columns of the tiles in dst: every one of the 32 columns
+// is normalized independently over the rows of num_tiles tiles stacked one after another in dst (i.e. the activation
+// is expected to be transposed so that the normalized dimension runs down the columns).
+//
+// 1. The Welford's replay buffer program accumulates mean and M2 per column in LREG4 and LREG5.
+// 2. M2 is turned into the variance (LayerNorm) or the mean square (RMSNorm), epsilon is added and the reciprocal
+//    square root is taken, leaving the mean in LREG4 and 1/sqrt(var + eps) in LREG5.
+// 3. Every 4-row block is reloaded, normalized in place and, optionally, scaled by gamma and shifted by beta.
+//    Gamma and beta are full tiles in dst with the same layout as the input, normally unpacked with a column broadcast.
+
+// offset of consecutive 32x32 tiles in dst when addressed by SFPLOAD/SFPSTORE
+constexpr std::uint32_t NORM_DST_TILE_OFFSET = 64;
+// offsets of the 8 blocks of 4 rows x 32 columns within a tile, same order as _calculate_welfords_tile_
+constexpr std::uint32_t NORM_BLOCK_OFFSETS[8] = {0, 4, 8, 12, 32, 36, 40, 44};
+// offsets of the 4 registers of a block: left face even/odd columns, right face even/odd columns
+constexpr std::uint32_t NORM_BLOCK_LREG_OFFSETS[4] = {0, 2, 16, 18};
+
+/*
+ * @brief Loads a block of 4 rows and 32 columns at block_offset, transposed so that LREG0-3 each hold one row.
+ *
+ * Same as _welfords_load_block_, but the block offset is known at runtime so TT_SFPLOAD is used instead of TTI_SFPLOAD.
+ * The two transposes leave LREG4-7 unchanged.
+ */
+sfpi_inline void _norm_load_block_(const std::uint32_t block_offset)
+{
+    TTI_SFPTRANSP(0, 0, 0, 0);
+    TT_SFPLOAD(ckernel::p_sfpu::LREG0, sfpi::SFPLOAD_MOD0_FMT_SRCB, ckernel::ADDR_MOD_3, block_offset + NORM_BLOCK_LREG_OFFSETS[0]);
+    TT_SFPLOAD(ckernel::p_sfpu::LREG1, sfpi::SFPLOAD_MOD0_FMT_SRCB, ckernel::ADDR_MOD_3, block_offset + NORM_BLOCK_LREG_OFFSETS[1]);
+    TT_SFPLOAD(ckernel::p_sfpu::LREG2, sfpi::SFPLOAD_MOD0_FMT_SRCB, ckernel::ADDR_MOD_3, block_offset + NORM_BLOCK_LREG_OFFSETS[2]);
+    TT_SFPLOAD(ckernel::p_sfpu::LREG3, sfpi::SFPLOAD_MOD0_FMT_SRCB, ckernel::ADDR_MOD_3, block_offset + NORM_BLOCK_LREG_OFFSETS[3]);
+    TTI_SFPTRANSP(0, 0, 0, 0);
+}
+
+/*
+ * @brief Transposes the normalized block in LREG0-3 back and stores it to block_offset.
+ *
+ * The second transpose returns LREG4-7 (mean and 1/sqrt(var + eps)) to the layout used by _norm_load_block_.
+ */
+sfpi_inline void _norm_store_block_(const std::uint32_t block_offset)
+{
+    TTI_SFPTRANSP(0, 0, 0, 0);
+    TT_SFPSTORE(ckernel::p_sfpu::LREG0, sfpi::SFPSTORE_MOD0_FMT_SRCB, ckernel::ADDR_MOD_3, block_offset + NORM_BLOCK_LREG_OFFSETS[0]);
+    TT_SFPSTORE(ckernel::p_sfpu::LREG1, sfpi::SFPSTORE_MOD0_FMT_SRCB, ckernel::ADDR_MOD_3, block_offset + NORM_BLOCK_LREG_OFFSETS[1]);
+    TT_SFPSTORE(ckernel::p_sfpu::LREG2, sfpi::SFPSTORE_MOD0_FMT_SRCB, ckernel::ADDR_MOD_3, block_offset + NORM_BLOCK_LREG_OFFSETS[2]);
+    TT_SFPSTORE(ckernel::p_sfpu::LREG3, sfpi::SFPSTORE_MOD0_FMT_SRCB, ckernel::ADDR_MOD_3, block_offset + NORM_BLOCK_LREG_OFFSETS[3]);
+    TTI_SFPTRANSP(0, 0, 0, 0);
+}
+
+/*
+ * @brief Normalizes one row held in input_lreg: (x - mean) * rstd for LayerNorm, x * rstd for RMSNorm.
+ *
+ * - LREG4: Mean of the column
+ * - LREG5: 1/sqrt(var + eps) (LayerNorm) or 1/sqrt(mean(x^2) + eps) (RMSNorm) of the column
+ */
+template <NormType norm_type, std::uint32_t input_lreg>
+sfpi_inline void _norm_row_()
+{
+    if constexpr (norm_type == NormType::LayerNorm)
+    {
+        // input_lreg = -1 * LREG4 + input_lreg
+        TTI_SFPMAD(ckernel::p_sfpu::LREG11 /*-1*/, ckernel::p_sfpu::LREG4, input_lreg, input_lreg, 0);
+        TTI_SFPNOP; // Next cycle cannot read from input_lreg (2-cycle operation)
+    }
+    // input_lreg = input_lreg * LREG5 + 0
+    TTI_SFPMAD(input_lreg, ckernel::p_sfpu::LREG5, ckernel::p_sfpu::LCONST_0, input_lreg, 0);
+}
+
+/*
+ * @brief Accumulates mean and M2 of every column over num_tiles tiles in dst using the Welford's replay buffer program.
+ *
+ * @tparam reciprocal_size The size of the reciprocal lookup table, 0 computes the reciprocals at runtime.
+ * @param num_tiles Number of tiles stacked along the normalized dimension.
+ * @param reciprocal_lut The lookup table containing the reciprocals of the sample counts, needs 32 * num_tiles entries.
+ */
+template <std::size_t reciprocal_size>
+inline void _calculate_norm_welfords_(const std::uint32_t num_tiles, const std::array<std::uint32_t, reciprocal_size>& reciprocal_lut)
+{
+    _clear_previous_mean_and_m2_();
+
+    for (std::uint32_t tile = 0; tile < num_tiles; tile++)
+    {
+        for (std::uint32_t block = 0; block < 8; block++)
+        {
+            const std::uint32_t start_idx = tile * 32 + block * 4;
+
+            _norm_load_block_(tile * NORM_DST_TILE_OFFSET + NORM_BLOCK_OFFSETS[block]);
+
+            _load_recip_of_idx_<reciprocal_size>(start_idx, reciprocal_lut);
+            _execute_welfords_row_replay_buffer_<ckernel::p_sfpu::LREG0>();
+            _load_recip_of_idx_<reciprocal_size>(start_idx + 1, reciprocal_lut);
+            _execute_welfords_row_replay_buffer_<ckernel::p_sfpu::LREG1>();
+            _load_recip_of_idx_<reciprocal_size>(start_idx + 2, reciprocal_lut);
+            _execute_welfords_row_replay_buffer_<ckernel::p_sfpu::LREG2>();
+            _load_recip_of_idx_<reciprocal_size>(start_idx + 3, reciprocal_lut);
+            _execute_welfords_row_replay_buffer_<ckernel::p_sfpu::LREG3>();
+        }
+    }
+}
+
+/*
+ * @brief Turns the mean and M2 in LREG4 and LREG5 into the mean and the reciprocal standard deviation.
+ *
+ * @tparam norm_type LayerNorm uses the variance M2 / N, RMSNorm the mean square M2 / N + mean^2.
+ * @param num_samples Number of rows the statistics were accumulated over.
+ * @param epsilon Value added to the variance (or mean square) before the reciprocal square root.
+ */
+template <NormType norm_type>
+inline void _calculate_norm_rstd_(const std::uint32_t num_samples, const float epsilon)
+{
+    // LREG5 = M2 * (1 / N)
+    const FloatBits recip_bits(1.0f / static_cast<float>(num_samples));
+    TT_SFPLOADI(ckernel::p_sfpu::LREG7, sfpi::SFPLOADI_MOD0_UPPER, recip_bits.high16);
+    TT_SFPLOADI(ckernel::p_sfpu::LREG7, sfpi::SFPLOADI_MOD0_LOWER, recip_bits.low16);
+    TTI_SFPMAD(ckernel::p_sfpu::LREG7, ckernel::p_sfpu::LREG5, ckernel::p_sfpu::LCONST_0, ckernel::p_sfpu::LREG5, 0);
+
+    const FloatBits epsilon_bits(epsilon);
+    TT_SFPLOADI(ckernel::p_sfpu::LREG6, sfpi::SFPLOADI_MOD0_UPPER, epsilon_bits.high16);
+    TT_SFPLOADI(ckernel::p_sfpu::LREG6, sfpi::SFPLOADI_MOD0_LOWER, epsilon_bits.low16);
+
+    if constexpr (norm_type == NormType::RMSNorm)
+    {
+        // mean(x^2) = var + mean^2, LREG5 = LREG4 * LREG4 + LREG5
+        TTI_SFPMAD(ckernel::p_sfpu::LREG4, ckernel::p_sfpu::LREG4, ckernel::p_sfpu::LREG5, ckernel::p_sfpu::LREG5, 0);
+        TTI_SFPNOP; // Next cycle cannot read from LREG5 (2-cycle operation)
+    }
+
+    // LREG5 = LREG5 * 1 + LREG6
+    TTI_SFPMAD(ckernel::p_sfpu::LREG5, ckernel::p_sfpu::LCONST_1, ckernel::p_sfpu::LREG6, ckernel::p_sfpu::LREG5, 0);
+    TTI_SFPNOP; // Next cycle cannot read from LREG5 (2-cycle operation)
+
+    sfpi::vFloat mean = sfpi::l_reg[sfpi::LRegs::LReg4];
+    sfpi::vFloat var  = sfpi::l_reg[sfpi::LRegs::LReg5];
+
+    sfpi::vFloat rstd = _calculate_sqrt_body_<false, true, true>(var);
+
+    sfpi::l_reg[sfpi::LRegs::LReg4] = mean;
+    sfpi::l_reg[sfpi::LRegs::LReg5] = rstd;
+}
+
+/*
+ * @brief Scales the normalized block at block_offset by gamma and shifts it by beta, element by element.
+ *
+ * Works on the natural dst layout, LREG0-2 are used as scratch and LREG4-7 are left untouched.
+ */
+sfpi_inline void _norm_affine_block_(const std::uint32_t block_offset, const std::uint32_t gamma_offset, const std::uint32_t beta_offset)
+{
+#pragma GCC unroll 4
+    for (std::uint32_t i = 0; i < 4; i++)
+    {
+        const std::uint32_t offset = block_offset + NORM_BLOCK_LREG_OFFSETS[i];
+
+        TT_SFPLOAD(ckernel::p_sfpu::LREG0, sfpi::SFPLOAD_MOD0_FMT_SRCB, ckernel::ADDR_MOD_3, offset);
+        TT_SFPLOAD(ckernel::p_sfpu::LREG1, sfpi::SFPLOAD_MOD0_FMT_SRCB, ckernel::ADDR_MOD_3, gamma_offset + offset);
+        TT_SFPLOAD(ckernel::p_sfpu::LREG2, sfpi::SFPLOAD_MOD0_FMT_SRCB, ckernel::ADDR_MOD_3, beta_offset + offset);
+        // LREG0 = LREG0 * LREG1 + LREG2
+        TTI_SFPMAD(ckernel::p_sfpu::LREG0, ckernel::p_sfpu::LREG1, ckernel::p_sfpu::LREG2, ckernel::p_sfpu::LREG0, 0);
+        TTI_SFPNOP; // Next cycle cannot read from LREG0 (2-cycle operation)
+        TT_SFPSTORE(ckernel::p_sfpu::LREG0, sfpi::SFPSTORE_MOD0_FMT_SRCB, ckernel::ADDR_MOD_3, offset);
+    }
+}
+
+/**
+ * @brief Fused LayerNorm / RMSNorm over num_tiles tiles in dst, computed in place.
+ *
+ * Replaces the Welford's statistics, the reciprocal square root and the subtract / multiply / add passes, each with its
+ * own dst sweep, with a single call. Every column of the input is normalized over the 32 * num_tiles rows of the
+ * num_tiles consecutive tiles starting at the dst index given to _llk_math_layernorm_sfpu_.
+ *
+ * @tparam norm_type LayerNorm computes (x - mean) / sqrt(var + eps), RMSNorm computes x / sqrt(mean(x^2) + eps).
+ * @tparam apply_affine Multiplies the result by gamma and adds beta.
+ * @tparam reciprocal_size The size of the reciprocal lookup table, 0 computes the reciprocals at runtime.
+ * @param num_tiles Number of tiles stacked along the normalized dimension.
+ * @param gamma_tile_offset Offset in tiles of the first gamma tile from the first input tile, used if apply_affine.
+ * @param beta_tile_offset Offset in tiles of the first beta tile from the first input tile, used if apply_affine.
+ * @param epsilon Value added to the variance (or mean square) before the reciprocal square root.
+ * @param reciprocal_lut The lookup table containing the reciprocals of the sample counts, needs 32 * num_tiles entries.
+ *
+ * @note The Welford's replay buffer and the reciprocal square root constants are programmed by _llk_math_layernorm_sfpu_init_.
+ */
+template <NormType norm_type, bool apply_affine, std::size_t reciprocal_size>
+inline void _calculate_norm_(
+    const std::uint32_t num_tiles,
+    const std::uint32_t gamma_tile_offset,
+    const std::uint32_t beta_tile_offset,
+    const float epsilon,
+    const std::array<std::uint32_t, reciprocal_size>& reciprocal_lut)
+{
+    _calculate_norm_welfords_<reciprocal_size>(num_tiles, reciprocal_lut);
+    _calculate_norm_rstd_<norm_type>(num_tiles * 32, epsilon);
+
+    for (std::uint32_t tile = 0; tile < num_tiles; tile++)
+    {
+        for (std::uint32_t block = 0; block < 8; block++)
+        {
+            const std::uint32_t block_offset = tile * NORM_DST_TILE_OFFSET + NORM_BLOCK_OFFSETS[block];
+
+            _norm_load_block_(block_offset);
+            _norm_row_<norm_type, ckernel::p_sfpu::LREG0>();
+            _norm_row_<norm_type, ckernel::p_sfpu::LREG1>();
+            _norm_row_<norm_type, ckernel::p_sfpu::LREG2>();
+            _norm_row_<norm_type, ckernel::p_sfpu::LREG3>();
+            TTI_SFPNOP; // Next cycle cannot read from LREG3 (2-cycle operation)
+            _norm_store_block_(block_offset);
+
+            if constexpr (apply_affine)
+            {
+                _norm_affine_block_(block_offset, gamma_tile_offset * NORM_DST_TILE_OFFSET, beta_tile_offset * NORM_DST_TILE_OFFSET);
+            }
+        }
+    }
+}
+
+} // namespace sfpu
+} // namespace ckernel
@@ -0,0 +1,142 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "llk_defs.h"
+#include "sfpi.h"
+
+namespace ckernel
+{
+namespace sfpu
+{
+
+// ============================================================================
+// Streaming reduce to scalar over many tiles
+// ============================================================================
+// Every input tile is reduced to a scalar by the FPU (ReduceDim::REDUCE_SCALAR) into a partial tile in dest, which is
+// then folded into an accumulator tile that stays in dest for the whole tensor, so a whole-tensor reduction needs one
+// pack at the end instead of packing and re-reducing one scalar per tile.
+//
+// The scalar of a tile is datum 0, which is lane 0 of the even column vector of rows 0-3 of face 0. The accumulator
+// keeps the running result there and, with compensation, the running compensation term in lane 0 of the odd column
+// vector next to it (datum 1). All other lanes of these two vectors are kept at zero.
+
+// size of each tile in Dest is 64/SFP_DESTREG_STRIDE = 32 rows when using sfpi to load/store
+constexpr std::uint32_t REDUCE_SCALAR_DST_TILE_SIZE_SFPI = 32;
+// Even column vector of rows 0-3 of the right face, the odd column vector follows it
+constexpr std::uint32_t REDUCE_SCALAR_RIGHT_FACE_OFFSET = 8;
+
+template <bool is_fp32_dest_acc_en>
+sfpi_inline sfpi::vFloat _reduce_scalar_to_dest_format_(const sfpi::vFloat val)
+{
+    if constexpr (is_fp32_dest_acc_en)
+    {
+        return val;
+    }
+    else
+    {
+        return sfpi::reinterpret<sfpi::vFloat>(sfpi::float_to_fp16b(val, 0));
+    }
+}
+
+/**
+ * @brief Folds the scalar of the partial tile into the accumulator tile and clears the partial tile for the next input
+ *        tile. SUM and AVG add the scalars, MAX keeps the largest one.
+ *        With compensation the low order bits lost by every addition are kept in a compensation term (Kahan-Babuska,
+ *        also known as Neumaier summation), which _calculate_reduce_scalar_finalize_ folds back into the result. This
+ *        keeps long sums accurate, most of all when dest is 16 bit and every partial result is rounded to fp16_b.
+ *
+ * @tparam is_fp32_dest_acc_en Results are rounded to fp16_b when dest is 16 bit
+ * @tparam pool_type The pool type the partial tile was reduced with
+ * @tparam compensated Keep a compensation term, SUM and AVG only
+ * @param partial_tile_idx Dest tile the FPU reduced the input tile into, relative to the tile set by
+ *        _llk_math_eltwise_unary_sfpu_start_. Rows 0-3 of its two upper faces are cleared
+ * @param acc_tile_idx Dest tile of the running result, relative to the tile set by _llk_math_eltwise_unary_sfpu_start_
+ * @param first The partial tile holds the first input tile, which initializes the accumulator tile
+ *
+ * @note Only datums 0 and 1 of the accumulator tile are defined, it is meant to be packed with the REDUCE_SCALAR pack
+ *       mask (_llk_pack_reduce_mask_config_).
+ */
+template <bool is_fp32_dest_acc_en, PoolType pool_type, bool compensated>
+inline void _calculate_reduce_scalar_accumulate_(const std::uint32_t partial_tile_idx, const std::uint32_t acc_tile_idx, const bool first)
+{
+    static_assert(!compensated || pool_type != PoolType::MAX, "Compensation only applies to SUM and AVG");
+
+    const std::uint32_t partial_base = partial_tile_idx * REDUCE_SCALAR_DST_TILE_SIZE_SFPI;
+    const std::uint32_t acc_base     = acc_tile_idx * REDUCE_SCALAR_DST_TILE_SIZE_SFPI;
+
+    // Only lane 0 holds the scalar, the other lanes read as zero
+    sfpi::vUInt tile_id  = sfpi::vConstTileId;
+    sfpi::vFloat partial = sfpi::vConst0;
+    v_if (tile_id == 0)
+    {
+        partial = sfpi::dst_reg[partial_base];
+    }
+    v_endif;
+
+    // The FPU reduce accumulates into dest, the next input tile has to start from zero
+    sfpi::dst_reg[partial_base]                                       = sfpi::vConst0;
+    sfpi::dst_reg[partial_base + 1]                                   = sfpi::vConst0;
+    sfpi::dst_reg[partial_base + REDUCE_SCALAR_RIGHT_FACE_OFFSET]     = sfpi::vConst0;
+    sfpi::dst_reg[partial_base + REDUCE_SCALAR_RIGHT_FACE_OFFSET + 1] = sfpi::vConst0;
+
+    if (first)
+    {
+        sfpi::dst_reg[acc_base]     = partial;
+        sfpi::dst_reg[acc_base + 1] = sfpi::vConst0;
+        return;
+    }
+
+    sfpi::vFloat sum = sfpi::dst_reg[acc_base];
+    if constexpr (pool_type == PoolType::MAX)
+    {
+        // vec_min_max leaves the larger value in its second operand
+        sfpi::vec_min_max(partial, sum);
+    }
+    else
+    {
+        sfpi::vFloat total = _reduce_scalar_to_dest_format_<is_fp32_dest_acc_en>(sum + partial);
+        if constexpr (compensated)
+        {
+            // What the rounded total lost of the smaller operand
+            sfpi::vFloat compensation = sfpi::dst_reg[acc_base + 1];
+            v_if (sfpi::abs(sum) >= sfpi::abs(partial))
+            {
+                compensation += (sum - total) + partial;
+            }
+            v_else
+            {
+                compensation += (partial - total) + sum;
+            }
+            v_endif;
+            sfpi::dst_reg[acc_base + 1] = _reduce_scalar_to_dest_format_<is_fp32_dest_acc_en>(compensation);
+        }
+        sum = total;
+    }
+    sfpi::dst_reg[acc_base] = sum;
+}
+
+/**
+ * @brief Folds the compensation term into the result after the last input tile and clears it, only needed when
+ *        _calculate_reduce_scalar_accumulate_ was called with compensation.
+ *
+ * @tparam is_fp32_dest_acc_en Results are rounded to fp16_b when dest is 16 bit
+ * @param acc_tile_idx Dest tile of the running result, relative to the tile set by _llk_math_eltwise_unary_sfpu_start_
+ */
+template <bool is_fp32_dest_acc_en>
+inline void _calculate_reduce_scalar_finalize_(const std::uint32_t acc_tile_idx)
+{
+    const std::uint32_t acc_base = acc_tile_idx * REDUCE_SCALAR_DST_TILE_SIZE_SFPI;
+
+    sfpi::vFloat sum            = sfpi::dst_reg[acc_base];
+    sfpi::vFloat compensation   = sfpi::dst_reg[acc_base + 1];
+    sfpi::dst_reg[acc_base]     = _reduce_scalar_to_dest_format_<is_fp32_dest_acc_en>(sum + compensation);
+    sfpi::dst_reg[acc_base + 1] = sfpi::vConst0;
+}
+
+} // namespace sfpu
+} // namespace ckernel
@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel_sfpu_exp.h"
+#include "ckernel_sfpu_trigonometry.h"
+#include "sfpi.h"
+
+namespace ckernel
+{
+namespace sfpu
+{
+
+// ============================================================================
+// Rotary position embedding (rotate-half)
+// ============================================================================
+// Every row of a [num_position_tiles x head_dim_tiles] tile block in dst holds the head_dim = 32 * head_dim_tiles
+// features of one token, token positions increase by one per row starting at position_offset.
+// Column c of the first half is rotated together with column c + head_dim / 2 by the angle
+// position * freq_base^(-2c / head_dim):
+//   x[c]                = x[c] * cos - x[c + head_dim / 2] * sin
+//   x[c + head_dim / 2] = x[c + head_dim / 2] * cos + x[c] * sin
+// head_dim / 2 is a whole number of faces, so both columns of a pair sit in the same lane of two vectors and no lane
+// shuffling is needed. Sine and cosine are evaluated in registers instead of being unpacked from L1.
+
+// size of each tile in Dest is 64/SFP_DESTREG_STRIDE = 32 rows when using sfpi to load/store
+constexpr std::uint32_t ROPE_DST_TILE_SIZE_SFPI = 32;
+
+/**
+ * @brief log2 of a positive normal float, evaluated once per call on the RISC-V core.
+ * Uses the exponent bits and the 2 * atanh series of the mantissa, accurate to about 1e-6.
+ */
+inline float _rope_log2_(const float value)
+{
+    union
+    {
+        float f;
+        std::uint32_t u;
+    } bits {value};
+
+    const int exponent = static_cast<int>((bits.u >> 23) & 0xFF) - 127;
+    bits.u             = (bits.u & 0x007FFFFF) | 0x3F800000; // mantissa in [1, 2)
+
+    const float s    = (bits.f - 1.0f) / (bits.f + 1.0f);
+    const float s2   = s * s;
+    const float ln_m = 2.0f * s * (1.0f + s2 * (0.333333333f + s2 * (0.2f + s2 * (0.142857143f + s2 * 0.111111111f))));
+
+    return static_cast<float>(exponent) + ln_m * 1.442695041f;
+}
+
+/**
+ * @brief Rotates x (first half) and y (second half) of one vector pair by angle, results are written back in place.
+ */
+template <bool APPROXIMATION_MODE, bool is_fp32_dest_acc_en>
+sfpi_inline void _rope_rotate_(const std::uint32_t index_x, const std::uint32_t index_y, const sfpi::vFloat angle)
+{
+    // Reduce the angle to [-pi/2, pi/2] plus a whole number of half turns, both series are good for [-pi, pi]
+    sfpi::vFloat half_turns    = angle * 0.318309886183791f;
+    sfpi::vInt whole           = sfpi::float_to_int16(half_turns, 0);
+    sfpi::vFloat reduced_angle = (half_turns - sfpi::int32_to_float(whole, 0)) * 3.141592653589793f;
+
+    sfpi::vFloat sin_val = _sfpu_sine_maclaurin_series_<APPROXIMATION_MODE>(reduced_angle);
+    sfpi::vFloat cos_val = _sfpu_cosine_maclaurin_series_<APPROXIMATION_MODE>(reduced_angle);
+    whole                = whole & 0x1;
+    v_if (whole != 0)
+    {
+        // odd number of half turns flips the sign of both
+        sin_val = -sin_val;
+        cos_val = -cos_val;
+    }
+    v_endif;
+
+    sfpi::vFloat x = sfpi::dst_reg[index_x];
+    sfpi::vFloat y = sfpi::dst_reg[index_y];
+
+    sfpi::vFloat x_out = x * cos_val - y * sin_val;
+    sfpi::vFloat y_out = y * cos_val + x * sin_val;
+    if constexpr (!is_fp32_dest_acc_en)
+    {
+        x_out = sfpi::reinterpret<sfpi::vFloat>(sfpi::float_to_fp16b(x_out, 0));
+        y_out = sfpi::reinterpret<sfpi::vFloat>(sfpi::float_to_fp16b(y_out, 0));
+    }
+    sfpi::dst_reg[index_x] = x_out;
+    sfpi::dst_reg[index_y] = y_out;
+}
+
+/**
+ * @brief Applies the rotary position embedding in place to a block of tiles in dst.
+ *        Replaces the sin/cos tiles unpacked from L1 and the eltwise multiply-add chain.
+ *        Tiles of the block must be consecutive in dst in row-major order, starting at the tile set by
+ *        _llk_math_eltwise_unary_sfpu_start_.
+ *
+ * @tparam APPROXIMATION_MODE Uses the shorter sine/cosine series
+ * @tparam is_fp32_dest_acc_en Dest holds fp32 data, otherwise results are rounded to bfloat16
+ * @param head_dim_tiles Number of tiles along the head dimension (columns)
+ * @param num_position_tiles Number of tiles along the token dimension (rows)
+ * @param position_offset Position of the token in the first row
+ * @param freq_base Frequency base of the rotation angles, usually 10000
+ *
+ * @note The angle is reduced through a 16-bit count of half turns, which limits position * 1 / pi to 32767.
+ */
+template <bool APPROXIMATION_MODE, bool is_fp32_dest_acc_en>
+inline void _calculate_rope_(const std::uint32_t head_dim_tiles, const std::uint32_t num_position_tiles, const std::uint32_t position_offset, const float freq_base)
+{
+    // freq_base^(-2c / head_dim) = exp(c * freq_exp_step)
+    const float freq_exp_step = -2.0f * 0.693147181f * _rope_log2_(freq_base) / static_cast<float>(32 * head_dim_tiles);
+
+    // LTILEID holds 2 * lane index, every 8 lanes form one row of the vector and cover the even (or odd) columns of a face
+    sfpi::vUInt tile_id           = sfpi::vConstTileId;
+    const sfpi::vFloat lane_row   = sfpi::int32_to_float(sfpi::reinterpret<sfpi::vInt>(tile_id >> 4), 0);
+    const sfpi::vFloat lane_col   = sfpi::int32_to_float(sfpi::reinterpret<sfpi::vInt>(tile_id & 0xE), 0);
+    const std::uint32_t band_size = head_dim_tiles * ROPE_DST_TILE_SIZE_SFPI;
+
+    // The first half of the head dimension spans head_dim_tiles faces, face f is paired with face f + head_dim_tiles
+    for (std::uint32_t face = 0; face < head_dim_tiles; face++)
+    {
+        const std::uint32_t pair_face = face + head_dim_tiles;
+
+        for (std::uint32_t odd = 0; odd < 2; odd++)
+        {
+            const std::uint32_t offset_x = (face >> 1) * ROPE_DST_TILE_SIZE_SFPI + (face & 1) * 8 + odd;
+            const std::uint32_t offset_y = (pair_face >> 1) * ROPE_DST_TILE_SIZE_SFPI + (pair_face & 1) * 8 + odd;
+
+            const sfpi::vFloat inv_freq = _sfpu_exp_fp32_accurate_((lane_col + static_cast<float>(face * 16 + odd)) * freq_exp_step);
+
+            for (std::uint32_t rt = 0; rt < num_position_tiles; rt++)
+            {
+#pragma GCC unroll 2
+                for (std::uint32_t group = 0; group < 8; group++)
+                {
+                    // Groups 0-3 are the rows of the upper faces, groups 4-7 the rows of the lower faces
+                    const std::uint32_t row_offset = rt * band_size + (group >> 2) * 16 + (group & 3) * 2;
+                    const float position           = static_cast<float>(position_offset + rt * 32 + group * 4);
+
+                    _rope_rotate_<APPROXIMATION_MODE, is_fp32_dest_acc_en>(row_offset + offset_x, row_offset + offset_y, (lane_row + position) * inv_freq);
+                }
+            }
+        }
+    }
+}
+
+} // namespace sfpu
+} // namespace ckernel
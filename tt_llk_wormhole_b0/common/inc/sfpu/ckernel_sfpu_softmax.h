@@ -0,0 +1,173 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel_sfpu_exp.h"
+#include "ckernel_sfpu_recip.h"
+#include "sfpi.h"
+
+namespace ckernel
+{
+namespace sfpu
+{
+
+// ============================================================================
+// Fused row softmax
+// ============================================================================
+// Every SFPU vector covers 4 rows of a face, one row per 8-lane subvector, with the even or odd columns of the row
+// in the 8 lanes. A 4-row slice of a row band of block_ct_dim tiles is therefore spread over 4 * block_ct_dim vectors:
+// even/odd columns of the left face and even/odd columns of the right face of every tile.
+//
+// Pass 1 keeps a running max m and a running sum s of exp(x - m) per lane (online softmax), rescaling s whenever
+// the max grows. The 8 lanes of every row are then combined with a rotate butterfly, which leaves the row max M and
+// the row sum S broadcast to all lanes of the row. Pass 2 rewrites every datum of the slice as exp(x - M) / S.
+
+// size of each tile in Dest is 64/SFP_DESTREG_STRIDE = 32 rows when using sfpi to load/store
+constexpr std::uint32_t SOFTMAX_DST_TILE_SIZE_SFPI = 32;
+// Vectors of one 4-row slice within a tile: left face even/odd columns, right face even/odd columns
+constexpr std::uint32_t SOFTMAX_SLICE_OFFSETS[4] = {0, 1, 8, 9};
+
+template <bool is_fp32_dest_acc_en>
+sfpi_inline sfpi::vFloat _softmax_exp_(sfpi::vFloat val)
+{
+    if constexpr (is_fp32_dest_acc_en)
+    {
+        return _sfpu_exp_fp32_accurate_(val);
+    }
+    else
+    {
+        // Intermediate values stay in fp32 LREGs, rounding to bfloat16 is only done on the final store
+        return _sfpu_exp_21f_bf16_<true>(val);
+    }
+}
+
+template <int rotation>
+sfpi_inline sfpi::vFloat _softmax_subvec_rotate_(sfpi::vFloat val)
+{
+#pragma GCC unroll 4
+    for (int i = 0; i < rotation; i++)
+    {
+        val = sfpi::subvec_shflror1(val);
+    }
+    return val;
+}
+
+/**
+ * @brief Folds the per-lane running max and running sum of every row into the whole row.
+ * After the call every lane of a row holds the max and the sum of exp(x - max) over the entire row.
+ */
+template <bool is_fp32_dest_acc_en>
+sfpi_inline void _softmax_row_allreduce_(sfpi::vFloat &max, sfpi::vFloat &sum)
+{
+    // Butterfly over the 8 lanes of a row, vec_min_max leaves the larger value in its second operand
+    sfpi::vFloat row_max = max;
+    sfpi::vFloat other   = _softmax_subvec_rotate_<4>(row_max);
+    sfpi::vec_min_max(other, row_max);
+    other = _softmax_subvec_rotate_<2>(row_max);
+    sfpi::vec_min_max(other, row_max);
+    other = _softmax_subvec_rotate_<1>(row_max);
+    sfpi::vec_min_max(other, row_max);
+
+    // Rescale every lane's partial sum to the row max before adding the lanes together
+    sum = sum * _softmax_exp_<is_fp32_dest_acc_en>(max - row_max);
+
+    sum = sum + _softmax_subvec_rotate_<4>(sum);
+    sum = sum + _softmax_subvec_rotate_<2>(sum);
+    sum = sum + _softmax_subvec_rotate_<1>(sum);
+
+    max = row_max;
+}
+
+/**
+ * @brief Initialization for the fused row softmax kernel, programs the reciprocal constants.
+ */
+inline void _init_softmax_row_()
+{
+    _init_sfpu_reciprocal_<false>();
+}
+
+/**
+ * @brief Fused row softmax over a block of tiles in dest, computed in place.
+ *        Every row of the block_ct_dim tiles of a row band is normalized as exp(x - max(x)) / sum(exp(x - max(x))).
+ *        Replaces the reduce max, subtract, exponential, reduce sum and reciprocal sequence, each with its own dest
+ *        sweep and init, with two sweeps: one building the row max and sum online, one writing the result.
+ *        Tiles of a row band must be consecutive in dest, starting at the tile set by _llk_math_eltwise_unary_sfpu_start_.
+ *
+ * @tparam is_fp32_dest_acc_en Dest holds fp32 data, selects the fp32-accurate exponential
+ * @param block_ct_dim Number of tiles along the softmax (row) dimension
+ * @param block_rt_dim Number of row bands
+ *
+ * @note Rows containing only -inf are not supported, they produce NaN like the unfused sequence.
+ */
+template <bool is_fp32_dest_acc_en>
+inline void _calculate_softmax_row_(const std::uint32_t block_ct_dim, const std::uint32_t block_rt_dim = 1)
+{
+    for (std::uint32_t rt = 0; rt < block_rt_dim; rt++)
+    {
+        const std::uint32_t band_base = rt * block_ct_dim * SOFTMAX_DST_TILE_SIZE_SFPI;
+
+        // Upper face pair (faces 0/1) holds rows 0-15 of the tile, lower face pair (faces 2/3) rows 16-31
+        for (std::uint32_t face_pair = 0; face_pair < 2; face_pair++)
+        {
+            for (std::uint32_t slice = 0; slice < 4; slice++)
+            {
+                const std::uint32_t slice_base = band_base + face_pair * 16 + slice * 2;
+
+                // Pass 1: online max and sum of exponentials per lane
+                sfpi::vFloat max = sfpi::dst_reg[slice_base];
+                sfpi::vFloat sum = sfpi::vConst1;
+
+                for (std::uint32_t ct = 0; ct < block_ct_dim; ct++)
+                {
+#pragma GCC unroll 4
+                    for (std::uint32_t v = (ct == 0) ? 1 : 0; v < 4; v++) // the first vector seeds the running max
+                    {
+                        sfpi::vFloat in = sfpi::dst_reg[slice_base + ct * SOFTMAX_DST_TILE_SIZE_SFPI + SOFTMAX_SLICE_OFFSETS[v]];
+
+                        // Only one exponential per datum: exp(-|in - max|) is the scale of whichever of the two is smaller
+                        sfpi::vFloat diff = in - max;
+                        sfpi::vFloat e    = _softmax_exp_<is_fp32_dest_acc_en>(sfpi::setsgn(diff, 1));
+                        v_if (diff > 0.0f)
+                        {
+                            sum = sum * e + sfpi::vConst1;
+                            max = in;
+                        }
+                        v_else
+                        {
+                            sum = sum + e;
+                        }
+                        v_endif;
+                    }
+                }
+
+                _softmax_row_allreduce_<is_fp32_dest_acc_en>(max, sum);
+
+                sfpi::vFloat recip = _sfpu_reciprocal_<2>(sum);
+
+                // Pass 2: normalize in place
+                for (std::uint32_t ct = 0; ct < block_ct_dim; ct++)
+                {
+#pragma GCC unroll 4
+                    for (std::uint32_t v = 0; v < 4; v++)
+                    {
+                        const std::uint32_t index = slice_base + ct * SOFTMAX_DST_TILE_SIZE_SFPI + SOFTMAX_SLICE_OFFSETS[v];
+
+                        sfpi::vFloat result = _softmax_exp_<is_fp32_dest_acc_en>(sfpi::dst_reg[index] - max) * recip;
+                        if constexpr (!is_fp32_dest_acc_en)
+                        {
+                            result = sfpi::reinterpret<sfpi::vFloat>(sfpi::float_to_fp16b(result, 0));
+                        }
+                        sfpi::dst_reg[index] = result;
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace sfpu
+} // namespace ckernel
@@ -12,6 +12,7 @@
 #include "cmath_common.h"
 #include "llk_assert.h"
 #include "llk_math_common.h"
+#include "lltt.h"
 
 using namespace ckernel;
 
@@ -77,41 +78,176 @@ inline void _llk_math_eltwise_binary_uninit_custom_()
     // No state to restore - all states are transient or default
 }
 
-// This helper is intentionally specialized even though the init surface is
-// generic. The current in-tree caller is blocked sub+bcast(col), so the
-// instruction sequence is hard-wired to ELWSUB with SrcB column broadcast and
-// SrcB reuse across ct_dim.
-inline void _llk_math_sub_bcast_cols_reuse_custom_(const std::uint32_t ct_dim = 1)
+/*************************************************************************
+ * Eltwise binary with the broadcast operand reused across a block
+ *
+ * SrcB holds one broadcast tile (bias/scale operand) that is unpacked once per block by
+ * _llk_unpack_AB_bcast_reuse_custom_, while ct_dim SrcA tiles are streamed against it. Both source
+ * registers hold whole 32x32 tiles, so the SrcB counter has to be steered to the face the broadcast
+ * reads from at every face boundary instead of clearing SrcB after every face.
+ *************************************************************************/
+
+// ELW instructions per tile: two 8-row instructions per face, plus the SrcA release
+constexpr std::uint32_t BCAST_REUSE_REPLAY_LEN = 9;
+
+/**
+ * @brief SrcB counter step at the end of a face, so the next face reads the right part of the broadcast tile
+ * @tparam bcast_type: Broadcast type for source B, values = <NONE/COL/ROW/SCALAR>
+ * @param odd_face: The face that ends is face 1 or 3
+ */
+template <BroadcastType bcast_type>
+constexpr std::uint8_t eltwise_binary_bcast_reuse_face_end_srcb_incr(const bool odd_face)
 {
-    TTI_SETRWC(p_setrwc::CLR_NONE, 0, 0, 0, 0, p_setrwc::SET_AB);
+    // The increment field is 6 bits wide, so 0x3F & -n encodes a step of -n
+    if constexpr (bcast_type == BroadcastType::COL)
+    {
+        // Faces 0/1 read column 0 of face 0, faces 2/3 read column 0 of face 2
+        return odd_face ? 24 : (0x3F & -8);
+    }
+    else if constexpr (bcast_type == BroadcastType::ROW)
+    {
+        // Faces 0/2 read row 0 of face 0, faces 1/3 read row 0 of face 1
+        return odd_face ? (0x3F & -16) : 16;
+    }
+    else if constexpr (bcast_type == BroadcastType::SCALAR)
+    {
+        // Every face reads datum 0
+        return 0;
+    }
+    else
+    {
+        // Faces are paired 1:1
+        return 8;
+    }
+}
 
+template <BroadcastType bcast_type>
+inline void eltwise_binary_bcast_reuse_configure_addrmod_custom()
+{
+    constexpr std::uint8_t srcb_incr = (bcast_type == BroadcastType::NONE || bcast_type == BroadcastType::COL) ? 8 : 0;
+
+    addr_mod_t {
+        .srca = {.incr = 8},
+        .srcb = {.incr = srcb_incr},
+        .dest = {.incr = 8},
+    }
+        .set(ADDR_MOD_0);
+
+    addr_mod_t {
+        .srca = {.incr = 8},
+        .srcb = {.incr = eltwise_binary_bcast_reuse_face_end_srcb_incr<bcast_type>(false)},
+        .dest = {.incr = 8},
+    }
+        .set(ADDR_MOD_1);
+
+    addr_mod_t {
+        .srca = {.incr = 8},
+        .srcb = {.incr = eltwise_binary_bcast_reuse_face_end_srcb_incr<bcast_type>(true)},
+        .dest = {.incr = 8},
+    }
+        .set(ADDR_MOD_2);
+}
+
+template <EltwiseBinaryType eltwise_binary_type, std::uint32_t broadcast_type, std::uint32_t addr_mod>
+inline void eltwise_binary_bcast_reuse_op_custom()
+{
+    if constexpr (eltwise_binary_type == ELWADD)
+    {
+        TTI_ELWADD(p_setrwc::CLR_NONE, 0, broadcast_type, addr_mod, 0);
+    }
+    else if constexpr (eltwise_binary_type == ELWSUB)
+    {
+        TTI_ELWSUB(p_setrwc::CLR_NONE, 0, broadcast_type, addr_mod, 0);
+    }
+    else
+    {
+        TTI_ELWMUL(p_setrwc::CLR_NONE, 0, broadcast_type, addr_mod, 0);
+    }
+}
+
+/**
+ * @brief Initialize FPU to perform Output = SrcA [+, -, *] bcast(SrcB) over a block of tiles that share one SrcB tile
+ * Records the instruction sequence of one tile into the replay buffer
+ * @tparam eltwise_binary_type: Type of eltwise binary op, values = <ELWADD/ELWSUB/ELWMUL>
+ * @tparam src_b_bcast_type: Broadcast type for source B, values = <NONE/COL/ROW/SCALAR>
+ * @tparam math_fidelity: Math fidelity, only LoFi is supported since fidelity phases would need to rewind SrcA and dest
+ */
+template <EltwiseBinaryType eltwise_binary_type, BroadcastType src_b_bcast_type, MathFidelity math_fidelity = MathFidelity::LoFi>
+inline void _llk_math_eltwise_binary_bcast_reuse_init_custom_()
+{
+    static_assert(
+        (eltwise_binary_type == ELWADD) || (eltwise_binary_type == ELWSUB) || (eltwise_binary_type == ELWMUL),
+        "eltwise_binary_type must be ELWADD, ELWSUB, or ELWMUL");
+    static_assert(math_fidelity == MathFidelity::LoFi, "Broadcast operand reuse only supports LoFi");
+
+    constexpr std::uint32_t broadcast_type = (src_b_bcast_type == BroadcastType::COL)      ? p_elwise::SRCB_BCAST_COL
+                                             : (src_b_bcast_type == BroadcastType::ROW)    ? p_elwise::SRCB_BCAST_ROW
+                                             : (src_b_bcast_type == BroadcastType::SCALAR) ? p_elwise::SRCB_BCAST_ALL
+                                                                                           : p_elwise::SRCB_NO_BCAST;
+
+    eltwise_binary_bcast_reuse_configure_addrmod_custom<src_b_bcast_type>();
+
+    lltt::record<lltt::NoExec>(ckernel::math::replay_buf_offset, BCAST_REUSE_REPLAY_LEN);
+    // F0, F1, F2, F3
+    eltwise_binary_bcast_reuse_op_custom<eltwise_binary_type, broadcast_type, ADDR_MOD_0>();
+    eltwise_binary_bcast_reuse_op_custom<eltwise_binary_type, broadcast_type, ADDR_MOD_1>();
+    eltwise_binary_bcast_reuse_op_custom<eltwise_binary_type, broadcast_type, ADDR_MOD_0>();
+    eltwise_binary_bcast_reuse_op_custom<eltwise_binary_type, broadcast_type, ADDR_MOD_2>();
+    eltwise_binary_bcast_reuse_op_custom<eltwise_binary_type, broadcast_type, ADDR_MOD_0>();
+    eltwise_binary_bcast_reuse_op_custom<eltwise_binary_type, broadcast_type, ADDR_MOD_1>();
+    eltwise_binary_bcast_reuse_op_custom<eltwise_binary_type, broadcast_type, ADDR_MOD_0>();
+    eltwise_binary_bcast_reuse_op_custom<eltwise_binary_type, broadcast_type, ADDR_MOD_2>();
+    // Release the SrcA tile and rewind both source counters, the SrcB tile stays valid for the next SrcA tile
+    TTI_SETRWC(p_setrwc::CLR_A, 0, 0, 0, 0, p_setrwc::SET_AB);
+
+    TTI_SETC16(CLR_DVALID_SrcA_Disable_ADDR32, 0);
+    math::reset_counters(p_setrwc::SET_ABD_F);
+}
+
+/**
+ * @brief Perform Output = SrcA [+, -, *] bcast(SrcB) for ct_dim SrcA tiles against a single SrcB tile
+ * Results go to ct_dim consecutive dest tiles starting at dst_index. Requires _llk_math_eltwise_binary_bcast_reuse_init_custom_
+ * and the matching _llk_unpack_AB_bcast_reuse_custom_ on the unpacker.
+ * @tparam Dst: Dest sync mode, used to bound the block to one dest section
+ * @tparam is_fp32_dest_acc_en: Dest is in 32-bit mode
+ * @param dst_index: Tile index into the destination register of the first result
+ * @param ct_dim: Number of SrcA tiles in the block
+ */
+template <DstSync Dst, bool is_fp32_dest_acc_en>
+inline void _llk_math_eltwise_binary_bcast_reuse_custom_(const std::uint32_t dst_index, const std::uint32_t ct_dim)
+{
+    LLK_ASSERT(
+        dst_index + ct_dim <= get_dest_max_tiles<Dst, is_fp32_dest_acc_en, DstTileShape::Tile32x32>(), "dst_index + ct_dim exceeds max dest tiles");
+    math::set_dst_write_addr<DstTileShape::Tile32x32, UnpackDestination::SrcRegs>(dst_index);
+
+#pragma GCC unroll 0
     for (std::uint32_t tile = 0; tile < ct_dim; tile++)
     {
-        // F0 - F0
-        TTI_ELWSUB(p_setrwc::CLR_NONE, 0, p_elwise::SRCB_BCAST_COL, ADDR_MOD_0, 0);
-        // F0 - F1, restore SrcB to the start of the broadcast tile.
-        TTI_ELWSUB(p_setrwc::CLR_NONE, 0, p_elwise::SRCB_BCAST_COL, ADDR_MOD_1, 0);
-
-        // F1 - F0
-        TTI_ELWSUB(p_setrwc::CLR_NONE, 0, p_elwise::SRCB_BCAST_COL, ADDR_MOD_0, 0);
-        // F1 - F2
-        TTI_ELWSUB(p_setrwc::CLR_NONE, 0, p_elwise::SRCB_BCAST_COL, ADDR_MOD_2, 0);
-
-        // F2 - F2
-        TTI_ELWSUB(p_setrwc::CLR_NONE, 0, p_elwise::SRCB_BCAST_COL, ADDR_MOD_0, 0);
-        // F2 - F3, restore SrcB to the third face of the broadcast tile.
-        TTI_ELWSUB(p_setrwc::CLR_NONE, 0, p_elwise::SRCB_BCAST_COL, ADDR_MOD_1, 0);
-
-        // F3 - F2
-        TTI_ELWSUB(p_setrwc::CLR_NONE, 0, p_elwise::SRCB_BCAST_COL, ADDR_MOD_0, 0);
-        // F3 - next tile
-        TTI_ELWSUB(p_setrwc::CLR_NONE, 0, p_elwise::SRCB_BCAST_COL, ADDR_MOD_2, 0);
-
-        // Move to the next SrcA tile while keeping the broadcasted SrcB tile
-        // available for reuse on the next outer iteration.
-        TTI_SETRWC(p_setrwc::CLR_A, 0, 0, 0, 0, p_setrwc::SET_AB);
+        lltt::replay(ckernel::math::replay_buf_offset, BCAST_REUSE_REPLAY_LEN);
     }
 
-    // Release the reused SrcB tile once the whole ct_dim block is consumed.
+    // Release the reused SrcB tile once the whole block is consumed
     TTI_SETRWC(p_setrwc::CLR_B, 0, 0, 0, 0, p_setrwc::SET_AB);
+    math::clear_dst_reg_addr();
+}
+
+/**
+ * @brief Initialize FPU to perform Output = SrcA - bcast_col(SrcB) over a block of tiles that share one SrcB tile
+ */
+inline void _llk_math_sub_bcast_cols_reuse_init_custom_()
+{
+    _llk_math_eltwise_binary_bcast_reuse_init_custom_<ELWSUB, BroadcastType::COL>();
+}
+
+/**
+ * @brief Perform Output = SrcA - bcast_col(SrcB) for ct_dim SrcA tiles against a single SrcB tile, starting at dest tile 0
+ * Requires _llk_math_sub_bcast_cols_reuse_init_custom_ and _llk_unpack_AB_sub_bcast_col_custom_ on the unpacker.
+ * @tparam Dst: Dest sync mode, used to bound the block to one dest section
+ * @tparam is_fp32_dest_acc_en: Dest is in 32-bit mode
+ * @param ct_dim: Number of SrcA tiles in the block
+ */
+template <DstSync Dst, bool is_fp32_dest_acc_en>
+inline void _llk_math_sub_bcast_cols_reuse_custom_(const std::uint32_t ct_dim = 1)
+{
+    _llk_math_eltwise_binary_bcast_reuse_custom_<Dst, is_fp32_dest_acc_en>(0 /* dst_index */, ct_dim);
 }
@@ -15,6 +15,66 @@
 
 using namespace ckernel;
 
+/**
+ * Configures address modifiers for specialized reduce_max_row operations.
+ *
+ * This function works with the following assumptions:
+ * - Scaler values are 1.0 and are contained inside F0 of the scaler tile
+ * - The scaler doesn't change for the duration of the whole block/tile operation
+ * - Operand and scaler data format is bfloat16_b
+ * - Operand tile size is 32x32
+ * - Can work on both 16-bit or 32-bit DEST register modes based on is_fp32_dest_acc_en flag
+ * - Does only MAX pool on ROW dimension
+ *
+ * This function should NOT be used as a substitute for native reduce LLK configuration.
+ * Use the standard reduce configuration functions for general-purpose reduction operations.
+ */
+inline void reduce_max_row_configure_addrmod_runtime()
+{
+    // ADDR_MOD_6: Default mode used with pool operations (GMPOOL/GAPOOL)
+    // No auto-increment on any counter - keeps all address pointers at their current positions
+    // Used for initial pooling operations where we want explicit control over counter advancement
+    addr_mod_t {
+        .srca     = {.incr = 0, .clr = 0, .cr = 0},
+        .srcb     = {.incr = 0, .clr = 0, .cr = 0},
+        .dest     = {.incr = 0, .clr = 0, .cr = 0},
+        .fidelity = {.incr = 0, .clr = 1}}
+        .set(ADDR_MOD_6);
+
+    // ADDR_MOD_1: Face-to-face advancement mode used with GMPOOL operations
+    // Increments SrcA by 16 rows to advance to the next face (F0->F1, F2->F3)
+    // Clears SrcB counter to prepare for subsequent MOVD2B operations that write transposed results
+    // This allows processing pairs of faces (F0+F1, then F2+F3) efficiently
+    addr_mod_t {
+        .srca = {.incr = 16, .clr = 0, .cr = 1},
+        .srcb = {.incr = 0, .clr = 1, .cr = 0},
+        .dest = {.incr = 0, .clr = 0, .cr = 0},
+    }
+        .set(ADDR_MOD_1);
+
+    // ADDR_MOD_2: Sequential 4-row write mode used with MOVB2D operations
+    // Increments DEST by 4 rows after each operation (writes to rows 0, 4, 8, 12 within a face)
+    // This distributes the transposed 1x16 reduction result across the first face (rows 0-15)
+    // by writing 4 rows to every 4th row, matching the tile face layout
+    addr_mod_t {
+        .srca = {.incr = 0, .clr = 0, .cr = 0},
+        .srcb = {.incr = 0, .clr = 0, .cr = 0},
+        .dest = {.incr = 4, .clr = 0, .cr = 1},
+    }
+        .set(ADDR_MOD_2);
+
+    // ADDR_MOD_3: Face-boundary jump mode used with final MOVB2D in each face
+    // Increments DEST by 20 rows, jumping from row 12 to row 32 (= 12 + 4 + 16)
+    // This transitions from the last row of the current face to the first row of the next face
+    // Example: After writing rows 0,4,8,12 in F0, this jumps to row 32 to start F2
+    addr_mod_t {
+        .srca = {.incr = 0, .clr = 0, .cr = 0},
+        .srcb = {.incr = 0, .clr = 0, .cr = 0},
+        .dest = {.incr = 20, .clr = 0, .cr = 1},
+    }
+        .set(ADDR_MOD_3);
+}
+
 inline void reduce_max_row_configure_addrmod_reinit_runtime()
 {
     addr_mod_t {
@@ -22,7 +82,7 @@ inline void reduce_max_row_configure_addrmod_reinit_runtime()
         .srcb     = {.incr = 0, .clr = 0, .cr = 0},
         .dest     = {.incr = 0, .clr = 0, .cr = 0},
         .fidelity = {.incr = 0, .clr = 1}}
-        .set(ADDR_MOD_0);
+        .set(ADDR_MOD_6);
 
     addr_mod_t {
         .srca = {.incr = 16, .clr = 0, .cr = 1},
@@ -50,26 +110,38 @@ inline void reduce_max_row_configure_addrmod_reinit_runtime()
  * Configures MOP (Macro Operation) for block-based reduce_max_row operations.
  *
  * This function works with the following assumptions:
- * - Scaler values are 1.0 and are contained inside F0 of the scaler tile
+ * - Scaler values are 1.0 (1/N for AVG) and are contained inside F0 of the scaler tile
  * - The scaler doesn't change for the duration of the whole block operation
  * - Operand and scaler data format is bfloat16_b
  * - Operand tile size is 32x32
  * - Can work on both 16-bit or 32-bit DEST register modes based on is_fp32_dest_acc_en flag
- * - Does only MAX pool on ROW dimension
+ * - Does MAX pool on ROW dimension, or SUM/AVG pool with type. SUM/AVG run a single LoFi phase, so the scaler
+ *   (1.0 for SUM, 1/N for AVG) has to be exact in LoFi, which holds for powers of two
  *
  * This function should NOT be used as a substitute for native reduce LLK MOP configuration.
  * Use the standard reduce MOP configuration with _llk_math_reduce_init_ for general-purpose reduction.
  */
-template <bool is_fp32_dest_acc_en = false>
+template <bool is_fp32_dest_acc_en = false, PoolType type = PoolType::MAX>
 inline void _llk_math_reduce_block_max_row_mop_config_runtime_(std::uint32_t block_ct_dim)
 {
+    static_assert(type == PoolType::MAX || type == PoolType::SUM || type == PoolType::AVG, "Unsupported pool type");
+
     // See _llk_math_reduce_max_row_ for a full algorithm explanation
     // Put the following 15 instructions in a REPLAY buffer
     lltt::record(0, 15);
 
-    // Two GMPOOLs to pool F0 and F1 (or F2 and F3) together
-    TTI_GMPOOL(p_setrwc::CLR_NONE, p_gpool::DIM_16X16, ADDR_MOD_1, p_gpool::INDEX_DIS, 0);
-    TTI_GMPOOL(p_setrwc::CLR_NONE, p_gpool::DIM_16X16, ADDR_MOD_1, p_gpool::INDEX_DIS, 0);
+    if constexpr (type == PoolType::MAX)
+    {
+        // Two GMPOOLs to pool F0 and F1 (or F2 and F3) together
+        TTI_GMPOOL(p_setrwc::CLR_NONE, p_gpool::DIM_16X16, ADDR_MOD_1, p_gpool::INDEX_DIS, 0);
+        TTI_GMPOOL(p_setrwc::CLR_NONE, p_gpool::DIM_16X16, ADDR_MOD_1, p_gpool::INDEX_DIS, 0);
+    }
+    else
+    {
+        // Two GAPOOLs to sum F0 and F1 (or F2 and F3) together, in a single LoFi phase
+        TTI_GAPOOL(p_setrwc::CLR_NONE, p_gpool::DIM_16X16, ADDR_MOD_1, p_gpool::INDEX_DIS, 0);
+        TTI_GAPOOL(p_setrwc::CLR_NONE, p_gpool::DIM_16X16, ADDR_MOD_1, p_gpool::INDEX_DIS, 0);
+    }
 
     if constexpr (is_fp32_dest_acc_en)
     {
@@ -77,17 +149,17 @@ inline void _llk_math_reduce_block_max_row_mop_config_runtime_(std::uint32_t blo
 
         // The following instructions are repeated for F0&F1 reduced and F2&F3 reduced
         // Move high 16 bits from DEST row 0 to SrcB rows 16 - 31 and transpose
-        TTI_MOVD2B(p_mov::DEST_NORM, p_movd2b::SRC_ROW16_OFFSET, ADDR_MOD_0, p_movd2b::MOV_1_ROW, 0);
+        TTI_MOVD2B(p_mov::DEST_NORM, p_movd2b::SRC_ROW16_OFFSET, ADDR_MOD_6, p_movd2b::MOV_1_ROW, 0);
         TTI_TRNSPSRCB;
 
         // Move high 16 bits back to Dest
-        TTI_MOVB2D(p_mov::DEST_NORM, p_movb2d::SRC_ROW16_OFFSET, ADDR_MOD_0, p_movb2d::MOV_4_ROWS, 0);
-        TTI_MOVB2D(p_mov::DEST_NORM, p_movb2d::SRC_ROW16_OFFSET + 4, ADDR_MOD_0, p_movb2d::MOV_4_ROWS, 4);
-        TTI_MOVB2D(p_mov::DEST_NORM, p_movb2d::SRC_ROW16_OFFSET + 8, ADDR_MOD_0, p_movb2d::MOV_4_ROWS, 8);
-        TTI_MOVB2D(p_mov::DEST_NORM, p_movb2d::SRC_ROW16_OFFSET + 12, ADDR_MOD_0, p_movb2d::MOV_4_ROWS, 12);
+        TTI_MOVB2D(p_mov::DEST_NORM, p_movb2d::SRC_ROW16_OFFSET, ADDR_MOD_6, p_movb2d::MOV_4_ROWS, 0);
+        TTI_MOVB2D(p_mov::DEST_NORM, p_movb2d::SRC_ROW16_OFFSET + 4, ADDR_MOD_6, p_movb2d::MOV_4_ROWS, 4);
+        TTI_MOVB2D(p_mov::DEST_NORM, p_movb2d::SRC_ROW16_OFFSET + 8, ADDR_MOD_6, p_movb2d::MOV_4_ROWS, 8);
+        TTI_MOVB2D(p_mov::DEST_NORM, p_movb2d::SRC_ROW16_OFFSET + 12, ADDR_MOD_6, p_movb2d::MOV_4_ROWS, 12);
 
         // Move low 16 bits to SrcB rows 16 - 31 and transpose
-        TTI_MOVD2B(p_mov::DEST_32B_LOW, p_movd2b::SRC_ROW16_OFFSET, ADDR_MOD_0, p_movd2b::MOV_1_ROW, 0);
+        TTI_MOVD2B(p_mov::DEST_32B_LOW, p_movd2b::SRC_ROW16_OFFSET, ADDR_MOD_6, p_movd2b::MOV_1_ROW, 0);
         TTI_TRNSPSRCB;
 
         // Move low 16 bits from SrcB rows 16 - 31 to DEST rows 0, 4, 8, 12
@@ -105,7 +177,7 @@ inline void _llk_math_reduce_block_max_row_mop_config_runtime_(std::uint32_t blo
         // The following instructions are going to transpose the whole tile, unlike the FP32 mode.
 
         // Move row 0 from DEST to SrcB with offset of 16 rows and transpose
-        TTI_MOVD2B(0, p_movd2b::SRC_ROW16_OFFSET, ADDR_MOD_0, p_movd2b::MOV_1_ROW, 0);
+        TTI_MOVD2B(0, p_movd2b::SRC_ROW16_OFFSET, ADDR_MOD_6, p_movd2b::MOV_1_ROW, 0);
         TTI_TRNSPSRCB;
         // Move row 0 from SrcB to DEST in 4-row chunks
         // ADDR_MOD_2 increments CR_D and Dest counter val by 4, so that's why DEST location is '0', not '0, 4, 8, 12'.
@@ -116,13 +188,13 @@ inline void _llk_math_reduce_block_max_row_mop_config_runtime_(std::uint32_t blo
         TTI_MOVB2D(0, p_movb2d::SRC_ROW16_OFFSET + 12, ADDR_MOD_3, p_movb2d::MOV_4_ROWS, 0);
 
         // Move row 32 (F2R0) from DEST to SrcB with offset of 16 rows and transpose
-        TTI_MOVD2B(0, p_movd2b::SRC_ROW16_OFFSET, ADDR_MOD_0, p_movd2b::MOV_1_ROW, 0);
+        TTI_MOVD2B(0, p_movd2b::SRC_ROW16_OFFSET, ADDR_MOD_6, p_movd2b::MOV_1_ROW, 0);
         TTI_TRNSPSRCB;
         // Move row 32 from SrcB to DEST in 4-row chunks
-        TTI_MOVB2D(0, p_movb2d::SRC_ROW16_OFFSET, ADDR_MOD_0, p_movb2d::MOV_4_ROWS, 0);
-        TTI_MOVB2D(0, p_movb2d::SRC_ROW16_OFFSET + 4, ADDR_MOD_0, p_movb2d::MOV_4_ROWS, 4);
-        TTI_MOVB2D(0, p_movb2d::SRC_ROW16_OFFSET + 8, ADDR_MOD_0, p_movb2d::MOV_4_ROWS, 8);
-        TTI_MOVB2D(0, p_movb2d::SRC_ROW16_OFFSET + 12, ADDR_MOD_0, p_movb2d::MOV_4_ROWS, 12);
+        TTI_MOVB2D(0, p_movb2d::SRC_ROW16_OFFSET, ADDR_MOD_6, p_movb2d::MOV_4_ROWS, 0);
+        TTI_MOVB2D(0, p_movb2d::SRC_ROW16_OFFSET + 4, ADDR_MOD_6, p_movb2d::MOV_4_ROWS, 4);
+        TTI_MOVB2D(0, p_movb2d::SRC_ROW16_OFFSET + 8, ADDR_MOD_6, p_movb2d::MOV_4_ROWS, 8);
+        TTI_MOVB2D(0, p_movb2d::SRC_ROW16_OFFSET + 12, ADDR_MOD_6, p_movb2d::MOV_4_ROWS, 12);
 
         // Clear B valid bits at the end and all address counters
         TTI_SETRWC(p_setrwc::CLR_B, 0, 0, 0, 0, p_setrwc::SET_ABD);
@@ -169,18 +241,18 @@ inline void _llk_math_reduce_block_max_row_mop_reprogram_only_runtime_(std::uint
  * Initializes block-based reduce_max_row operation for processing multiple tiles.
  *
  * This function works with the following assumptions:
- * - Scaler values are 1.0 and are contained inside F0 of the scaler tile
+ * - Scaler values are 1.0 (1/N for AVG) and are contained inside F0 of the scaler tile
  * - The scaler doesn't change for the duration of the whole block operation
  * - Operand and scaler data format is bfloat16_b
  * - Operand tile size is 32x32
  * - Can work on both 16-bit or 32-bit DEST register modes based on is_fp32_dest_acc_en flag
- * - Does only MAX pool on ROW dimension
+ * - Does MAX pool on ROW dimension, or SUM/AVG pool with type, see _llk_math_reduce_block_max_row_mop_config_runtime_
  *
  * This function should NOT be used as a substitute for the native _llk_math_reduce_init_ LLK.
  * Use the standard _llk_math_reduce_init_<PoolType::MAX, ReduceDim::REDUCE_ROW>() with multiple
  * _llk_math_reduce_() calls in a loop for general-purpose block reduction.
  */
-template <bool is_fp32_dest_acc_en = false>
+template <bool is_fp32_dest_acc_en = false, PoolType type = PoolType::MAX>
 inline void _llk_math_reduce_block_max_row_init_runtime_(std::uint32_t block_ct_dim)
 {
     if constexpr (is_fp32_dest_acc_en)
@@ -188,13 +260,13 @@ inline void _llk_math_reduce_block_max_row_init_runtime_(std::uint32_t block_ct_
         _llk_math_dbg_feature_disable_();
     }
 
-    reduce_max_row_configure_addrmod_reinit_runtime();
+    reduce_max_row_configure_addrmod_runtime();
 
     TTI_SETC16(CLR_DVALID_SrcA_Disable_ADDR32, 0);
 
     math::reset_counters(p_setrwc::SET_ABD_F);
 
-    _llk_math_reduce_block_max_row_mop_config_runtime_<is_fp32_dest_acc_en>(block_ct_dim);
+    _llk_math_reduce_block_max_row_mop_config_runtime_<is_fp32_dest_acc_en, type>(block_ct_dim);
 }
 
 inline void _llk_math_reduce_block_max_row_uninit_runtime_()
@@ -268,8 +340,20 @@ inline void _llk_math_reduce_block_max_row_reinit_runtime_()
 template <bool is_fp32_dest_acc_en = false>
 inline void _llk_math_reduce_block_max_row_reinit_short_runtime_(std::uint32_t block_ct_dim)
 {
-    reduce_max_row_configure_addrmod();
+    reduce_max_row_configure_addrmod_runtime();
     TTI_SETC16(CLR_DVALID_SrcA_Disable_ADDR32, 0);
     math::reset_counters(p_setrwc::SET_ABD_F);
     _llk_math_reduce_block_max_row_mop_reprogram_only_runtime_<is_fp32_dest_acc_en>(block_ct_dim);
 }
+
+/**
+ * Minimal reinitialization for block-based reduce_max_row operation.
+ * Reconfigures the address modifiers and counters without touching the MOP and the replay buffer.
+ * Unlike on Blackhole, ADDR_MOD_3 can't be preserved here because the Wormhole matmul programs it as well.
+ */
+inline void _llk_math_reduce_block_max_row_reinit_minimal_runtime_()
+{
+    reduce_max_row_configure_addrmod_reinit_runtime();
+    TTI_SETC16(CLR_DVALID_SrcA_Disable_ADDR32, 0);
+    math::reset_counters(p_setrwc::SET_ABD_F);
+}
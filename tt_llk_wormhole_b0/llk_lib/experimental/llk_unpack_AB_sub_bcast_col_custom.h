@@ -18,9 +18,10 @@
 using namespace ckernel;
 using namespace ckernel::unpacker;
 
-// Custom init for the blocked sub+bcast(col) unpack flow.
+// Custom init for the blocked broadcast reuse unpack flow, shared by all binary ops and broadcast types.
+// The broadcast is applied by the FPU, so SrcB always holds the whole broadcast tile.
 template <BroadcastType BType = BroadcastType::NONE>
-inline void _llk_unpack_AB_sub_bcast_col_init_custom_(
+inline void _llk_unpack_AB_bcast_reuse_init_custom_(
     [[maybe_unused]] const std::uint32_t face_r_dim = FACE_R_DIM, const std::uint32_t num_faces = 4, [[maybe_unused]] const bool narrow_tile = false)
 {
     LLK_ASSERT(num_faces == 1 || num_faces == 2 || num_faces == 4, "num_faces must be 1, 2, or 4");
@@ -31,9 +32,9 @@ inline void _llk_unpack_AB_sub_bcast_col_init_custom_(
     TTI_SETADCXX(p_setadc::UNP1, 1023, 0x0);
 }
 
-// Custom blocked unpack: one SrcB tile + ct_dim SrcA tiles.
+// Custom blocked unpack: one SrcB tile + ct_dim SrcA tiles, the SrcB tile is unpacked once per block.
 template <BroadcastType BType = BroadcastType::NONE>
-inline void _llk_unpack_AB_sub_bcast_col_custom_(const std::uint32_t address_a, const std::uint32_t address_b, const std::uint32_t ct_dim = 1)
+inline void _llk_unpack_AB_bcast_reuse_custom_(const std::uint32_t address_a, const std::uint32_t address_b, const std::uint32_t ct_dim = 1)
 {
     // Start from a clean A/B tile index for each blocked sub call.
     TTI_SETADCZW(0b011, 0, 0, 0, 0, 0b1111);
@@ -66,9 +67,28 @@ inline void _llk_unpack_AB_sub_bcast_col_custom_(const std::uint32_t address_a,
     switch_config_context(unp_cfg_context);
 }
 
-inline void _llk_unpack_AB_sub_bcast_col_uninit_custom_()
+inline void _llk_unpack_AB_bcast_reuse_uninit_custom_()
 {
     // Restore the default full-face unpack X span used by the generic unpack
     // helpers. The custom blocked path forces both unpackers to full 32x32.
     TTI_SETADCXX(p_setadc::UNP_AB, FACE_R_DIM * FACE_C_DIM - 1, 0x0);
 }
+
+// The blocked sub+bcast(col) flow is the broadcast reuse flow with ELWSUB and a column broadcast.
+template <BroadcastType BType = BroadcastType::NONE>
+inline void _llk_unpack_AB_sub_bcast_col_init_custom_(
+    const std::uint32_t face_r_dim = FACE_R_DIM, const std::uint32_t num_faces = 4, const bool narrow_tile = false)
+{
+    _llk_unpack_AB_bcast_reuse_init_custom_<BType>(face_r_dim, num_faces, narrow_tile);
+}
+
+template <BroadcastType BType = BroadcastType::NONE>
+inline void _llk_unpack_AB_sub_bcast_col_custom_(const std::uint32_t address_a, const std::uint32_t address_b, const std::uint32_t ct_dim = 1)
+{
+    _llk_unpack_AB_bcast_reuse_custom_<BType>(address_a, address_b, ct_dim);
+}
+
+inline void _llk_unpack_AB_sub_bcast_col_uninit_custom_()
+{
+    _llk_unpack_AB_bcast_reuse_uninit_custom_();
+}
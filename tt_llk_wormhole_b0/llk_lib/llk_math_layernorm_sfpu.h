@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#include <array>
+#include <cstdint>
+
+#include "ckernel_globals.h"
+#include "ckernel_include.h"
+#include "ckernel_ops.h"
+#include "ckernel_sfpu.h"
+#include "ckernel_template.h"
+#include "cmath_common.h"
+#include "llk_math_common.h"
+#include "llk_sfpu_types.h"
+#include "sfpu/ckernel_sfpu_layernorm.h"
+
+// local function declarations
+inline void layernorm_sfpu_configure_addrmod()
+{
+    addr_mod_t {
+        .srca = {.incr = 0},
+        .srcb = {.incr = 0},
+        .dest = {.incr = 0},
+    }
+        .set(ADDR_MOD_7);
+}
+
+/**
+ * @brief Initializes the SFPU for the fused LayerNorm / RMSNorm.
+ * Programs the Welford's replay buffer and the reciprocal square root constants used by _llk_math_layernorm_sfpu_.
+ */
+inline void _llk_math_layernorm_sfpu_init_()
+{
+    sfpu::_init_sfpu_config_reg();
+    layernorm_sfpu_configure_addrmod();
+    math::reset_counters(p_setrwc::SET_ABD_F);
+    _program_welfords_replay_buffer_();
+    sfpu::_init_sqrt_<false>();
+}
+
+/**
+ * @brief Normalizes num_tiles tiles in dst in place, going from input tiles to the normalized, affine-transformed output
+ * without intermediate dst round trips.
+ * Every column is normalized over the rows of the num_tiles tiles, see ckernel_sfpu_layernorm.h for the layout.
+ * @tparam Dst: Dest sync mode
+ * @tparam is_fp32_dest_acc_en: Dest holds fp32 data
+ * @tparam norm_type: LayerNorm or RMSNorm
+ * @tparam apply_affine: Multiplies the result by the gamma tiles and adds the beta tiles
+ * @tparam reciprocal_size: The size of the reciprocal lookup table, 0 computes the reciprocals at runtime
+ * @param dst_index: Index of the first input tile in dst
+ * @param num_tiles: Number of consecutive input tiles stacked along the normalized dimension
+ * @param gamma_dst_index: Index of the first of num_tiles gamma tiles in dst, must be at least dst_index + num_tiles
+ * @param beta_dst_index: Index of the first of num_tiles beta tiles in dst, must be at least dst_index + num_tiles
+ * @param epsilon: Value added to the variance (or mean square) before the reciprocal square root
+ * @param reciprocal_lut: Reciprocals of the sample counts 1..32 * num_tiles, as used by the Welford's kernel
+ */
+template <DstSync Dst, bool is_fp32_dest_acc_en, NormType norm_type, bool apply_affine, std::size_t reciprocal_size>
+inline void _llk_math_layernorm_sfpu_(
+    const std::uint32_t dst_index,
+    const std::uint32_t num_tiles,
+    const std::uint32_t gamma_dst_index,
+    const std::uint32_t beta_dst_index,
+    const float epsilon,
+    const std::array<std::uint32_t, reciprocal_size>& reciprocal_lut)
+{
+    constexpr std::uint32_t max_tiles = get_dest_max_tiles<Dst, is_fp32_dest_acc_en, DstTileShape::Tile32x32>();
+    LLK_ASSERT(num_tiles > 0, "num_tiles must be greater than 0");
+    LLK_ASSERT(dst_index + num_tiles <= max_tiles, "Input tiles exceed max dest tiles");
+    LLK_ASSERT((reciprocal_size == 0) || (reciprocal_size >= num_tiles * 32), "reciprocal_lut needs an entry per row");
+    if constexpr (apply_affine)
+    {
+        LLK_ASSERT(gamma_dst_index >= dst_index + num_tiles && gamma_dst_index + num_tiles <= max_tiles, "Gamma tiles must follow the input tiles in dest");
+        LLK_ASSERT(beta_dst_index >= dst_index + num_tiles && beta_dst_index + num_tiles <= max_tiles, "Beta tiles must follow the input tiles in dest");
+    }
+
+    math::set_dst_write_addr<DstTileShape::Tile32x32, UnpackDestination::SrcRegs>(dst_index);
+    math::set_addr_mod_base();
+    TTI_STALLWAIT(p_stall::STALL_SFPU, p_stall::MATH);
+
+    ckernel::sfpu::_calculate_norm_<norm_type, apply_affine, reciprocal_size>(
+        num_tiles, gamma_dst_index - dst_index, beta_dst_index - dst_index, epsilon, reciprocal_lut);
+
+    math::clear_dst_reg_addr();
+    TTI_STALLWAIT(p_stall::STALL_CFG, p_stall::WAIT_SFPU);
+    math::clear_addr_mod_base();
+}
+
+inline void _llk_math_layernorm_sfpu_uninit_()
+{
+    // No state to restore - all states are transient or default
+}
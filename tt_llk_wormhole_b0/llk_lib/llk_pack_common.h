@@ -58,7 +58,7 @@ inline void _llk_pack_dest_section_done_()
     }
 }
 
-template <DstSync Dst, bool untilize = false, bool diagonal = false>
+template <DstSync Dst, bool untilize = false, bool diagonal = false, bool dense = false>
 inline void _llk_init_packer_dest_offset_registers_(const std::uint32_t face_r_dim = FACE_R_DIM, const bool narrow_tile = false)
 {
     TTI_STALLWAIT(p_stall::STALL_TDMA | p_stall::STALL_THCON, p_stall::PACK); // wait for pack to finish
@@ -77,6 +77,24 @@ inline void _llk_init_packer_dest_offset_registers_(const std::uint32_t face_r_d
             TTI_SETDMAREG(0, DEST_REGISTER_HALF_SIZE + 0x00, 0, LO_16(p_gpr_pack::DEST_OFFSET_HI + 0));
             TT_SETDMAREG(0, DEST_REGISTER_HALF_SIZE + 0x20 + face_r_offset, 0, LO_16(p_gpr_pack::DEST_OFFSET_HI + 1));
         }
+        else if constexpr (dense)
+        {
+            // Dense tiles are addressed with the z counter, so the face rows are split evenly across the packers
+            // For example if face_r_dim = 16:
+            //  Packer0 :  0,16,  1,17 ...  3, 19
+            //  Packer1 :  4,20,  5,21 ...  7, 23
+            //  Packer2 :  8,24,  9,25 ... 11, 27
+            //  Packer3 : 12,28, 13,29 ... 15, 31
+            const std::uint32_t rows_per_packer = (face_r_dim < NUM_PACKERS) ? 1 : (face_r_dim / NUM_PACKERS);
+            TTI_SETDMAREG(0, 0x000 + 0x00, 0, LO_16(p_gpr_pack::DEST_OFFSET_LO + 0));
+            TT_SETDMAREG(0, 0x000 + 1 * rows_per_packer, 0, LO_16(p_gpr_pack::DEST_OFFSET_LO + 1));
+            TT_SETDMAREG(0, 0x000 + 2 * rows_per_packer, 0, LO_16(p_gpr_pack::DEST_OFFSET_LO + 2));
+            TT_SETDMAREG(0, 0x000 + 3 * rows_per_packer, 0, LO_16(p_gpr_pack::DEST_OFFSET_LO + 3));
+            TTI_SETDMAREG(0, DEST_REGISTER_HALF_SIZE + 0x00, 0, LO_16(p_gpr_pack::DEST_OFFSET_HI + 0));
+            TT_SETDMAREG(0, DEST_REGISTER_HALF_SIZE + 1 * rows_per_packer, 0, LO_16(p_gpr_pack::DEST_OFFSET_HI + 1));
+            TT_SETDMAREG(0, DEST_REGISTER_HALF_SIZE + 2 * rows_per_packer, 0, LO_16(p_gpr_pack::DEST_OFFSET_HI + 2));
+            TT_SETDMAREG(0, DEST_REGISTER_HALF_SIZE + 3 * rows_per_packer, 0, LO_16(p_gpr_pack::DEST_OFFSET_HI + 3));
+        }
         else
         {
             // For example if face_offset = 8:
@@ -115,12 +133,13 @@ inline void _llk_init_packer_dest_offset_registers_(const std::uint32_t face_r_d
     select_packer_dest_registers<Dst>();
 }
 
-template <DstSync Dst, bool is_fp32_dest_acc_en, bool untilize = false>
+template <DstSync Dst, bool is_fp32_dest_acc_en, bool untilize = false, bool dense = false>
 inline void _llk_pack_dest_init_(const std::uint32_t face_r_dim = FACE_R_DIM, const bool narrow_tile = false)
 {
+    static_assert(!dense || untilize, "dense requires untilize");
     tensix_sync();
     reset_dest_offset_id();
-    _llk_init_packer_dest_offset_registers_<Dst, untilize>(face_r_dim, narrow_tile);
+    _llk_init_packer_dest_offset_registers_<Dst, untilize, false, dense>(face_r_dim, narrow_tile);
     packer_addr_counter_init();
     pack_sync_tile_dst_ptr = 0;
 }
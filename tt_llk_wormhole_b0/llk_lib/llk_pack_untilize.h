@@ -53,20 +53,38 @@ inline void _llk_pack_untilize_configure_addrmod_()
         .set(ADDR_MOD_3);
 }
 
-template <
-    std::uint32_t block_ct_dim,
-    std::uint32_t full_ct_dim    = block_ct_dim,
-    bool diagonal                = false,
-    bool narrow_row              = false,
-    std::uint32_t row_num_datums = TILE_C_DIM>
-inline void _llk_pack_untilize_mop_config_(const std::uint32_t face_r_dim = FACE_R_DIM, const std::uint32_t num_faces = 4)
+/*
+Number of packers used by dense untilize. Rows of a dense face are split evenly across the packers,
+so only power of two face_r_dim values are supported.
+*/
+inline constexpr std::uint32_t _llk_pack_untilize_dense_packer_count_(const std::uint32_t face_r_dim)
 {
+    return (face_r_dim < NUM_PACKERS) ? face_r_dim : NUM_PACKERS;
+}
+
+/*
+Runtime variant of _llk_pack_untilize_mop_config_. block_ct_dim is the number of tiles packed from dest per call,
+full_ct_dim is the width of the whole row band in tiles. The MOP can be reprogrammed with a narrower block_ct_dim
+for the tail block of a row band whose width is not a multiple of block_ct_dim.
+dense is used with num_faces == 1 or 2, where 4 / num_faces tiles are stored back to back in a single 32x32 tile region in dest.
+Each dense tile is then addressed with the Z counter (one face per step) instead of the W counter.
+*/
+template <bool diagonal = false, bool narrow_row = false, bool dense = false>
+inline void _llk_pack_untilize_mop_config_runtime_(
+    const std::uint32_t block_ct_dim, const std::uint32_t full_ct_dim, const std::uint32_t face_r_dim = FACE_R_DIM, const std::uint32_t num_faces = 4)
+{
+    static_assert(!dense || (!diagonal && !narrow_row), "diagonal and narrow_row must be false when dense");
     LLK_ASSERT(num_faces == 1 || num_faces == 2 || num_faces == 4, "num_faces must be 1, 2, or 4");
-    const std::uint32_t PACKCNT              = diagonal ? (num_faces > 2 ? num_faces / 2 : num_faces) : ((face_r_dim < FACE_R_DIM) ? 1 : num_faces);
+    LLK_ASSERT(block_ct_dim >= 1 && block_ct_dim <= full_ct_dim, "block_ct_dim must be in [1, full_ct_dim]");
+    LLK_ASSERT(!dense || (num_faces <= 2), "num_faces must be 1 or 2 when dense");
+    LLK_ASSERT(!dense || ((face_r_dim & (face_r_dim - 1)) == 0), "face_r_dim must be a power of two when dense");
+    const std::uint32_t PACKCNT = dense      ? _llk_pack_untilize_dense_packer_count_(face_r_dim)
+                                  : diagonal ? (num_faces > 2 ? num_faces / 2 : num_faces)
+                                             : ((face_r_dim < FACE_R_DIM) ? 1 : num_faces);
     constexpr std::uint32_t MEGAROW          = 1;
     constexpr std::uint32_t ZERO_OUTPUT_FLAG = p_pacr::P_ZERO_OUTPUT_DISABLED;
     constexpr std::uint32_t MOP_INNER_LOOP   = narrow_row ? (TILE_R_DIM / 4) : (diagonal ? FACE_R_DIM - 1 : 1);
-    constexpr std::uint32_t MOP_OUTER_LOOP   = narrow_row ? 1 : block_ct_dim;
+    const std::uint32_t MOP_OUTER_LOOP       = narrow_row ? 1 : block_ct_dim;
 
     if constexpr (diagonal)
     {
@@ -89,20 +107,20 @@ inline void _llk_pack_untilize_mop_config_(const std::uint32_t face_r_dim = FACE
         }
         else
         {
+            // z cnt points to the next dense tile, w cnt points to the next tile
+            const std::uint32_t next_tile_op = dense ? TT_OP_INCADCZW(p_setadc::PAC, 0, 0, 0, num_faces) : TT_OP_INCADCZW(p_setadc::PAC, 0, 0, 1, 0);
             if (num_faces > 1)
             {
                 // Inc ch0_y+=1 (addr_mod_0 will increment by 15)
                 ckernel::ckernel_template tmp(MOP_OUTER_LOOP, MOP_INNER_LOOP, TT_OP_INCADCXY(p_setadc::PAC, 0, 0, 1, 0));
                 tmp.set_start_op(TT_OP_PACR(ADDR_MOD_0, ZERO_OUTPUT_FLAG, PACK_SEL(PACKCNT), 0, MEGAROW, 0, 0));
-                tmp.set_end_ops(
-                    TT_OP_PACR(ADDR_MOD_1, ZERO_OUTPUT_FLAG, PACK_SEL(PACKCNT), 0, MEGAROW, 0, 0),
-                    TT_OP_INCADCZW(p_setadc::PAC, 0, 0, 1, 0)); // w cnt points to the next tile
+                tmp.set_end_ops(TT_OP_PACR(ADDR_MOD_1, ZERO_OUTPUT_FLAG, PACK_SEL(PACKCNT), 0, MEGAROW, 0, 0), next_tile_op);
                 tmp.program();
             }
             else
             {
                 ckernel::ckernel_template tmp(MOP_OUTER_LOOP, MOP_INNER_LOOP, TT_OP_PACR(ADDR_MOD_1, ZERO_OUTPUT_FLAG, PACK_SEL(PACKCNT), 0, MEGAROW, 0, 0));
-                tmp.set_end_op(TT_OP_INCADCZW(p_setadc::PAC, 0, 0, 1, 0)); // w cnt points to the next tile
+                tmp.set_end_op(next_tile_op);
                 tmp.program();
             }
         }
@@ -131,17 +149,36 @@ template <
     std::uint32_t full_ct_dim    = block_ct_dim,
     bool diagonal                = false,
     bool narrow_row              = false,
-    std::uint32_t row_num_datums = TILE_C_DIM>
-inline void _llk_pack_untilize_init_(const std::uint32_t pack_dst_format, const std::uint32_t face_r_dim = FACE_R_DIM, const std::uint32_t num_faces = 4)
+    std::uint32_t row_num_datums = TILE_C_DIM,
+    bool dense                   = false>
+inline void _llk_pack_untilize_mop_config_(const std::uint32_t face_r_dim = FACE_R_DIM, const std::uint32_t num_faces = 4)
+{
+    _llk_pack_untilize_mop_config_runtime_<diagonal, narrow_row, dense>(block_ct_dim, full_ct_dim, face_r_dim, num_faces);
+}
+
+/*
+Runtime-width variant of _llk_pack_untilize_init_.
+full_ct_dim only sets the L1 row stride, so it does not have to be a multiple of block_ct_dim.
+This lets a row band wider than dest be streamed into row-major L1 one dest section at a time, with a narrower tail block if needed.
+*/
+template <bool diagonal = false, bool narrow_row = false, std::uint32_t row_num_datums = TILE_C_DIM, bool dense = false>
+inline void _llk_pack_untilize_init_runtime_(
+    const std::uint32_t pack_dst_format,
+    const std::uint32_t block_ct_dim,
+    const std::uint32_t full_ct_dim,
+    const std::uint32_t face_r_dim = FACE_R_DIM,
+    const std::uint32_t num_faces  = 4)
 {
     LLK_ASSERT(num_faces == 1 || num_faces == 2 || num_faces == 4, "num_faces must be 1, 2, or 4");
     _llk_pack_untilize_configure_addrmod_<diagonal, narrow_row>();
 
-    _llk_pack_untilize_mop_config_<block_ct_dim, full_ct_dim, diagonal, narrow_row, row_num_datums>(face_r_dim, num_faces);
+    _llk_pack_untilize_mop_config_runtime_<diagonal, narrow_row, dense>(block_ct_dim, full_ct_dim, face_r_dim, num_faces);
 
     if (block_ct_dim != full_ct_dim)
     {
-        const std::uint32_t output_addr_offset = SCALE_DATUM_SIZE(pack_dst_format, full_ct_dim * ((num_faces > 1) ? num_faces / 2 : 1) * FACE_C_DIM);
+        // A dense tile row holds all of its faces side by side
+        const std::uint32_t faces_per_row      = dense ? num_faces : ((num_faces > 1) ? num_faces / 2 : 1);
+        const std::uint32_t output_addr_offset = SCALE_DATUM_SIZE(pack_dst_format, full_ct_dim * faces_per_row * FACE_C_DIM);
         TT_SETDMAREG(0, LOWER_HALFWORD(output_addr_offset / 16), 0, LO_16(p_gpr_pack::OUTPUT_ADDR_OFFSET)); // store 16B aligned row offset address
     }
 
@@ -160,29 +197,56 @@ inline void _llk_pack_untilize_init_(const std::uint32_t pack_dst_format, const
     }
 }
 
+/*
+block_ct_dim represents the number of input tiles in a block.
+dense requires _llk_pack_dest_init_ to be called with dense = true so the packer dest offsets split the face rows across all packers.
+*/
+template <
+    std::uint32_t block_ct_dim,
+    std::uint32_t full_ct_dim    = block_ct_dim,
+    bool diagonal                = false,
+    bool narrow_row              = false,
+    std::uint32_t row_num_datums = TILE_C_DIM,
+    bool dense                   = false>
+inline void _llk_pack_untilize_init_(const std::uint32_t pack_dst_format, const std::uint32_t face_r_dim = FACE_R_DIM, const std::uint32_t num_faces = 4)
+{
+    static_assert(!dense || (!diagonal && !narrow_row), "diagonal and narrow_row must be false when dense");
+
+    _llk_pack_untilize_init_runtime_<diagonal, narrow_row, row_num_datums, dense>(pack_dst_format, block_ct_dim, full_ct_dim, face_r_dim, num_faces);
+}
+
 inline void _llk_pack_untilize_uninit_(const std::uint32_t face_r_dim)
 {
     TT_SETADCXX(p_setadc::PAC, face_r_dim * FACE_C_DIM - 1, 0x0);
 }
 
-template <
-    std::uint32_t block_ct_dim,
-    std::uint32_t full_ct_dim        = block_ct_dim,
-    bool diagonal                    = false,
-    bool narrow_row                  = false,
-    std::uint32_t row_num_datums     = TILE_C_DIM,
-    std::uint32_t tile_dst_ct_offset = 0>
-inline void _llk_pack_untilize_(
+/*
+Runtime variant of _llk_pack_untilize_. Packs the block currently programmed into the MOP
+(see _llk_pack_untilize_init_runtime_ / _llk_pack_untilize_mop_config_runtime_) starting at dest tile tile_dst_offset.
+address points to the top-left datum of the block inside the row-major output, i.e. the row band base address
+advanced by the width of all previously packed blocks.
+*/
+template <bool diagonal = false, bool narrow_row = false, std::uint32_t row_num_datums = TILE_C_DIM, bool dense = false>
+inline void _llk_pack_untilize_runtime_(
     const std::uint32_t address,
     const std::uint32_t pack_dst_format,
+    const std::uint32_t block_ct_dim,
+    const std::uint32_t full_ct_dim,
     const std::uint32_t face_r_dim                 = FACE_R_DIM,
     [[maybe_unused]] const std::uint32_t num_faces = 4,
-    const std::uint32_t tile_dst_rt_offset         = 0)
+    const std::uint32_t tile_dst_offset            = 0)
 {
-    static_assert(full_ct_dim % block_ct_dim == 0, "full_ct_dim must be divisible by block_ct_dim");
-    LLK_ASSERT(num_faces == 4, "num_faces: this parameter is unused");
+    LLK_ASSERT(dense || (num_faces == 4), "num_faces: this parameter is only used when dense");
+    LLK_ASSERT(block_ct_dim >= 1 && block_ct_dim <= full_ct_dim, "block_ct_dim must be in [1, full_ct_dim]");
 
-    program_packer_untilized_destination<block_ct_dim, full_ct_dim, diagonal, row_num_datums>(address, pack_dst_format);
+    if constexpr (dense)
+    {
+        program_packer_dense_untilized_destination(address, pack_dst_format, full_ct_dim, face_r_dim, num_faces);
+    }
+    else
+    {
+        program_packer_untilized_destination_runtime<diagonal, row_num_datums>(address, pack_dst_format, full_ct_dim);
+    }
 
     if constexpr (narrow_row)
     {
@@ -190,22 +254,55 @@ inline void _llk_pack_untilize_(
     }
     else
     {
-        const std::uint32_t num_rows = (face_r_dim < FACE_R_DIM) ? face_r_dim : TILE_R_DIM / 4;
+        const std::uint32_t num_rows = dense                        ? face_r_dim / _llk_pack_untilize_dense_packer_count_(face_r_dim)
+                                       : (face_r_dim < FACE_R_DIM) ? face_r_dim
+                                                                   : TILE_R_DIM / 4;
 
         for (std::uint32_t row = 0; row < num_rows; row++)
         {
-            set_dst_write_addr(tile_dst_ct_offset + tile_dst_rt_offset); // Clear tile counter
+            if constexpr (dense)
+            {
+                TTI_SETADCZW(p_setadc::PAC, 0, 0, 0, 0, 0b0001); // Clear dense tile counter
+            }
+            set_dst_write_addr(tile_dst_offset); // Clear tile counter
             ckernel::ckernel_template::run();
             TTI_ADDRCRXY(p_setadc::PAC, 0, 0, 1, 0, 0b0010); // Read new row in the tile
-            if constexpr (block_ct_dim != full_ct_dim)
+            if (block_ct_dim != full_ct_dim)
             {
                 lltt::replay(ckernel::packer::replay_buf_offset, 10); // update row address
             }
         }
     }
 
-    if constexpr (block_ct_dim == full_ct_dim)
+    if (block_ct_dim == full_ct_dim)
     {
         TTI_PACR(ADDR_MOD_2, 0, 0xf, 0, 0, 1, 1); // close block
     }
+
+    if constexpr (dense)
+    {
+        TTI_SETADCZW(p_setadc::PAC, 0, 0, 0, 0, 0b0101); // reset z counters
+    }
+}
+
+template <
+    std::uint32_t block_ct_dim,
+    std::uint32_t full_ct_dim        = block_ct_dim,
+    bool diagonal                    = false,
+    bool narrow_row                  = false,
+    std::uint32_t row_num_datums     = TILE_C_DIM,
+    std::uint32_t tile_dst_ct_offset = 0,
+    bool dense                       = false>
+inline void _llk_pack_untilize_(
+    const std::uint32_t address,
+    const std::uint32_t pack_dst_format,
+    const std::uint32_t face_r_dim         = FACE_R_DIM,
+    const std::uint32_t num_faces          = 4,
+    const std::uint32_t tile_dst_rt_offset = 0)
+{
+    static_assert(full_ct_dim % block_ct_dim == 0, "full_ct_dim must be divisible by block_ct_dim");
+    static_assert(!dense || (!diagonal && !narrow_row), "diagonal and narrow_row must be false when dense");
+
+    _llk_pack_untilize_runtime_<diagonal, narrow_row, row_num_datums, dense>(
+        address, pack_dst_format, block_ct_dim, full_ct_dim, face_r_dim, num_faces, tile_dst_ct_offset + tile_dst_rt_offset);
 }
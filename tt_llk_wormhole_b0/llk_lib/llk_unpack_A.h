@@ -297,6 +297,45 @@ inline void _llk_unpack_A_(const std::uint32_t address, const std::uint32_t unpa
     switch_config_context(unp_cfg_context);
 }
 
+/**
+ * @brief Unpacks a list of tiles from arbitrary L1 addresses into srcA back-to-back
+ *
+ * Intended for gathers where consecutive tiles are not contiguous in L1 (paged KV cache, embedding lookups, sparse rows).
+ * All tiles of the list are unpacked within a single config context: the base address of each tile is issued
+ * through a GPR so that the next unpack can be queued without waiting for the previous one to finish.
+ * Requires _llk_unpack_A_init_ with BroadcastType::NONE and without acc_to_dest/unpack_to_dest.
+ *
+ * @param l1_addresses List of num_tiles tile addresses, in the order the tiles should land in dest
+ * @param num_tiles Number of tiles in the list
+ */
+inline void _llk_unpack_A_gather_(const std::uint32_t *l1_addresses, const std::uint32_t num_tiles)
+{
+    LLK_ASSERT(num_tiles > 0, "num_tiles must be greater than 0");
+
+    // Wait for free context
+    wait_for_next_context(2);
+
+    // Trisc::SEMPOST for context acquire
+    semaphore_post(semaphore::UNPACK_SYNC);
+
+    for (std::uint32_t tile = 0; tile < num_tiles; tile++)
+    {
+        // Clear z/w start counters
+        TTI_SETADCZW(0b011, 0, 0, 0, 0, 0b1111);
+
+        _llk_unpack_set_base_address_from_gpr_<p_setadc::UNP_A>(l1_addresses[tile]);
+
+        // Run MOP
+        ckernel::ckernel_template::run();
+    }
+
+    // T6::SEMGET for context release
+    t6_semaphore_get(semaphore::UNPACK_SYNC);
+
+    // Switch unpacker config context
+    switch_config_context(unp_cfg_context);
+}
+
 template <BroadcastType BType = BroadcastType::NONE>
 inline void _llk_unpack_A_uninit_(const std::uint32_t face_r_dim)
 {
@@ -240,3 +240,36 @@ inline void _llk_unpack_configure_single_address_(const std::uint32_t address, v
         cfg[THCON_SEC0_REG3_Base_cntx1_address_ADDR32] = address;
     }
 }
+
+/**
+ * @brief Validates L1 address and programs it as the base address of one unpacker from a GPR
+ *
+ * Unlike _llk_unpack_configure_single_address_, the write is issued through the Tensix instruction stream,
+ * so it is ordered with the unpacks already in flight and can be used to retarget the unpacker between two
+ * unpacks within a single config context. The write waits for the previous unpack to finish reading the old
+ * address, and the next unpack is stalled until the new address has landed.
+ *
+ * @tparam UNP_SEL Unpacker whose base address is written, p_setadc::UNP_A (THCON_SEC0) or p_setadc::UNP_B (THCON_SEC1)
+ * @param address Address to program
+ */
+template <std::uint32_t UNP_SEL>
+inline void _llk_unpack_set_base_address_from_gpr_(const std::uint32_t address)
+{
+    static_assert(UNP_SEL == p_setadc::UNP_A || UNP_SEL == p_setadc::UNP_B, "UNP_SEL must be UNP_A or UNP_B");
+    LLK_ASSERT(is_valid_L1_address(address), "L1 address must be in valid L1 memory region");
+
+    constexpr std::uint32_t gpr = (UNP_SEL == p_setadc::UNP_A) ? p_gpr_unpack::TMP0 : p_gpr_unpack::TMP1;
+    const std::uint32_t base_reg =
+        (UNP_SEL == p_setadc::UNP_A)
+            ? ((0 == unp_cfg_context) ? THCON_SEC0_REG3_Base_address_ADDR32 : THCON_SEC0_REG3_Base_cntx1_address_ADDR32)
+            : ((0 == unp_cfg_context) ? THCON_SEC1_REG3_Base_address_ADDR32 : THCON_SEC1_REG3_Base_cntx1_address_ADDR32);
+
+    // Wait for the previous unpack to finish before retargeting it
+    TTI_STALLWAIT(p_stall::STALL_TDMA, p_stall::UNPACK);
+    TT_SETDMAREG(0, LOWER_HALFWORD(address), 0, LO_16(gpr));
+    TT_SETDMAREG(0, UPPER_HALFWORD(address), 0, HI_16(gpr));
+    TT_REG2FLOP(1, 0, 0, 0, base_reg - THCON_CFGREG_BASE_ADDR32, gpr);
+
+    // Stall unpacker until pending CFG writes from Trisc have completed
+    TTI_STALLWAIT(p_stall::STALL_UNPACK, p_stall::THCON);
+}